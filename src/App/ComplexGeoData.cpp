@@ -585,8 +585,19 @@ void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
 {
     flushElementMap();
     if (_elementMap) {
-        writer.Stream() << "BeginElementMap v1\n";
-        _elementMap->save(writer.Stream());
+        // The binary layout is smaller and faster to restore, but it cannot be read by versions
+        // knowing only v1, so it is opt-in.
+        bool binary = App::GetApplication()
+                          .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+                          ->GetBool("BinaryElementMap", false);
+        if (binary) {
+            writer.Stream() << "BeginElementMap v2\n";
+            _elementMap->saveBinary(writer.Stream());
+        }
+        else {
+            writer.Stream() << "BeginElementMap v1\n";
+            _elementMap->save(writer.Stream());
+        }
     }
 }
 
@@ -598,14 +609,18 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     if (boost::equals(marker, "BeginElementMap")) {
         resetElementMap();
         reader >> ver;
-        if (ver != "v1") {
-            FC_WARN("Unknown element map format");  // NOLINT
-        }
-        else {
+        if (ver == "v1") {
             resetElementMap(std::make_shared<ElementMap>());
             _elementMap = _elementMap->restore(Hasher, reader);
             return;
         }
+        if (ver == "v2") {
+            reader.get();  // end of the marker line, the binary data follows
+            resetElementMap(std::make_shared<ElementMap>());
+            _elementMap = _elementMap->restoreBinary(Hasher, reader);
+            return;
+        }
+        FC_WARN("Unknown element map format");  // NOLINT
     }
     std::size_t count = atoi(marker.c_str());
     restoreStream(reader, count);
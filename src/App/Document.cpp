@@ -498,6 +498,18 @@ void Document::_commitTransaction(bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        if(d->UndoMemSize > 0) {
+            // drop the oldest transactions beyond the memory limit, but keep the last one
+            unsigned int memSize = 0;
+            for (auto transaction : mUndoTransactions)
+                memSize += transaction->getMemSize();
+            while(mUndoTransactions.size() > 1 && memSize > d->UndoMemSize) {
+                memSize -= mUndoTransactions.front()->getMemSize();
+                mUndoMap.erase(mUndoTransactions.front()->getID());
+                delete mUndoTransactions.front();
+                mUndoTransactions.pop_front();
+            }
+        }
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -601,6 +613,7 @@ void Document::clearDocument()
     d->objectArray.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->clearTopologicalOrder();
     d->lastObjectId = 0;
 }
 
@@ -689,7 +702,30 @@ int Document::getUndoMode() const
 
 unsigned int Document::getUndoMemSize () const
 {
-    return d->UndoMemSize;
+    unsigned int size = 0;
+    for (auto memSize : getAvailableUndoMemSizes())
+        size += memSize;
+    for (auto memSize : getAvailableRedoMemSizes())
+        size += memSize;
+    return size;
+}
+
+std::vector<unsigned int> Document::getAvailableUndoMemSizes() const
+{
+    std::vector<unsigned int> vList;
+    if (d->activeUndoTransaction)
+        vList.push_back(d->activeUndoTransaction->getMemSize());
+    for (auto It=mUndoTransactions.rbegin();It!=mUndoTransactions.rend();++It)
+        vList.push_back((**It).getMemSize());
+    return vList;
+}
+
+std::vector<unsigned int> Document::getAvailableRedoMemSizes() const
+{
+    std::vector<unsigned int> vList;
+    for (auto It=mRedoTransactions.rbegin();It!=mRedoTransactions.rend();++It)
+        vList.push_back((**It).getMemSize());
+    return vList;
 }
 
 void Document::setUndoLimit(unsigned int UndoMemSize)
@@ -1959,10 +1995,14 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
-        writer.putNextEntry("Document.xml");
 
         if (hGrp->GetBool("SaveBinaryBrep", false))
             writer.setMode("BinaryBrep");
+        // Store Document.xml and GuiDocument.xml in the compact binary encoding
+        if (hGrp->GetBool("SaveBinaryXML", false))
+            writer.setMode("BinaryXML");
+
+        writer.putNextEntry("Document.xml");
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << endl
                         << "<!--" << endl
@@ -2042,6 +2082,7 @@ void Document::restore (const char *filename,
     d->objectArray.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->clearTopologicalOrder();
     d->lastObjectId = 0;
 
     if(signal) {
@@ -2087,6 +2128,9 @@ void Document::restore (const char *filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
+    // Objects supporting it read their (potentially big) data files only when they are needed
+    reader.setDeferFiles(GetApplication().GetParameterGroupByPath
+            ("User parameter:BaseApp/Preferences/Document")->GetBool("DeferLoadingFiles",false));
     reader.readFiles(zipstream);
 
     if (reader.testStatus(Base::XMLReader::ReaderStatus::PartialRestore)) {
@@ -2454,6 +2498,18 @@ std::vector<App::DocumentObject*> Document::getDependencyList(
         return ret;
     }
 
+    // Objects of a single document are sorted by the topological order that
+    // the document maintains on link changes, which saves building the graph
+    _buildDependencyList(objectArray,options,&ret,nullptr,nullptr);
+    if(ret.empty())
+        return ret;
+    auto doc = ret.front()->getDocument();
+    bool singleDoc = std::all_of(ret.begin(), ret.end(),
+            [doc](const DocumentObject *obj) { return obj->getDocument() == doc; });
+    if(singleDoc && doc->d->sortByTopologicalOrder(ret))
+        return ret;
+    ret.clear();
+
     DependencyList depList;
     std::map<DocumentObject*,Vertex> objectMap;
     std::map<Vertex,DocumentObject*> vertexMap;
@@ -2790,33 +2846,23 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
     Base::ObjectStatusLocker<Document::Status, Document> exe(Document::Recomputing, this);
     signalBeforeRecompute(*this);
 
-#if 0
-    //////////////////////////////////////////////////////////////////////////
-    // FIXME Comment by Realthunder:
-    // the topologicalSrot() below cannot handle partial recompute, haven't got
-    // time to figure out the code yet, simply use back boost::topological_sort
-    // for now, that is, rely on getDependencyList() to do the sorting. The
-    // downside is, it didn't take advantage of the ready built InList, nor will
-    // it report for cyclic dependency.
-    //////////////////////////////////////////////////////////////////////////
-
-    // get the sorted vector of all dependent objects and go though it from the end
-    auto depObjs = getDependencyList(objs.empty()?d->objectArray:objs);
-    vector<DocumentObject*> topoSortedObjects = topologicalSort(depObjs);
-    if (topoSortedObjects.size() != depObjs.size()){
-        cerr << "App::Document::recompute(): cyclic dependency detected" << endl;
-        topoSortedObjects = d->partialTopologicalSort(depObjs);
-    }
-    std::reverse(topoSortedObjects.begin(),topoSortedObjects.end());
-#else
+    // The objects are sorted using the topological order maintained by the
+    // document, getDependencyList() only falls back to build the dependency
+    // graph for cyclic dependencies, which it then reports
     auto topoSortedObjects = getDependencyList(objs.empty()?d->objectArray:objs,DepSort|options);
-#endif
-    for(auto obj : topoSortedObjects)
+    for(auto obj : topoSortedObjects) {
         obj->setStatus(ObjectStatus::PendingRecompute,true);
+        // a forced recompute discards the inputs remembered by the last recompute
+        if (force)
+            obj->_recomputeFingerprint = 0;
+    }
 
     ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
             "User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute",true);
+    Base::StateLocker skipLock(d->skipUnchangedRecompute,
+            !force && hGrp->GetBool("SkipUnchangedRecompute",false));
+    unsigned long skippedCount = d->skippedRecomputeCount;
 
     std::set<App::DocumentObject *> filter;
     size_t idx = 0;
@@ -2888,6 +2934,9 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
     }
 
     FC_TIME_LOG(t2, "Recompute");
+    if(d->skippedRecomputeCount != skippedCount)
+        FC_LOG("Skipped " << d->skippedRecomputeCount - skippedCount << " of "
+                << objectCount << " recomputes with unchanged inputs");
 
     for(auto obj : topoSortedObjects) {
         if(!obj->getNameInDocument())
@@ -3099,6 +3148,195 @@ std::vector<App::DocumentObject*> Document::topologicalSort() const
     return d->topologicalSort(d->objectArray);
 }
 
+// Maintains the topological order with the algorithm of Pearce and Kelly, "A
+// dynamic topological sort algorithm for directed acyclic graphs". Only the
+// objects between the two affected positions are visited and reordered.
+void DocumentP::addToTopologicalOrder(const App::DocumentObject* dep, const App::DocumentObject* obj)
+{
+    if(topoOrderCyclic)
+        return;
+    if(dep == obj) {
+        topoOrderCyclic = true;
+        return;
+    }
+    // objects without a position yet are appended
+    auto itDep = topoOrder.emplace(dep, topoOrderNext);
+    if(itDep.second)
+        ++topoOrderNext;
+    auto itObj = topoOrder.emplace(obj, topoOrderNext);
+    if(itObj.second)
+        ++topoOrderNext;
+    long lower = itObj.first->second;
+    long upper = itDep.first->second;
+    if(upper < lower)
+        return;
+
+    auto position = [this](const App::DocumentObject *o) {
+        auto it = topoOrder.find(o);
+        return it == topoOrder.end() ? -1 : it->second;
+    };
+
+    // objects depending on obj that are not yet behind dep
+    std::vector<const App::DocumentObject*> forward;
+    std::unordered_set<const App::DocumentObject*> visited {obj};
+    std::vector<const App::DocumentObject*> pending {obj};
+    while(!pending.empty()) {
+        auto o = pending.back();
+        pending.pop_back();
+        forward.push_back(o);
+        for(auto in : o->getInList()) {
+            if(in == dep) {
+                topoOrderCyclic = true;
+                return;
+            }
+            long pos = position(in);
+            if(pos >= 0 && pos < upper && in->getDocument() == obj->getDocument()
+                    && visited.insert(in).second)
+                pending.push_back(in);
+        }
+    }
+
+    // objects dep depends on that are not yet before obj
+    std::vector<const App::DocumentObject*> backward;
+    visited.insert(dep);
+    pending.push_back(dep);
+    while(!pending.empty()) {
+        auto o = pending.back();
+        pending.pop_back();
+        backward.push_back(o);
+        for(auto out : o->getOutList()) {
+            long pos = position(out);
+            if(pos > lower && out->getDocument() == dep->getDocument()
+                    && visited.insert(out).second)
+                pending.push_back(out);
+        }
+    }
+
+    // reuse the positions of both sets, putting dep's dependencies first
+    auto byPosition = [&](const App::DocumentObject *a, const App::DocumentObject *b) {
+        return topoOrder[a] < topoOrder[b];
+    };
+    std::sort(forward.begin(), forward.end(), byPosition);
+    std::sort(backward.begin(), backward.end(), byPosition);
+    std::vector<long> positions;
+    positions.reserve(forward.size() + backward.size());
+    for(auto o : backward)
+        positions.push_back(topoOrder[o]);
+    for(auto o : forward)
+        positions.push_back(topoOrder[o]);
+    std::sort(positions.begin(), positions.end());
+    std::size_t i = 0;
+    for(auto o : backward)
+        topoOrder[o] = positions[i++];
+    for(auto o : forward)
+        topoOrder[o] = positions[i++];
+}
+
+bool DocumentP::rebuildTopologicalOrder()
+{
+    topoOrder.clear();
+    topoOrderNext = 0;
+    topoOrderCyclic = false;
+
+    // Kahn's algorithm, the InList holds the objects that have to come later
+    std::unordered_map<const App::DocumentObject*, std::size_t> count;
+    for(auto obj : objectArray)
+        count.emplace(obj, 0);
+    std::vector<std::vector<App::DocumentObject*> > inLists(objectArray.size());
+    for(std::size_t i=0; i<objectArray.size(); ++i) {
+        auto &inList = inLists[i];
+        for(auto in : objectArray[i]->getInList()) {
+            if(in && count.count(in))
+                inList.push_back(in);
+        }
+        std::sort(inList.begin(), inList.end());
+        inList.erase(std::unique(inList.begin(), inList.end()), inList.end());
+        for(auto in : inList)
+            ++count[in];
+    }
+
+    std::unordered_map<const App::DocumentObject*, std::size_t> index;
+    for(std::size_t i=0; i<objectArray.size(); ++i)
+        index.emplace(objectArray[i], i);
+    std::deque<App::DocumentObject*> ready;
+    for(auto obj : objectArray) {
+        if(!count[obj])
+            ready.push_back(obj);
+    }
+    while(!ready.empty()) {
+        auto obj = ready.front();
+        ready.pop_front();
+        topoOrder[obj] = topoOrderNext++;
+        for(auto in : inLists[index[obj]]) {
+            if(--count[in] == 0)
+                ready.push_back(in);
+        }
+    }
+
+    if(topoOrder.size() != objectArray.size()) {
+        topoOrderCyclic = true;
+        return false;
+    }
+    return true;
+}
+
+bool DocumentP::checkTopologicalOrder(const std::vector<App::DocumentObject*>& objects) const
+{
+    for(auto obj : objects) {
+        auto it = topoOrder.find(obj);
+        if(it == topoOrder.end())
+            return false;
+        for(auto in : obj->getInList()) {
+            if(!in || in->getDocument() != obj->getDocument())
+                continue;
+            auto jt = topoOrder.find(in);
+            if(jt == topoOrder.end() || jt->second <= it->second)
+                return false;
+        }
+    }
+    return true;
+}
+
+bool DocumentP::sortByTopologicalOrder(std::vector<App::DocumentObject*>& objects)
+{
+    if(topoOrderCyclic)
+        return false;
+    // Objects without links have no position yet. Putting them last is only
+    // wrong if something depends on them, which the check below detects.
+    for(auto obj : objects) {
+        if(topoOrder.emplace(obj, topoOrderNext).second)
+            ++topoOrderNext;
+    }
+    // The order is checked as the links of objects may change without
+    // notification, e.g. when an object is restored by undo/redo
+    if(!checkTopologicalOrder(objects)) {
+        FC_LOG("rebuild topological order");
+        if(!rebuildTopologicalOrder() || !checkTopologicalOrder(objects))
+            return false;
+    }
+    std::sort(objects.begin(), objects.end(),
+            [this](const App::DocumentObject *a, const App::DocumentObject *b) {
+                return topoOrder[a] < topoOrder[b];
+            });
+    return true;
+}
+
+void Document::_updateDependency(DocumentObject* dep, DocumentObject* obj, bool added)
+{
+    if(!obj || obj->getDocument() != this)
+        return;
+    // rebuild the order once on the next recompute instead of updating it for every link
+    if(testStatus(Document::Restoring)) {
+        if(!d->topoOrder.empty())
+            d->clearTopologicalOrder();
+        return;
+    }
+    if(added)
+        d->addToTopologicalOrder(dep, obj);
+    else
+        d->topoOrderCyclic = false;
+}
+
 const char * Document::getErrorDescription(const App::DocumentObject*Obj) const
 {
     return d->findRecomputeLog(Obj);
@@ -3110,9 +3348,24 @@ int Document::_recomputeFeature(DocumentObject* Feat)
     FC_LOG("Recomputing " << Feat->getFullName());
 
     DocumentObjectExecReturn  *returnCode = nullptr;
+    // only kept if this recompute succeeds
+    std::size_t fingerprint = Feat->_recomputeFingerprint;
+    Feat->_recomputeFingerprint = 0;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
         if (returnCode == DocumentObject::StdReturn) {
+            // The expressions are evaluated now, if they and all other inputs are the same as
+            // after the last successful recompute the result would be the same, too. An enforced
+            // recompute is never skipped.
+            if (d->skipUnchangedRecompute && fingerprint
+                    && !Feat->testStatus(ObjectStatus::Enforce)
+                    && Feat->canSkipUnchangedRecompute()
+                    && fingerprint == Feat->getInputFingerprint()) {
+                FC_LOG("Skip recomputing " << Feat->getFullName() << " with unchanged inputs");
+                Feat->_recomputeFingerprint = fingerprint;
+                ++d->skippedRecomputeCount;
+                return 0;
+            }
             returnCode = Feat->recompute();
             if(returnCode == DocumentObject::StdReturn)
                 returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteOutput);
@@ -3150,6 +3403,8 @@ int Document::_recomputeFeature(DocumentObject* Feat)
 
     if (returnCode == DocumentObject::StdReturn) {
         Feat->resetError();
+        if (d->skipUnchangedRecompute)
+            Feat->_recomputeFingerprint = Feat->getInputFingerprint();
     }
     else {
         returnCode->Which = Feat;
@@ -3160,6 +3415,11 @@ int Document::_recomputeFeature(DocumentObject* Feat)
     return 0;
 }
 
+unsigned long Document::getSkippedRecomputeCount() const
+{
+    return d->skippedRecomputeCount;
+}
+
 bool Document::recomputeFeature(DocumentObject* Feat, bool recursive)
 {
     // delete recompute log
@@ -3224,6 +3484,7 @@ DocumentObject * Document::addObject(const char* sType, const char* pObjectName,
     d->objectIdMap[pcObject->_Id] = pcObject;
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+    d->clearInListIndex();
     // insert in the vector
     d->objectArray.push_back(pcObject);
 
@@ -3328,6 +3589,7 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
         d->objectIdMap[pcObject->_Id] = pcObject;
         // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
         pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+        d->clearInListIndex();
         // insert in the vector
         d->objectArray.push_back(pcObject);
 
@@ -3392,6 +3654,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     d->objectIdMap[pcObject->_Id] = pcObject;
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+    d->clearInListIndex();
     // insert in the vector
     d->objectArray.push_back(pcObject);
 
@@ -3423,6 +3686,7 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
     d->objectArray.push_back(pcObject);
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+    d->clearInListIndex();
 
     // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3540,7 +3804,9 @@ void Document::removeObject(const char* sName)
     // In case the object gets deleted the pointer must be nullified
     if (tobedestroyed) {
         tobedestroyed->pcNameInDocument = nullptr;
+        d->clearInListIndex();
     }
+    d->topoOrder.erase(pos->second);
     d->objectMap.erase(pos);
 }
 
@@ -3605,6 +3871,7 @@ void Document::_removeObject(DocumentObject* pcObject)
     // remove from map
     pcObject->setStatus(ObjectStatus::Remove, false); // Unset the bit to be on the safe side
     d->objectIdMap.erase(pcObject->_Id);
+    d->topoOrder.erase(pcObject);
     d->objectMap.erase(pos);
 
     for (std::vector<DocumentObject*>::iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
@@ -347,6 +347,13 @@ public:
             bool force=false,bool *hasError=nullptr, int options=0);
     /// Recompute only one feature
     bool recomputeFeature(DocumentObject* Feat,bool recursive=false);
+    /** Return the number of object recomputes skipped because the inputs of the
+     * objects didn't change since their last recompute
+     *
+     * Skipping is enabled with the parameter SkipUnchangedRecompute of the group
+     * BaseApp/Preferences/Document. It never applies to a forced recompute.
+     */
+    unsigned long getSkippedRecomputeCount() const;
     /// get the text of the error of a specified object
     const char* getErrorDescription(const App::DocumentObject*) const;
     /// return the status bits
@@ -405,6 +412,10 @@ public:
     void setUndoLimit(unsigned int UndoMemSize=0);
     /// Returns the actual memory consumption of the Undo redo stuff.
     unsigned int getUndoMemSize () const;
+    /// Returns the memory used by each Undo, in the same order as getAvailableUndoNames()
+    std::vector<unsigned int> getAvailableUndoMemSizes() const;
+    /// Returns the memory used by each Redo, in the same order as getAvailableRedoNames()
+    std::vector<unsigned int> getAvailableRedoMemSizes() const;
     /// Set the Undo limit as stack size
     void setMaxUndoStackSize(unsigned int UndoMaxStackSize=20);
     /// Set the Undo limit as stack size
@@ -547,6 +558,8 @@ protected:
 
     void _removeObject(DocumentObject* pcObject);
     void _addObject(DocumentObject* pcObject, const char* pObjectName);
+    /// called by DocumentObject when \a obj starts or stops to depend on \a dep
+    void _updateDependency(DocumentObject* dep, DocumentObject* obj, bool added);
     /// checks if a valid transaction is open
     void _checkTransaction(DocumentObject* pcDelObj, const Property *What, int line);
     void breakDependency(DocumentObject* pcObject, bool clear);
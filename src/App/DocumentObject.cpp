@@ -24,9 +24,15 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <mutex>
 #include <stack>
+#include <unordered_map>
+#include <unordered_set>
+#include <boost/dynamic_bitset.hpp>
 #endif
 
+#include <boost/functional/hash.hpp>
+
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
 #include <Base/Matrix.h>
@@ -42,7 +48,9 @@
 #include "GeoFeatureGroupExtension.h"
 #include "ObjectIdentifier.h"
 #include "PropertyExpressionEngine.h"
+#include "PropertyFile.h"
 #include "PropertyLinks.h"
+#include "private/DocumentP.h"
 
 
 FC_LOG_LEVEL_INIT("App",true,true)
@@ -58,6 +66,193 @@ PROPERTY_SOURCE(App::DocumentObject, App::TransactionalObject)
 
 DocumentObjectExecReturn *DocumentObject::StdReturn = nullptr;
 
+#ifndef USE_OLD_DAG
+namespace {
+
+using InListSet = InListIndex::InListSet;
+
+void unite(InListSet& set, std::size_t ordinal)
+{
+    if (set.size() <= ordinal)
+        set.resize(ordinal + 1);
+    set.set(ordinal);
+}
+
+void unite(InListSet& set, const InListSet& other)
+{
+    if (set.size() < other.size())
+        set.resize(other.size());
+    if (set.size() == other.size()) {
+        set |= other;
+    }
+    else {
+        InListSet tmp(other);
+        tmp.resize(set.size());
+        set |= tmp;
+    }
+}
+
+} // namespace
+
+std::size_t InListIndex::ordinal(const DocumentObject* obj)
+{
+    auto res = ordinals.emplace(obj, objects.size());
+    if (res.second)
+        objects.push_back(const_cast<DocumentObject*>(obj));
+    return res.first->second;
+}
+
+const InListSet& InListIndex::get(const DocumentObject* obj)
+{
+    std::size_t root = ordinal(obj);
+    auto it = sets.find(root);
+    if (it != sets.end())
+        return it->second;
+
+    const Document* doc = obj->getDocument();
+
+    struct Frame {
+        const DocumentObject* obj;
+        std::size_t ordinal;
+        std::size_t next;
+        // false if the set lacks the parents of an object that was on the stack
+        bool complete;
+        // false if the set depends on objects of another document
+        bool local;
+        InListSet set;
+    };
+
+    // Depth first search that reuses the sets of already indexed parents. In
+    // case of a cyclic dependency the sets of the objects inside the cycle are
+    // not complete before the search returns to the first object of the cycle,
+    // so they are only kept for this search. The set of the root object is
+    // always complete because all parents are eventually merged into it.
+    //
+    // Link changes of objects of other documents are tracked by the index of
+    // their own document, so sets depending on them are not kept either.
+    std::unordered_map<std::size_t, std::pair<InListSet, bool> > partial;
+    std::unordered_set<std::size_t> visiting;
+    std::vector<Frame> stack;
+    stack.push_back({obj, root, 0, true, true, InListSet()});
+    visiting.insert(root);
+    for (;;) {
+        Frame& frame = stack.back();
+        const auto& inList = frame.obj->getInList();
+        if (frame.next < inList.size()) {
+            auto parent = inList[frame.next++];
+            if (!parent || !parent->isAttachedToDocument())
+                continue;
+            std::size_t index = ordinal(parent);
+            unite(frame.set, index);
+            auto found = sets.find(index);
+            if (found != sets.end()) {
+                unite(frame.set, found->second);
+                continue;
+            }
+            auto foundPartial = partial.find(index);
+            if (foundPartial != partial.end()) {
+                unite(frame.set, foundPartial->second.first);
+                frame.complete = false;
+                frame.local = frame.local && foundPartial->second.second;
+                continue;
+            }
+            if (!visiting.insert(index).second) {
+                frame.complete = false;
+                continue;
+            }
+            stack.push_back({parent, index, 0, true, parent->getDocument() == doc, InListSet()});
+            continue;
+        }
+
+        Frame done = std::move(frame);
+        stack.pop_back();
+        visiting.erase(done.ordinal);
+        if (stack.empty()) {
+            if (done.local)
+                return sets[root] = std::move(done.set);
+            uncached = std::move(done.set);
+            return uncached;
+        }
+
+        Frame& child = stack.back();
+        unite(child.set, done.set);
+        child.complete = child.complete && done.complete;
+        child.local = child.local && done.local;
+        if (done.complete && done.local)
+            sets[done.ordinal] = std::move(done.set);
+        else
+            partial[done.ordinal] = std::make_pair(std::move(done.set), done.local);
+    }
+}
+
+bool InListIndex::contains(const DocumentObject* obj, const DocumentObject* parent)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const InListSet& set = get(obj);
+    auto it = ordinals.find(parent);
+    return it != ordinals.end() && it->second < set.size() && set.test(it->second);
+}
+
+void InListIndex::getInList(const DocumentObject* obj,
+                            std::set<DocumentObject*>& inSet,
+                            std::vector<DocumentObject*>* inList)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<DocumentObject*> res;
+    {
+        const InListSet& set = get(obj);
+        for (auto i = set.find_first(); i != InListSet::npos; i = set.find_next(i)) {
+            auto o = objects[i];
+            if (inSet.insert(o).second && inList)
+                res.push_back(o);
+        }
+    }
+    if (!inList)
+        return;
+
+    // An object has more objects depending on it than any object in its
+    // InList, unless they are part of the same cycle. So sorting by the size
+    // of the recursive InLists puts the furthest linking objects last.
+    std::vector<std::pair<std::size_t, DocumentObject*> > sorted;
+    sorted.reserve(res.size());
+    for (auto o : res)
+        sorted.emplace_back(get(o).count(), o);
+    std::stable_sort(sorted.begin(), sorted.end(),
+            [](const auto &a, const auto &b) { return a.first > b.first; });
+    for (auto &v : sorted)
+        inList->push_back(v.second);
+}
+
+void InListIndex::invalidate(const DocumentObject* obj)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ordinals.find(obj);
+    if (it == ordinals.end())
+        return;
+    std::size_t index = it->second;
+    for (auto jt = sets.begin(); jt != sets.end();) {
+        const InListSet& set = jt->second;
+        if (jt->first == index || (index < set.size() && set.test(index)))
+            jt = sets.erase(jt);
+        else
+            ++jt;
+    }
+}
+
+void InListIndex::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (ordinals.empty())
+        return;
+    // swap instead of clear() to also release the buckets
+    decltype(ordinals)().swap(ordinals);
+    decltype(objects)().swap(objects);
+    decltype(sets)().swap(sets);
+    InListSet().swap(uncached);
+}
+
+#endif // USE_OLD_DAG
+
 //===========================================================================
 // DocumentObject
 //===========================================================================
@@ -209,6 +404,8 @@ void DocumentObject::touch(bool noRecompute)
     if(!noRecompute)
         StatusBits.set(ObjectStatus::Enforce);
     StatusBits.set(ObjectStatus::Touch);
+    // a touched object is recomputed even if its inputs didn't change
+    _recomputeFingerprint = 0;
     if (_pDoc)
         _pDoc->signalTouchedObject(*this);
 }
@@ -246,6 +443,43 @@ bool DocumentObject::mustRecompute() const
     return mustExecute() > 0;
 }
 
+bool DocumentObject::canSkipUnchangedRecompute() const
+{
+    // the content of an external file may change without any notification
+    std::vector<Property*> props;
+    getPropertyList(props);
+    for(auto prop : props) {
+        if(prop->isDerivedFrom(PropertyFile::getClassTypeId()))
+            return false;
+    }
+    return true;
+}
+
+std::size_t DocumentObject::getInputFingerprint() const
+{
+    auto hashProperties = [](const DocumentObject *obj, std::size_t &seed) {
+        std::vector<Property*> props;
+        obj->getPropertyList(props);
+        for(auto prop : props) {
+            // transient properties are not part of the saved state, e.g. _GroupTouched is
+            // touched on every recompute only to notify the view provider
+            if(prop->testStatus(Property::Transient)
+                    || (obj->getPropertyType(prop) & Prop_Transient))
+                continue;
+            boost::hash_combine(seed, prop->getRevision());
+        }
+    };
+
+    std::size_t seed = 0;
+    hashProperties(this, seed);
+    // the properties of the linked objects, e.g. their shapes, are the actual input
+    for(auto obj : getOutList()) {
+        boost::hash_combine(seed, obj->getID());
+        hashProperties(obj, seed);
+    }
+    return seed;
+}
+
 short DocumentObject::mustExecute() const
 {
     if (ExpressionEngine.isTouched())
@@ -333,6 +567,8 @@ const char* DocumentObject::detachFromDocument()
 {
     const std::string* name = pcNameInDocument;
     pcNameInDocument = nullptr;
+    if (_pDoc)
+        _pDoc->d->clearInListIndex();
     return name ? name->c_str() : nullptr;
 }
 
@@ -475,6 +711,12 @@ void DocumentObject::getInListEx(std::set<App::DocumentObject*> &inSet,
         return;
     }
 
+    if(_pDoc) {
+        _pDoc->d->inListIndex.getInList(this, inSet, inList);
+        return;
+    }
+
+    // an object outside of any document has no index
     std::stack<DocumentObject*> pendings;
     pendings.push(const_cast<DocumentObject*>(this));
     while(!pendings.empty()) {
@@ -556,7 +798,15 @@ bool _isInInListRecursive(const DocumentObject* act,
 
 bool DocumentObject::isInInListRecursive(DocumentObject *linkTo) const
 {
+#ifndef USE_OLD_DAG
+    if (this == linkTo)
+        return true;
+    if (_pDoc)
+        return _pDoc->d->inListIndex.contains(this, linkTo);
+    return getInListEx(true).count(linkTo) != 0;
+#else
     return this==linkTo || getInListEx(true).count(linkTo);
+#endif
 }
 
 bool DocumentObject::isInInList(DocumentObject *linkTo) const
@@ -623,12 +873,19 @@ bool DocumentObject::testIfLinkDAGCompatible(DocumentObject *linkTo) const
 
 bool DocumentObject::testIfLinkDAGCompatible(const std::vector<DocumentObject *> &linksTo) const
 {
+#ifndef USE_OLD_DAG
+    for(auto obj : linksTo)
+        if(isInInListRecursive(obj))
+            return false;
+    return true;
+#else
     auto inLists = getInListEx(true);
     inLists.emplace(const_cast<DocumentObject*>(this));
     for(auto obj : linksTo)
         if(inLists.count(obj))
             return false;
     return true;
+#endif
 }
 
 bool DocumentObject::testIfLinkDAGCompatible(PropertyLinkSubList &linksTo) const
@@ -1026,8 +1283,13 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     //do not use erase-remove idom, as this erases ALL entries that match. we only want to remove a
     //single one.
     auto it = std::find(_inList.begin(), _inList.end(), rmvObj);
-    if(it != _inList.end())
+    if(it != _inList.end()) {
         _inList.erase(it);
+        if(_pDoc) {
+            _pDoc->d->inListIndex.invalidate(this);
+            _pDoc->_updateDependency(this, rmvObj, false);
+        }
+    }
 #else
     (void)rmvObj;
 #endif
@@ -1041,6 +1303,10 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     //this removal would clear the object from the inlist, even though there may be other link properties 
     //from this object that link to us.
     _inList.push_back(newObj);
+    if(_pDoc) {
+        _pDoc->d->inListIndex.invalidate(this);
+        _pDoc->_updateDependency(this, newObj, true);
+    }
 #else
     (void)newObj;
 #endif //USE_OLD_DAG    
@@ -158,6 +158,17 @@ public:
     void enforceRecompute();
     /// Test if this document object must be recomputed
     bool mustRecompute() const;
+    /** Return a hash of the inputs of this document object
+     * It combines the revisions of all properties of this object and of the objects it links to.
+     * The document compares it with the hash taken after the last successful recompute to skip
+     * objects whose inputs didn't change.
+     */
+    std::size_t getInputFingerprint() const;
+    /** Test if a recompute may be skipped when the input fingerprint is unchanged
+     * Objects reading inputs that aren't properties, e.g. external files, must return false.
+     * The default implementation returns false if the object has a file name property.
+     */
+    virtual bool canSkipUnchangedRecompute() const;
     /// reset this document object touched
     void purgeTouched() {
         StatusBits.reset(ObjectStatus::Touch);
@@ -641,6 +652,9 @@ private:
     // unique identifier (among a document) of this object.
     long _Id{0};
 
+    // input fingerprint after the last successful recompute, accessed by App::Document
+    std::size_t _recomputeFingerprint{0};
+
 private:
     // Back pointer to all the fathers in a DAG of the document
     // this is used by the document (via friend) to have a effective DAG handling
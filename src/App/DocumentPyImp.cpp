@@ -773,6 +773,11 @@ Py::Int DocumentPy::getRedoCount() const
     return Py::Int((long)getDocumentPtr()->getAvailableRedos());
 }
 
+Py::Int DocumentPy::getSkippedRecomputes() const
+{
+    return Py::Int((long)getDocumentPtr()->getSkippedRecomputeCount());
+}
+
 Py::List DocumentPy::getUndoNames() const
 {
     std::vector<std::string> vList = getDocumentPtr()->getAvailableUndoNames();
@@ -795,6 +800,28 @@ Py::List DocumentPy::getRedoNames() const
     return res;
 }
 
+Py::List DocumentPy::getUndoMemSizes() const
+{
+    std::vector<unsigned int> vList = getDocumentPtr()->getAvailableUndoMemSizes();
+    Py::List res;
+
+    for (auto It : vList)
+        res.append(Py::Int((long)It));
+
+    return res;
+}
+
+Py::List DocumentPy::getRedoMemSizes() const
+{
+    std::vector<unsigned int> vList = getDocumentPtr()->getAvailableRedoMemSizes();
+    Py::List res;
+
+    for (auto It : vList)
+        res.append(Py::Int((long)It));
+
+    return res;
+}
+
 Py::String  DocumentPy::getDependencyGraph() const
 {
     std::stringstream out;
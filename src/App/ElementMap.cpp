@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -11,6 +12,7 @@
 
 #include "App/Application.h"
 #include "Base/Console.h"
+#include "Base/Stream.h"
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -70,6 +72,22 @@ ElementMap::ElementMap()
     init();
 }
 
+std::size_t ElementMap::MappedNameHash::operator()(const MappedName& name) const
+{
+    // FNV-1a over the data and then the postfix. It is fed one byte at a time, so equal names get
+    // the same hash however their bytes are split between data and postfix.
+    uint64_t hash = 14695981039346656037ULL;
+    auto feed = [&hash](const QByteArray& bytes) {
+        for (char byte : bytes) {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 1099511628211ULL;
+        }
+    };
+    feed(name.dataBytes());
+    feed(name.postfixBytes());
+    return static_cast<std::size_t>(hash);
+}
+
 
 void ElementMap::beforeSave(const ::App::StringHasherRef& hasherRef) const
 {
@@ -155,7 +173,8 @@ void ElementMap::save(std::ostream& stream, int index,
                 prefixID.id = 0;
                 IndexedName idx(ref->name.dataBytes());
                 bool printName = true;
-                if (idx) {
+                // only use the compact form if it gives back exactly the same bytes
+                if (idx && MappedName(idx).dataBytes() == ref->name.dataBytes()) {
                     auto key = QByteArray::fromRawData(idx.getType(),
                                                        static_cast<int>(qstrlen(idx.getType())));
                     auto it = postfixMap.find(key);
@@ -435,6 +454,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
                     }
                     else {
                         ref->name += postfixes[postfixIndex - 1];
+                        internPostfix(ref->name);
                     }
                 }
 
@@ -490,6 +510,338 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
     return shared_from_this();
 }
 
+namespace
+{
+
+void writeBytes(Base::OutputStream& str, std::ostream& stream, const QByteArray& bytes)
+{
+    str << static_cast<uint32_t>(bytes.size());
+    stream.write(bytes.constData(), bytes.size());
+}
+
+QByteArray readBytes(Base::InputStream& str, std::istream& stream)
+{
+    uint32_t size = 0;
+    str >> size;
+    if (!stream) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map name");// NOLINT
+    }
+    QByteArray bytes(static_cast<int>(size), Qt::Uninitialized);
+    if (!stream.read(bytes.data(), size)) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map name");// NOLINT
+    }
+    return bytes;
+}
+
+// How a mapped name is stored in the binary element map
+enum class BinaryNameKind : uint8_t
+{
+    Raw = 0,    // the name bytes follow
+    Indexed = 1,// index of the element type in the postfix table, and the element index
+};
+
+}// namespace
+
+void ElementMap::saveBinary(std::ostream& stream, int index,
+                            const std::map<const ElementMap*, int>& childMapSet,
+                            const std::map<QByteArray, int>& postfixMap) const
+{
+    Base::OutputStream str(stream);
+    str << static_cast<int32_t>(index) << static_cast<uint32_t>(this->_id)
+        << static_cast<uint32_t>(this->indexedNames.size());
+
+    for (auto& indexedName : this->indexedNames) {
+        writeBytes(str, stream, QByteArray(indexedName.first));
+
+        str << static_cast<uint32_t>(indexedName.second.children.size());
+        for (auto& vv : indexedName.second.children) {
+            auto& child = vv.second;
+            int mapIndex = 0;
+            if (child.elementMap) {
+                auto it = childMapSet.find(child.elementMap.get());
+                if (it == childMapSet.end() || it->second == 0) {
+                    FC_ERR("Invalid child element map");// NOLINT
+                }
+                else {
+                    mapIndex = it->second;
+                }
+            }
+            str << static_cast<int32_t>(child.indexedName.getIndex())
+                << static_cast<int32_t>(child.offset) << static_cast<int32_t>(child.count)
+                << static_cast<int64_t>(child.tag) << static_cast<int32_t>(mapIndex);
+            writeBytes(str, stream, child.postfix);
+            uint32_t sidCount = 0;
+            for (auto& sid : child.sids) {
+                if (sid.isMarked()) {
+                    ++sidCount;
+                }
+            }
+            str << sidCount;
+            for (auto& sid : child.sids) {
+                if (sid.isMarked()) {
+                    str << static_cast<int64_t>(sid.value());
+                }
+            }
+        }
+
+        str << static_cast<uint32_t>(indexedName.second.names.size());
+        for (auto& dequeueOfMappedNameRef : indexedName.second.names) {
+            uint32_t nameCount = 0;
+            for (auto ref = &dequeueOfMappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                ++nameCount;
+            }
+            str << nameCount;
+            for (auto ref = &dequeueOfMappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                IndexedName idx(ref->name.dataBytes());
+                auto it = postfixMap.end();
+                // only use the compact form if it gives back exactly the same bytes
+                if (idx && MappedName(idx).dataBytes() == ref->name.dataBytes()) {
+                    auto key = QByteArray::fromRawData(idx.getType(),
+                                                       static_cast<int>(qstrlen(idx.getType())));
+                    it = postfixMap.find(key);
+                }
+                if (it != postfixMap.end()) {
+                    str << static_cast<uint8_t>(BinaryNameKind::Indexed)
+                        << static_cast<uint32_t>(it->second)
+                        << static_cast<int32_t>(idx.getIndex());
+                }
+                else {
+                    str << static_cast<uint8_t>(BinaryNameKind::Raw);
+                    writeBytes(str, stream, ref->name.dataBytes());
+                }
+
+                const QByteArray& postfix = ref->name.postfixBytes();
+                uint32_t postfixIndex = 0;
+                if (!postfix.isEmpty()) {
+                    auto postfixIt = postfixMap.find(postfix);
+                    assert(postfixIt != postfixMap.end());
+                    postfixIndex = static_cast<uint32_t>(postfixIt->second);
+                }
+                str << postfixIndex;
+
+                uint32_t sidCount = 0;
+                for (auto& sid : ref->sids) {
+                    if (sid.isMarked()) {
+                        ++sidCount;
+                    }
+                }
+                str << sidCount;
+                for (auto& sid : ref->sids) {
+                    if (sid.isMarked()) {
+                        str << static_cast<int64_t>(sid.value());
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ElementMap::saveBinary(std::ostream& stream) const
+{
+    std::map<const ElementMap*, int> childMapSet;
+    std::vector<const ElementMap*> childMaps;
+    std::map<QByteArray, int> postfixMap;
+    std::vector<QByteArray> postfixes;
+
+    collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
+
+    Base::OutputStream str(stream);
+    str << static_cast<uint32_t>(this->_id) << static_cast<uint32_t>(postfixes.size());
+    for (auto& postfix : postfixes) {
+        writeBytes(str, stream, postfix);
+    }
+    int index = 0;
+    str << static_cast<uint32_t>(childMaps.size());
+    for (auto& elementMap : childMaps) {
+        elementMap->saveBinary(stream, ++index, childMapSet, postfixMap);
+    }
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream)
+{
+    const char* msg = "Invalid element map";
+
+    Base::InputStream str(stream);
+    uint32_t id = 0;
+    uint32_t count = 0;
+    str >> id >> count;
+    if (!stream) {
+        FC_THROWM(Base::RuntimeError, msg);// NOLINT
+    }
+
+    auto& map = _idToElementMap[id];
+    if (map) {
+        return map;
+    }
+
+    std::vector<QByteArray> postfixes;
+    postfixes.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        postfixes.push_back(readBytes(str, stream));
+    }
+
+    std::vector<ElementMapPtr> childMaps;
+    count = 0;
+    str >> count;
+    if (!stream || count == 0) {
+        FC_THROWM(Base::RuntimeError, msg);// NOLINT
+    }
+    childMaps.reserve(count - 1);
+    for (uint32_t i = 0; i < count - 1; ++i) {
+        childMaps.push_back(
+            std::make_shared<ElementMap>()->restoreBinary(hasherRef, stream, childMaps, postfixes));
+    }
+
+    return restoreBinary(hasherRef, stream, childMaps, postfixes);
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream,
+                                        std::vector<ElementMapPtr>& childMaps,
+                                        const std::vector<QByteArray>& postfixes)
+{
+    Base::InputStream str(stream);
+    int32_t index = 0;
+    uint32_t id = 0;
+    uint32_t typeCount = 0;
+    str >> index >> id >> typeCount;
+    if (!stream) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map");// NOLINT
+    }
+
+    // An element map already restored by another object is read, but not kept.
+    auto& map = _idToElementMap[id];
+    ElementMapPtr self = map ? std::make_shared<ElementMap>() : shared_from_this();
+
+    auto getSIDs = [&](ElementIDRefs& sids, const char*& warning) {
+        uint32_t sidCount = 0;
+        str >> sidCount;
+        if (!stream) {
+            FC_THROWM(Base::RuntimeError, "Invalid element map string id");// NOLINT
+        }
+        sids.reserve(static_cast<int>(sidCount));
+        for (uint32_t k = 0; k < sidCount; ++k) {
+            int64_t readID = 0;
+            str >> readID;
+            if (!hasherRef) {
+                warning = "No hasherRef";
+                continue;
+            }
+            auto sid = hasherRef->getID(static_cast<long>(readID));
+            if (!sid) {
+                warning = "Invalid element name string id";
+            }
+            else {
+                sids.push_back(sid);
+            }
+        }
+    };
+
+    const char* hasherWarn = nullptr;
+    const char* postfixWarn = nullptr;
+
+    for (uint32_t i = 0; i < typeCount; ++i) {
+        QByteArray type = readBytes(str, stream);
+        IndexedName idx(type.constData(), 1);
+        auto& indices = self->indexedNames[idx.getType()];
+
+        uint32_t childCount = 0;
+        str >> childCount;
+        for (uint32_t j = 0; j < childCount; ++j) {
+            int32_t cIndex = 0;
+            int32_t offset = 0;
+            int32_t count = 0;
+            int64_t tag = 0;
+            int32_t mapIndex = 0;
+            str >> cIndex >> offset >> count >> tag >> mapIndex;
+            if (!stream) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child");// NOLINT
+            }
+            if (cIndex < 0 || offset < 0) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child index");// NOLINT
+            }
+            if (mapIndex >= index || mapIndex < 0 || mapIndex > (int)childMaps.size()) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child map index");// NOLINT
+            }
+            auto& child = indices.children[cIndex + offset + count];
+            child.indexedName = IndexedName::fromConst(idx.getType(), cIndex);
+            child.offset = offset;
+            child.count = count;
+            child.tag = static_cast<long>(tag);
+            child.elementMap = mapIndex > 0 ? childMaps[mapIndex - 1] : nullptr;
+            child.postfix = readBytes(str, stream);
+            self->childElements[child.postfix].childMap = &child;
+            self->childElementSize += child.count;
+            getSIDs(child.sids, hasherWarn);
+        }
+
+        uint32_t outerCount = 0;
+        str >> outerCount;
+        if (!stream) {
+            FC_THROWM(Base::RuntimeError, "missing element name count");// NOLINT
+        }
+        indices.names.resize(outerCount);
+        for (uint32_t j = 0; j < outerCount; ++j) {
+            idx.setIndex(static_cast<int>(j));
+            auto* ref = &indices.names[j];
+            uint32_t innerCount = 0;
+            str >> innerCount;
+            for (uint32_t k = 0; k < innerCount; ++k) {
+                if (k != 0) {
+                    ref->next = std::make_unique<MappedNameRef>();
+                    ref = ref->next.get();
+                }
+                uint8_t kind = 0;
+                str >> kind;
+                if (kind == static_cast<uint8_t>(BinaryNameKind::Indexed)) {
+                    uint32_t typeIndex = 0;
+                    int32_t elementIndex = 0;
+                    str >> typeIndex >> elementIndex;
+                    if (typeIndex == 0 || typeIndex > postfixes.size()) {
+                        FC_THROWM(Base::RuntimeError, "Invalid element name index");// NOLINT
+                    }
+                    ref->name = MappedName(IndexedName(postfixes[typeIndex - 1].constData(),
+                                                       static_cast<int>(elementIndex)));
+                }
+                else if (kind == static_cast<uint8_t>(BinaryNameKind::Raw)) {
+                    QByteArray bytes = readBytes(str, stream);
+                    ref->name.append(bytes.constData(), bytes.size());
+                }
+                else {
+                    FC_THROWM(Base::RuntimeError, "Invalid element name marker");// NOLINT
+                }
+
+                uint32_t postfixIndex = 0;
+                str >> postfixIndex;
+                if (postfixIndex != 0) {
+                    if (postfixIndex > postfixes.size()) {
+                        postfixWarn = "Invalid element postfix index";
+                    }
+                    else {
+                        ref->name += postfixes[postfixIndex - 1];
+                        self->internPostfix(ref->name);
+                    }
+                }
+                self->mappedNames.emplace(ref->name, idx);
+                getSIDs(ref->sids, hasherWarn);
+            }
+            if (!stream) {
+                FC_THROWM(Base::RuntimeError, "Failed to read element name");// NOLINT
+            }
+        }
+    }
+    if (hasherWarn) {
+        FC_WARN(hasherWarn);// NOLINT
+    }
+    if (postfixWarn) {
+        FC_WARN(postfixWarn);// NOLINT
+    }
+
+    if (!map) {
+        map = self;
+    }
+    return map;
+}
+
 MappedName ElementMap::addName(MappedName& name, const IndexedName& idx, const ElementIDRefs& sids,
                                bool overwrite, IndexedName* existing)
 {
@@ -498,6 +850,7 @@ MappedName ElementMap::addName(MappedName& name, const IndexedName& idx, const E
             FC_ERR("missing tag postfix " << name);// NOLINT
         }
     }
+    internPostfix(name);
     while (true) {
         if (overwrite) {
             erase(idx);
@@ -524,6 +877,24 @@ MappedName ElementMap::addName(MappedName& name, const IndexedName& idx, const E
     };
 }
 
+void ElementMap::internPostfix(MappedName& name)
+{
+    const QByteArray& postfix = name.postfixBytes();
+    if (postfix.isEmpty()) {
+        return;
+    }
+    auto it = postfixPool.constFind(postfix);
+    if (it == postfixPool.constEnd()) {
+        postfixPool.insert(postfix);
+        return;
+    }
+    if (it->constData() != postfix.constData()) {
+        MappedName interned(name, 0, name.dataBytes().size());
+        interned += *it;
+        name = interned;
+    }
+}
+
 void ElementMap::addPostfix(const QByteArray& postfix, std::map<QByteArray, int>& postfixMap,
                             std::vector<QByteArray>& postfixes)
 {
@@ -1038,8 +1409,14 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // Walk the names by element rather than through the (unordered) name lookup, to keep the
+    // postfix numbering, and thus the saved map, stable.
+    for (auto& indexedName : this->indexedNames) {
+        for (const MappedNameRef& mappedName : indexedName.second.names) {
+            for (const MappedNameRef* ref = &mappedName; ref; ref = ref->next.get()) {
+                addPostfix(ref->name.postfixBytes(), postfixMap, postfixes);
+            }
+        }
     }
 
     childMaps.push_back(this);
@@ -1262,6 +1639,10 @@ std::vector<MappedElement> ElementMap::getAll() const
     for (auto& mappedName : this->mappedNames) {
         ret.emplace_back(mappedName.first, mappedName.second);
     }
+    // the name lookup is unordered, return the names sorted as before
+    std::sort(ret.begin(), ret.end(), [](const MappedElement& left, const MappedElement& right) {
+        return left.name < right.name;
+    });
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
@@ -37,6 +37,9 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <unordered_map>
+
+#include <QSet>
 
 
 namespace Data
@@ -85,6 +88,18 @@ public:
     */
     ElementMapPtr restore(::App::StringHasherRef hasherRef, std::istream& stream);
 
+    /** Serialize this map in binary form. The layout is the same as the one of \c save, but
+     * numbers and names are written as binary values, so that no parsing is needed on restore.
+     * @param stream: serialized stream
+    */
+    void saveBinary(std::ostream& stream) const;
+
+    /** Deserialize and restore this map from the binary form written by \c saveBinary.
+     * @param hasherRef: where all the StringIDs are stored
+     * @param stream: stream to deserialize
+    */
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream);
+
 
     /** Add a sub-element name mapping.
      *
@@ -204,6 +219,16 @@ private:
                           std::vector<ElementMapPtr>& childMaps,
                           const std::vector<std::string>& postfixes);
 
+    /// Binary counterpart of the private \c save
+    void saveBinary(std::ostream& stream, int index,
+                    const std::map<const ElementMap*, int>& childMapSet,
+                    const std::map<QByteArray, int>& postfixMap) const;
+
+    /// Binary counterpart of the private \c restore
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream,
+                                std::vector<ElementMapPtr>& childMaps,
+                                const std::vector<QByteArray>& postfixes);
+
     /** Associate the MappedName \c name with the IndexedName \c idx.
      * @param name: the name to add
      * @param idx: the indexed name that \c name will be bound to
@@ -216,6 +241,11 @@ private:
     MappedName addName(MappedName& name, const IndexedName& idx, const ElementIDRefs& sids,
                        bool overwrite, IndexedName* existing);
 
+    /** Make the postfix of \c name share its storage with an equal postfix already used in
+     * this map. Most names of a map are built with the same few postfixes.
+     */
+    void internPostfix(MappedName& name);
+
     /** Utility function that adds \c postfix to \c postfixMap, and to \c postfixes
      * if it was not present in the map.
     */
@@ -267,7 +297,16 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    /// Hash of the concatenated data and postfix, consistent with MappedName::operator==
+    struct MappedNameHash
+    {
+        std::size_t operator()(const MappedName& name) const;
+    };
+
+    std::unordered_map<MappedName, IndexedName, MappedNameHash> mappedNames;
+
+    /// Postfixes used by the names of this map, see \c internPostfix
+    QSet<QByteArray> postfixPool;
 
     struct ChildMapInfo
     {
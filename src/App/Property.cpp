@@ -55,6 +55,7 @@ static std::atomic<int64_t> _PropID;
 // Here is the implementation! Description should take place in the header file!
 Property::Property()
   : _id(++_PropID)
+  , _revision(_id)
 {
 }
 
@@ -211,6 +212,7 @@ void Property::destroy(Property *p) {
 void Property::touch()
 {
     PropertyCleaner guard(this);
+    _revision = ++_PropID;
     if (father)
         father->onChanged(this);
     StatusBits.set(Touched);
@@ -223,6 +225,7 @@ void Property::setReadOnly(bool readOnly)
 
 void Property::hasSetValue()
 {
+    _revision = ++_PropID;
     PropertyCleaner guard(this);
     if (father) {
         father->onChanged(this);
@@ -117,6 +117,15 @@ public:
         return sizeof(father) + sizeof(StatusBits);
     }
 
+    /** Get the size of the memory used by this property alone
+     * Unlike getMemSize() it doesn't count data that is shared with other
+     * properties, e.g. the copy-on-write value saved for undo. By default
+     * it's the same as getMemSize().
+     */
+    virtual unsigned int getUnsharedMemSize () const {
+        return getMemSize();
+    }
+
     /** Get the name of this property in the belonging container
      * With \ref hasName() it can be checked beforehand if a valid name is set.
      * @note If no name is set this function returns an empty string, i.e. "".
@@ -251,6 +260,15 @@ public:
     /// Compare if this property has the same content as the given one
     virtual bool isSame(const Property &other) const;
 
+    /** Return the revision of the property content
+     *
+     * The revision is drawn from the same counter as the ID each time the
+     * property is changed or touched, so two revisions are only equal if
+     * the content wasn't changed in between. Setting the same value again
+     * still counts as a change.
+     */
+    int64_t getRevision() const {return _revision;}
+
     /** Return a unique ID for the property
      *
      * The ID of a property is generated from a monotonically increasing
@@ -301,6 +319,7 @@ private:
     PropertyContainer *father{nullptr};
     const char *myName{nullptr};
     int64_t _id;
+    int64_t _revision;
 
 public:
     boost::signals2::signal<void (const App::Property&)> signalChanged;
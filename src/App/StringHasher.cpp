@@ -24,7 +24,14 @@
 
 #include <QCryptographicHash>
 #include <QHash>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -33,9 +40,7 @@
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
-#include <boost/bimap.hpp>
-#include <boost/bimap/set_of.hpp>
-#include <boost/bimap/unordered_set_of.hpp>
+#include <boost/io/ios_state.hpp>
 #include <boost/iostreams/stream.hpp>
 
 #include "MappedElement.h"
@@ -73,13 +78,183 @@ struct StringIDHasher
     }
 };
 
-using HashMapBase =
-    boost::bimap<boost::bimaps::unordered_set_of<StringID*, StringIDHasher, StringIDHasher>,
-                 boost::bimaps::set_of<long>>;
-
-class StringHasher::HashMap: public HashMapBase
+/** Sharded bidirectional map of StringID and its integer ID
+ *
+ * A StringID is stored in the content shard selected by the hash of its data, and in the ID shard
+ * selected by its integer ID. Each shard has its own read-write lock, so that lookups only block
+ * the (rare) insertion into the same shard. When both are needed, the content shard is always
+ * locked before the ID shard.
+ */
+class StringHasher::HashMap
 {
 public:
+    static constexpr std::size_t ShardCount = 32;
+
+    using ReadLock = std::shared_lock<std::shared_mutex>;
+    using WriteLock = std::unique_lock<std::shared_mutex>;
+
+    struct ContentShard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_set<StringID*, StringIDHasher, StringIDHasher> ids;
+    };
+
+    struct IDShard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<long, StringID*> ids;
+    };
+
+    ContentShard& contentShard(const StringID* sid)
+    {
+        std::size_t hash = StringIDHasher()(sid);
+        return contentShards[(hash ^ (hash >> 16)) % ShardCount];
+    }
+
+    IDShard& idShard(long id)
+    {
+        return idShards[static_cast<std::size_t>(id) % ShardCount];
+    }
+
+    const IDShard& idShard(long id) const
+    {
+        return idShards[static_cast<std::size_t>(id) % ShardCount];
+    }
+
+    /// Returns the stored StringID with the same content as \c key, or null
+    StringIDRef find(const StringID* key)
+    {
+        auto& shard = contentShard(key);
+        ReadLock lock(shard.mutex);
+        auto it = shard.ids.find(const_cast<StringID*>(key));// NOLINT
+        if (it == shard.ids.end()) {
+            return {};
+        }
+        return {*it};
+    }
+
+    /// Returns the stored StringID with the given integer ID, or null
+    StringIDRef find(long id) const
+    {
+        auto& shard = idShard(id);
+        ReadLock lock(shard.mutex);
+        auto it = shard.ids.find(id);
+        if (it == shard.ids.end()) {
+            return {};
+        }
+        return {it->second};
+    }
+
+    /** Insert a StringID not owned by any hasher, unless there is already one with the same content
+     * or integer ID. A StringID with a zero ID gets the next free one.
+     * @return The inserted StringID, or the one already stored.
+     */
+    StringID* insert(StringID* sid)
+    {
+        auto& cShard = contentShard(sid);
+        WriteLock contentLock(cShard.mutex);
+        auto it = cShard.ids.find(sid);
+        if (it != cShard.ids.end()) {
+            return *it;
+        }
+        if (sid->_id == 0) {
+            sid->_id = ++LastID;
+        }
+        else {
+            long last = LastID.load();
+            while (last < sid->_id && !LastID.compare_exchange_weak(last, sid->_id)) {}
+        }
+        auto& iShard = idShard(sid->_id);
+        WriteLock idLock(iShard.mutex);
+        auto res = iShard.ids.emplace(sid->_id, sid);
+        if (!res.second) {
+            return res.first->second;
+        }
+        cShard.ids.insert(sid);
+        return sid;
+    }
+
+    /// Remove \c sid from the table, returns true if it was found
+    bool erase(StringID* sid)
+    {
+        auto& cShard = contentShard(sid);
+        WriteLock contentLock(cShard.mutex);
+        auto& iShard = idShard(sid->_id);
+        WriteLock idLock(iShard.mutex);
+        auto it = iShard.ids.find(sid->_id);
+        if (it == iShard.ids.end() || it->second != sid) {
+            return false;
+        }
+        iShard.ids.erase(it);
+        cShard.ids.erase(sid);
+        return true;
+    }
+
+    /// Returns all the stored StringID ordered by their integer ID
+    std::vector<StringID*> sorted() const
+    {
+        std::vector<StringID*> res;
+        for (auto& shard : idShards) {
+            ReadLock lock(shard.mutex);
+            for (auto& entry : shard.ids) {
+                res.push_back(entry.second);
+            }
+        }
+        std::sort(res.begin(), res.end(), [](const StringID* left, const StringID* right) {
+            return left->_id < right->_id;
+        });
+        return res;
+    }
+
+    /// Call \c func for each stored StringID, in no particular order
+    template<typename Func>
+    void forEach(Func func) const
+    {
+        for (auto& shard : idShards) {
+            ReadLock lock(shard.mutex);
+            for (auto& entry : shard.ids) {
+                func(entry.second);
+            }
+        }
+    }
+
+    std::size_t size() const
+    {
+        std::size_t res = 0;
+        for (auto& shard : idShards) {
+            ReadLock lock(shard.mutex);
+            res += shard.ids.size();
+        }
+        return res;
+    }
+
+    /// Reset the highest integer ID to the one of the remaining entries
+    void resetLastID()
+    {
+        long last = 0;
+        forEach([&last](const StringID* sid) {
+            last = std::max(last, sid->_id);
+        });
+        LastID = last;
+    }
+
+    /// Remove all entries, without releasing them
+    void clear()
+    {
+        for (auto& shard : contentShards) {
+            WriteLock lock(shard.mutex);
+            shard.ids.clear();
+        }
+        for (auto& shard : idShards) {
+            WriteLock lock(shard.mutex);
+            shard.ids.clear();
+        }
+        LastID = 0;
+    }
+
+    std::array<ContentShard, ShardCount> contentShards;
+    std::array<IDShard, ShardCount> idShards;
+    std::atomic<long> LastID {0};
     bool SaveAll = false;
     int Threshold = 0;
 };
@@ -91,7 +266,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
 StringID::~StringID()
 {
     if (_hasher) {
-        _hasher->_hashes->right.erase(_id);
+        _hasher->_hashes->erase(this);
     }
 }
 
@@ -198,9 +373,9 @@ void StringHasher::compact()
     // Make a list of all the table entries that have only a single reference and are not marked
     // "persistent"
     std::deque<StringIDRef> pendings;
-    for (auto& hasher : _hashes->right) {
-        if (!hasher.second->isPersistent() && hasher.second->getRefCount() == 1) {
-            pendings.emplace_back(hasher.second);
+    for (auto hasher : _hashes->sorted()) {
+        if (!hasher->isPersistent() && hasher->getRefCount() == 1) {
+            pendings.emplace_back(hasher);
         }
     }
 
@@ -209,7 +384,7 @@ void StringHasher::compact()
         StringIDRef sid = pendings.front();
         pendings.pop_front();
         // Try to erase the map entry for this StringID
-        if (_hashes->right.erase(sid.value()) == 0U) {
+        if (!_hashes->erase(sid._sid)) {
             continue;// If nothing was erased, there's nothing more to do
         }
         sid._sid->_hasher = nullptr;
@@ -224,6 +399,7 @@ void StringHasher::compact()
             }
         }
     }
+    _hashes->resetLastID();
 }
 
 bool StringHasher::getSaveAll() const
@@ -243,12 +419,7 @@ int StringHasher::getThreshold() const
 
 long StringHasher::lastID() const
 {
-    if (_hashes->right.empty()) {
-        return 0;
-    }
-    auto it = _hashes->right.end();
-    --it;
-    return it->first;
+    return _hashes->LastID;
 }
 
 StringIDRef StringHasher::getID(const char* text, int len, bool hashable)
@@ -277,9 +448,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    if (auto existing = _hashes->find(&dataID)) {
+        return existing;
     }
 
     if (!hashed && !nocopy) {
@@ -294,7 +464,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
+    // The integer ID is assigned on insertion
+    StringIDRef sid(new StringID(0, dataID._data, flags));
     return {insert(sid)};
 }
 
@@ -321,9 +492,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
+    if (auto res = _hashes->find(&tempID)) {
         if (indexed) {
             res._index = indexed.getIndex();
         }
@@ -348,8 +517,8 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         indexRef = getID(tempID._data);
     }
 
-    // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    // The real StringID object that we are going to insert, its integer ID is assigned on insertion
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -437,12 +606,10 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
-    auto it = _hashes->right.find(id);
-    if (it == _hashes->right.end()) {
-        return {};
+    StringIDRef res = _hashes->find(id);
+    if (res) {
+        res._index = index;
     }
-    StringIDRef res(it->second);
-    res._index = index;
     return res;
 }
 
@@ -468,11 +635,11 @@ void StringHasher::Save(Base::Writer& writer) const
     }
     else {
         count = 0;
-        for (auto& hasher : _hashes->right) {
-            if (hasher.second->isMarked() || hasher.second->isPersistent()) {
+        _hashes->forEach([&count](const StringID* hasher) {
+            if (hasher->isMarked() || hasher->isPersistent()) {
                 ++count;
             }
-        }
+        });
     }
 
     writer.Stream() << writer.ind() << "<StringHasher saveall=\"" << _hashes->SaveAll
@@ -515,8 +682,8 @@ void StringHasher::saveStream(std::ostream& stream) const
     long lastID = 0;
     bool relative = false;
 
-    for (auto& hasher : _hashes->right) {
-        auto& d = *hasher.second;
+    for (auto hasher : _hashes->sorted()) {
+        auto& d = *hasher;
         long id = d._id;
         if (!_hashes->SaveAll && !d.isMarked() && !d.isPersistent()) {
             continue;
@@ -737,15 +904,15 @@ StringID* StringHasher::insert(const StringIDRef& sid)
 {
     assert(sid && sid._sid->_hasher == nullptr);
     auto& hasher = *sid._sid;
+    // Take the table reference before publishing the StringID to other threads
     hasher._hasher = this;
     hasher.ref();
-    auto res = _hashes->right.insert(_hashes->right.end(),
-                                     HashMap::right_map::value_type(sid.value(), &hasher));
-    if (res->second != &hasher) {
+    auto res = _hashes->insert(&hasher);
+    if (res != &hasher) {
         hasher._hasher = nullptr;
         hasher.unref();
     }
-    return res->second;
+    return res;
 }
 
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
@@ -769,10 +936,10 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 
 void StringHasher::clear()
 {
-    for (auto& hasher : _hashes->right) {
-        hasher.second->_hasher = nullptr;
-        hasher.second->unref();
-    }
+    _hashes->forEach([](StringID* hasher) {
+        hasher->_hasher = nullptr;
+        hasher->unref();
+    });
     _hashes->clear();
 }
 
@@ -784,11 +951,11 @@ size_t StringHasher::size() const
 size_t StringHasher::count() const
 {
     size_t count = 0;
-    for (auto& hasher : _hashes->right) {
-        if (hasher.second->getRefCount() > 1) {
+    _hashes->forEach([&count](const StringID* hasher) {
+        if (hasher->getRefCount() > 1) {
             ++count;
         }
-    }
+    });
     return count;
 }
 
@@ -855,15 +1022,15 @@ PyObject* StringHasher::getPyObject()
 std::map<long, StringIDRef> StringHasher::getIDMap() const
 {
     std::map<long, StringIDRef> ret;
-    for (auto& hasher : _hashes->right) {
-        ret.emplace_hint(ret.end(), hasher.first, StringIDRef(hasher.second));
+    for (auto hasher : _hashes->sorted()) {
+        ret.emplace_hint(ret.end(), hasher->_id, StringIDRef(hasher));
     }
     return ret;
 }
 
 void StringHasher::clearMarks() const
 {
-    for (auto& hasher : _hashes->right) {
-        hasher.second->_flags.setFlag(StringID::Flag::Marked, false);
-    }
+    _hashes->forEach([](const StringID* hasher) {
+        hasher->_flags.setFlag(StringID::Flag::Marked, false);
+    });
 }
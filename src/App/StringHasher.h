@@ -630,6 +630,11 @@ private:
 /// If the string is longer than a given threshold, instead of storing the string, its SHA1 hash is
 /// stored (and the original string discarded). This allows an upper threshold on the length of a
 /// stored string, while still effectively guaranteeing uniqueness in the table.
+///
+/// The table is split in shards, each one protected by its own read-write lock, so that the
+/// getID() functions can be called concurrently from several threads, e.g. by features computed in
+/// parallel. A StringID never moves once inserted, and keeps its integer ID for as long as it stays
+/// in the table. Persistence, clear() and compact() still expect exclusive access to the hasher.
 class AppExport StringHasher: public Base::Persistence, public Base::Handled
 {
 
@@ -778,7 +783,7 @@ protected:
     void restoreStreamNew(std::istream& stream, std::size_t count);
 
 private:
-    std::unique_ptr<HashMap> _hashes;///< Bidirectional map of StringID and its index (a long int).
+    std::unique_ptr<HashMap> _hashes;///< Sharded bidirectional map of StringID and its index.
     mutable std::string _filename;
 };
 }// namespace App
@@ -111,7 +111,11 @@ int Transaction::getLastID() {
 
 unsigned int Transaction::getMemSize () const
 {
-    return 0;
+    unsigned int size = 0;
+    for (const auto& info : _Objects) {
+        size += info.second->getMemSize();
+    }
+    return size;
 }
 
 void Transaction::Save (Base::Writer &/*writer*/) const
@@ -406,7 +410,14 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize () const
 {
-    return 0;
+    // Only count the saved property values, as they are what makes a transaction heavy.
+    // Data still shared with the document or another transaction takes no extra memory.
+    unsigned int size = 0;
+    for (const auto& v : _PropChangeMap) {
+        if (v.second.property)
+            size += v.second.property->getUnsharedMemSize();
+    }
+    return size;
 }
 
 void TransactionObject::Save (Base::Writer &/*writer*/) const
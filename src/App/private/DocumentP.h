@@ -32,7 +32,10 @@
 #include <App/StringHasher.h>
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
+#include <boost/dynamic_bitset.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <mutex>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -57,6 +60,54 @@ namespace App {
 using HasherMap = boost::bimap<StringHasherRef, int>;
 class Transaction;
 
+#ifndef USE_OLD_DAG
+/** Index of the recursive InList of the objects of a document
+ *
+ * Every object that takes part in a query gets a dense ordinal so that the
+ * recursive InList can be kept as a bitset, and the bitset of an object is
+ * built as the union of the bitsets of its parents. The bitsets are computed
+ * on demand and kept until a link change affects them, i.e. a change of the
+ * InList of an object drops its own bitset and the bitsets of all objects
+ * depending on it. Bitsets that depend on objects of another document are
+ * not kept, as their link changes are tracked by the index of that document.
+ *
+ * The queries are const for the objects but build the index lazily, so all
+ * public functions are guarded by a mutex.
+ */
+class InListIndex
+{
+public:
+    using InListSet = boost::dynamic_bitset<>;
+
+    /// Returns whether \a parent is in the recursive InList of \a obj
+    bool contains(const DocumentObject* obj, const DocumentObject* parent);
+    /** Adds the recursive InList of \a obj to \a inSet
+     * The objects newly inserted into \a inSet are also appended to \a inList
+     * if given, sorted so that the furthest linking objects come last.
+     */
+    void getInList(const DocumentObject* obj,
+                   std::set<DocumentObject*>& inSet,
+                   std::vector<DocumentObject*>* inList);
+    /// Drops the bitsets affected by a change of the InList of \a obj
+    void invalidate(const DocumentObject* obj);
+    /// Drops the whole index, e.g. when objects are added or removed
+    void clear();
+
+private:
+    std::size_t ordinal(const DocumentObject* obj);
+    /// Returns the bitset of \a obj, must be called with the mutex locked
+    const InListSet& get(const DocumentObject* obj);
+
+private:
+    std::mutex mutex;
+    std::unordered_map<const DocumentObject*, std::size_t> ordinals;
+    std::vector<DocumentObject*> objects;
+    std::unordered_map<std::size_t, InListSet> sets;
+    /// result of the last query that could not be kept
+    InListSet uncached;
+};
+#endif //USE_OLD_DAG
+
 // Pimpl class
 struct DocumentP
 {
@@ -87,9 +138,20 @@ struct DocumentP
     DependencyList DepList;
     std::map<DocumentObject*, Vertex> VertexObjectList;
     std::map<Vertex, DocumentObject*> vertexMap;
+#else
+    InListIndex inListIndex;
 #endif //USE_OLD_DAG
     std::multimap<const App::DocumentObject*,
         std::unique_ptr<App::DocumentObjectExecReturn> > _RecomputeLog;
+    /// Topological order of the objects, an object comes after the objects it depends on
+    std::unordered_map<const App::DocumentObject*, long> topoOrder;
+    long topoOrderNext = 0;
+    /// Set if the dependencies are cyclic, cleared on the next removed link
+    bool topoOrderCyclic = false;
+    /// Set while recomputing if objects with unchanged inputs are skipped
+    bool skipUnchangedRecompute = false;
+    /// Number of object recomputes that were skipped
+    unsigned long skippedRecomputeCount = 0;
 
     StringHasherRef Hasher;
 
@@ -128,6 +190,8 @@ struct DocumentP
         }
         objectMap.clear();
         objectIdMap.clear();
+        clearTopologicalOrder();
+        clearInListIndex();
     }
 
     const char *findRecomputeLog(const App::DocumentObject *obj) {
@@ -144,6 +208,27 @@ struct DocumentP
     topologicalSort(const std::vector<App::DocumentObject*>& objects) const;
     std::vector<App::DocumentObject*>
     static partialTopologicalSort(const std::vector<App::DocumentObject*>& objects);
+
+    /// Update the topological order after \a obj started to depend on \a dep
+    void addToTopologicalOrder(const App::DocumentObject* dep, const App::DocumentObject* obj);
+    void clearInListIndex() {
+#ifndef USE_OLD_DAG
+        inListIndex.clear();
+#endif
+    }
+    void clearTopologicalOrder() {
+        topoOrder.clear();
+        topoOrderNext = 0;
+        topoOrderCyclic = false;
+    }
+    /** Sort the given objects of this document by the topological order
+     * @return false if the order is not available because of cyclic dependencies
+     */
+    bool sortByTopologicalOrder(std::vector<App::DocumentObject*>& objects);
+
+private:
+    bool rebuildTopologicalOrder();
+    bool checkTopologicalOrder(const std::vector<App::DocumentObject*>& objects) const;
 };
 
 } // namespace App
@@ -29,8 +29,13 @@
 #elif defined(FC_OS_LINUX) || defined(FC_OS_MACOSX)
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <condition_variable>
 #include <cstring>
 #include <functional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #endif
 
 #include "Console.h"
@@ -143,6 +148,237 @@ private:
 
 ConsoleOutput* ConsoleOutput::instance = nullptr;  // NOLINT
 
+/** Passes the messages sent in Async mode to the observers
+ *  The senders append the messages to a lock-free multi-producer queue (see
+ *  https://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue)
+ *  which is drained by a dedicated thread.
+ */
+class ConsoleDispatcher
+{
+public:
+    static ConsoleDispatcher* getInstance()
+    {
+        if (!instance) {
+            instance = new ConsoleDispatcher;
+        }
+        return instance;
+    }
+    static void destruct()
+    {
+        delete instance;
+        instance = nullptr;
+    }
+
+    void post(LogStyle category,
+              IntendedRecipient recipient,
+              ContentType content,
+              const std::string& notifier,
+              const std::string& msg)
+    {
+        auto node = new Node {{nullptr}, {category, recipient, content, notifier, msg}};
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+        posted.fetch_add(1, std::memory_order_release);
+        wakeUp.notify_one();
+    }
+
+    void flush()
+    {
+        // an observer must not wait for itself
+        if (std::this_thread::get_id() == thread.get_id()) {
+            return;
+        }
+        uint64_t target = posted.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeUp.notify_one();
+        done.wait(lock, [this, target]() {
+            return dispatched.load(std::memory_order_acquire) >= target;
+        });
+    }
+
+    ConsoleDispatcher(const ConsoleDispatcher&) = delete;
+    ConsoleDispatcher(ConsoleDispatcher&&) = delete;
+    ConsoleDispatcher& operator=(const ConsoleDispatcher&) = delete;
+    ConsoleDispatcher& operator=(ConsoleDispatcher&&) = delete;
+
+private:
+    struct Message
+    {
+        LogStyle category;
+        IntendedRecipient recipient;
+        ContentType content;
+        std::string notifier;
+        std::string msg;
+    };
+
+    struct Node
+    {
+        std::atomic<Node*> next;
+        Message message;
+    };
+
+    ConsoleDispatcher()
+        : head(new Node {{nullptr}, {}})
+        , tail(head.load())
+    {
+        thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    ~ConsoleDispatcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wakeUp.notify_one();
+        thread.join();
+        delete tail;
+    }
+
+    // only called by the dispatch thread
+    bool pop(Message& message)
+    {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        message = std::move(next->message);
+        delete tail;
+        tail = next;
+        return true;
+    }
+
+    bool empty() const
+    {
+        return !tail->next.load(std::memory_order_acquire);
+    }
+
+    void run()
+    {
+        Message message;
+        for (;;) {
+            bool any = false;
+            while (pop(message)) {
+                try {
+                    Console().notifyPrivate(message.category,
+                                            message.recipient,
+                                            message.content,
+                                            message.notifier,
+                                            message.msg);
+                }
+                catch (...) {
+                    // an observer must not stop the dispatching
+                }
+                dispatched.fetch_add(1, std::memory_order_release);
+                any = true;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            if (any) {
+                done.notify_all();
+            }
+            if (stop && empty()) {
+                break;
+            }
+            // the senders don't take the lock, so don't rely on the notification only
+            wakeUp.wait_for(lock, std::chrono::milliseconds(20), [this]() {
+                return stop || !empty();
+            });
+        }
+    }
+
+    std::atomic<Node*> head;
+    Node* tail;
+    std::atomic<uint64_t> posted {0};
+    std::atomic<uint64_t> dispatched {0};
+    bool stop {false};
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable done;
+    std::thread thread;
+
+    static ConsoleDispatcher* instance;  // NOLINT
+};
+
+ConsoleDispatcher* ConsoleDispatcher::instance = nullptr;  // NOLINT
+
+/** Drops identical warnings that are sent too often
+ */
+class ConsoleRateLimiter
+{
+public:
+    ConsoleRateLimiter(unsigned int maxRepeats, std::chrono::milliseconds interval)
+        : maxRepeats(maxRepeats)
+        , interval(interval)
+    {}
+
+    /** Returns false if the message must be dropped. If identical messages have
+     *  been dropped before \a report is set to a message telling how many.
+     */
+    bool accept(const std::string& notifier, const std::string& msg, std::string& report)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto now = std::chrono::steady_clock::now();
+        std::string key = notifier;
+        key += '\0';
+        key += msg;
+
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            prune(now);
+            entries.emplace(std::move(key), Entry {now, 1, 0});
+            return true;
+        }
+
+        Entry& entry = it->second;
+        if (now - entry.start >= interval) {
+            if (entry.dropped > 0) {
+                report = fmt::sprintf("The following warning was suppressed %u times\n",
+                                      entry.dropped);
+            }
+            entry = Entry {now, 1, 0};
+            return true;
+        }
+        if (entry.count < maxRepeats) {
+            entry.count++;
+            return true;
+        }
+        entry.dropped++;
+        return false;
+    }
+
+private:
+    struct Entry
+    {
+        std::chrono::steady_clock::time_point start;
+        unsigned int count;
+        unsigned int dropped;
+    };
+
+    void prune(std::chrono::steady_clock::time_point now)
+    {
+        const std::size_t maxEntries = 1000;
+        if (entries.size() < maxEntries) {
+            return;
+        }
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (now - it->second.start >= interval) {
+                it = entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    unsigned int maxRepeats;
+    std::chrono::milliseconds interval;
+    std::unordered_map<std::string, Entry> entries;
+    std::mutex mutex;
+};
+
 }  // namespace Base
 
 //**************************************************************************
@@ -159,8 +395,12 @@ ConsoleSingleton::ConsoleSingleton()
 
 ConsoleSingleton::~ConsoleSingleton()
 {
+    ConsoleDispatcher::destruct();
     ConsoleOutput::destruct();
-    for (ILogger* Iter : _aclObservers) {
+    // an observer may still send messages or detach itself while it is destructed
+    std::shared_ptr<const ObserverList> observers = getObservers();
+    _aclObservers = std::make_shared<const ObserverList>();
+    for (ILogger* Iter : *observers) {
         delete Iter;
     }
 }
@@ -283,12 +523,44 @@ bool ConsoleSingleton::IsMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType
 
 void ConsoleSingleton::SetConnectionMode(ConnectionMode mode)
 {
-    connectionMode = mode;
-
     // make sure this method gets called from the main thread
-    if (connectionMode == Queued) {
+    if (mode == Queued) {
         ConsoleOutput::getInstance();
     }
+    // the dispatcher must exist before any thread sees the Async mode
+    else if (mode == Async) {
+        ConsoleDispatcher::getInstance();
+    }
+
+    ConnectionMode oldMode = connectionMode.exchange(mode);
+
+    // pass the pending messages before they get out of order
+    if (oldMode == Async && mode != Async) {
+        ConsoleDispatcher::getInstance()->flush();
+    }
+}
+
+void ConsoleSingleton::Flush()
+{
+    if (connectionMode == Async) {
+        ConsoleDispatcher::getInstance()->flush();
+    }
+}
+
+void ConsoleSingleton::SetRateLimit(unsigned int maxRepeats, std::chrono::milliseconds interval)
+{
+    std::shared_ptr<ConsoleRateLimiter> limiter;
+    if (maxRepeats > 0) {
+        limiter = std::make_shared<ConsoleRateLimiter>(maxRepeats, interval);
+    }
+    std::lock_guard<std::mutex> lock(_observerMutex);
+    _rateLimiter.swap(limiter);
+}
+
+std::shared_ptr<ConsoleRateLimiter> ConsoleSingleton::getRateLimiter() const
+{
+    std::lock_guard<std::mutex> lock(_observerMutex);
+    return _rateLimiter;
 }
 
 //**************************************************************************
@@ -302,20 +574,78 @@ void ConsoleSingleton::SetConnectionMode(ConnectionMode mode)
  */
 void ConsoleSingleton::AttachObserver(ILogger* pcObserver)
 {
+    std::lock_guard<std::mutex> lock(_observerMutex);
+
     // double insert !!
-    assert(_aclObservers.find(pcObserver) == _aclObservers.end());
+    assert(std::find(_aclObservers->begin(), _aclObservers->end(), pcObserver)
+           == _aclObservers->end());
 
-    _aclObservers.insert(pcObserver);
+    auto observers = std::make_shared<ObserverList>(*_aclObservers);
+    observers->push_back(pcObserver);
+    _aclObservers = observers;
+    updateActiveCategories();
 }
 
 /** Detaches an Observer from Console
  *  Use this method to detach a ILogger derived class.
- *  After detaching you can destruct the Observer or reinsert it later.
+ *  After detaching you can destruct the Observer or reinsert it later. A message that another
+ *  thread is passing to the observers at the same time may still reach it.
  *  @see ILogger
  */
 void ConsoleSingleton::DetachObserver(ILogger* pcObserver)
 {
-    _aclObservers.erase(pcObserver);
+    std::lock_guard<std::mutex> lock(_observerMutex);
+    auto observers = std::make_shared<ObserverList>(*_aclObservers);
+    observers->erase(std::remove(observers->begin(), observers->end(), pcObserver),
+                     observers->end());
+    _aclObservers = observers;
+    updateActiveCategories();
+}
+
+std::shared_ptr<const ConsoleSingleton::ObserverList> ConsoleSingleton::getObservers() const
+{
+    std::lock_guard<std::mutex> lock(_observerMutex);
+    return _aclObservers;
+}
+
+// must be called with _observerMutex locked
+void ConsoleSingleton::updateActiveCategories()
+{
+    const std::array<LogStyle, 6> categories {LogStyle::Warning,
+                                              LogStyle::Message,
+                                              LogStyle::Error,
+                                              LogStyle::Log,
+                                              LogStyle::Critical,
+                                              LogStyle::Notification};
+    unsigned int active = 0;
+    for (LogStyle category : categories) {
+        for (ILogger* obs : *_aclObservers) {
+            if (obs->isActive(category)) {
+                active |= 1U << static_cast<unsigned int>(category);
+                break;
+            }
+        }
+    }
+    _activeCategories.store(active, std::memory_order_relaxed);
+}
+
+bool ConsoleSingleton::IsActive(LogStyle category) const
+{
+    unsigned int active = _activeCategories.load(std::memory_order_relaxed);
+    return (active & (1U << static_cast<unsigned int>(category))) != 0;
+}
+
+LoggerFlag& LoggerFlag::operator=(bool value)
+{
+    if (on.exchange(value, std::memory_order_relaxed) != value) {
+        // the flag may belong to an attached observer
+        ConsoleSingleton* console = ConsoleSingleton::_pcSingleton;
+        if (console) {
+            std::lock_guard<std::mutex> lock(console->_observerMutex);
+            console->updateActiveCategories();
+        }
+    }
+    return *this;
 }
 
 void Base::ConsoleSingleton::notifyPrivate(LogStyle category,
@@ -324,7 +654,32 @@ void Base::ConsoleSingleton::notifyPrivate(LogStyle category,
                                            const std::string& notifiername,
                                            const std::string& msg)
 {
-    for (ILogger* Iter : _aclObservers) {
+    std::shared_ptr<ConsoleRateLimiter> limiter;
+    if (category == LogStyle::Warning) {
+        limiter = getRateLimiter();
+    }
+    if (limiter) {
+        std::string report;
+        if (!limiter->accept(notifiername, msg, report)) {
+            return;
+        }
+        if (!report.empty()) {
+            notifyObservers(category, recipient, content, notifiername, report);
+        }
+    }
+    notifyObservers(category, recipient, content, notifiername, msg);
+}
+
+void ConsoleSingleton::notifyObservers(LogStyle category,
+                                       IntendedRecipient recipient,
+                                       ContentType content,
+                                       const std::string& notifiername,
+                                       const std::string& msg)
+{
+    // no lock is held while the observers are called, so an observer may attach or detach
+    // observers or send messages itself
+    std::shared_ptr<const ObserverList> observers = getObservers();
+    for (ILogger* Iter : *observers) {
         if (Iter->isActive(category)) {
             Iter->SendLog(notifiername,
                           msg,
@@ -345,10 +700,20 @@ void ConsoleSingleton::postEvent(ConsoleSingleton::FreeCAD_ConsoleMsgType type,
                                 new ConsoleEvent(type, recipient, content, notifiername, msg));
 }
 
+void ConsoleSingleton::postAsync(LogStyle category,
+                                 IntendedRecipient recipient,
+                                 ContentType content,
+                                 const std::string& notifiername,
+                                 const std::string& msg)
+{
+    ConsoleDispatcher::getInstance()->post(category, recipient, content, notifiername, msg);
+}
+
 ILogger* ConsoleSingleton::Get(const char* Name) const
 {
+    std::shared_ptr<const ObserverList> observers = getObservers();
     const char* OName {};
-    for (ILogger* Iter : _aclObservers) {
+    for (ILogger* Iter : *observers) {
         OName = Iter->Name();  // get the name
         if (OName && strcmp(OName, Name) == 0) {
             return Iter;
@@ -824,7 +1189,7 @@ PyObject* ConsoleSingleton::sPyGetObservers(PyObject* /*self*/, PyObject* args)
     PY_TRY
     {
         Py::List list;
-        for (auto i : Instance()._aclObservers) {
+        for (auto i : *Instance().getObservers()) {
             list.append(Py::String(i->Name() ? i->Name() : ""));
         }
 
@@ -26,11 +26,15 @@
 
 // Std. configurations
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <sstream>
+#include <vector>
 #include <FCGlobal.h>
 
 #include <fmt/printf.h>
@@ -359,7 +363,8 @@ using PyMethodDef = struct PyMethodDef;
 
 #define __FC_PRINT(_instance, _l, _func, _notifier, _msg, _file, _line)                            \
     do {                                                                                           \
-        if (_instance.isEnabled(_l)) {                                                             \
+        if (_instance.isEnabled(_l)                                                                \
+            && Base::Console().IsActive(Base::LogLevel::logStyle(_l))) {                           \
             std::stringstream _str;                                                                \
             _instance.prefix(_str, _file, _line) << _msg;                                          \
             if (_instance.add_eol)                                                                 \
@@ -546,6 +551,32 @@ enum class ContentType
  *
  *  @see ConsoleSingleton
  */
+/** Switches a message category of a console observer on or off
+ *  It is used like a bool. Changing it updates the categories that the console considers active,
+ *  see ConsoleSingleton::IsActive().
+ */
+class BaseExport LoggerFlag
+{
+public:
+    explicit LoggerFlag(bool on)
+        : on(on)
+    {}
+    LoggerFlag(const LoggerFlag&) = delete;
+    LoggerFlag(LoggerFlag&&) = delete;
+    LoggerFlag& operator=(const LoggerFlag&) = delete;
+    LoggerFlag& operator=(LoggerFlag&&) = delete;
+    ~LoggerFlag() = default;
+
+    LoggerFlag& operator=(bool value);
+    operator bool() const  // NOLINT
+    {
+        return on.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> on;
+};
+
 class BaseExport ILogger
 {
 public:
@@ -605,15 +636,17 @@ public:
     {
         return nullptr;
     }
-    bool bErr {true};
-    bool bMsg {true};
-    bool bLog {true};
-    bool bWrn {true};
-    bool bCritical {true};
-    bool bNotification {false};
+    LoggerFlag bErr {true};
+    LoggerFlag bMsg {true};
+    LoggerFlag bLog {true};
+    LoggerFlag bWrn {true};
+    LoggerFlag bCritical {true};
+    LoggerFlag bNotification {false};
 };
 
 
+class ConsoleRateLimiter;
+
 /** The console class
  *  This class manage all the stdio stuff. This includes
  *  Messages, Warnings, Log entries, Errors, Criticals, Notifications. The incoming Messages are
@@ -674,6 +707,12 @@ public:
  *  Untranslated message, if they need the localized version. Users shall mark Untranslated messages
  *  for translation.
  *
+ *  Messages may be sent from any thread. In Direct mode the observers are called by the sending
+ *  thread, so an observer may be called from several threads at the same time. In Queued mode they are called from the Qt event loop of the main thread.
+ *  In Async mode the senders only put the messages into a lock-free queue and a dedicated thread
+ *  calls the observers, which keeps logging cheap for worker threads. As the observers are then
+ *  called outside the main thread, Async mode is meant for observers that don't touch the GUI.
+ *
  *  Untranslated messages have the inherent advantage that can be processed in English by observers
  *  needing the English version, while enabling other observers to retrieve a translated version.
  *
@@ -797,7 +836,8 @@ public:
     enum ConnectionMode
     {
         Direct = 0,
-        Queued = 1
+        Queued = 1,
+        Async = 2
     };
 
     enum FreeCAD_ConsoleMsgType
@@ -819,6 +859,18 @@ public:
     /// Checks if message types of a certain console observer are enabled
     bool IsMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType type) const;
     void SetConnectionMode(ConnectionMode mode);
+    /// Waits until all messages sent in Async mode have been passed to the observers
+    void Flush();
+
+    /// Checks if any observer accepts messages of the given category, this doesn't lock
+    bool IsActive(LogStyle category) const;
+
+    /** Limits how often the same warning is passed to the observers
+     *  If an identical warning is sent more than \a maxRepeats times within \a interval the
+     *  further ones are dropped. The number of dropped warnings is reported with the first
+     *  warning after the interval has passed. A \a maxRepeats of 0 disables the limit.
+     */
+    void SetRateLimit(unsigned int maxRepeats, std::chrono::milliseconds interval);
 
     int* GetLogLevel(const char* tag, bool create = true);
 
@@ -867,7 +919,7 @@ private:
 
     bool _bVerbose {true};
     bool _bCanRefresh {true};
-    ConnectionMode connectionMode {Direct};
+    std::atomic<ConnectionMode> connectionMode {Direct};
 
     // Singleton!
     ConsoleSingleton();
@@ -885,23 +937,47 @@ private:
                    ContentType content,
                    const std::string& notifiername,
                    const std::string& msg);
+    void postAsync(LogStyle category,
+                   IntendedRecipient recipient,
+                   ContentType content,
+                   const std::string& notifiername,
+                   const std::string& msg);
     void notifyPrivate(LogStyle category,
                        IntendedRecipient recipient,
                        ContentType content,
                        const std::string& notifiername,
                        const std::string& msg);
+    void notifyObservers(LogStyle category,
+                         IntendedRecipient recipient,
+                         ContentType content,
+                         const std::string& notifiername,
+                         const std::string& msg);
 
     // singleton
     static void Destruct();
     static ConsoleSingleton* _pcSingleton;  // NOLINT
 
-    // observer list
-    std::set<ILogger*> _aclObservers;
+    using ObserverList = std::vector<ILogger*>;
+    std::shared_ptr<const ObserverList> getObservers() const;
+    std::shared_ptr<ConsoleRateLimiter> getRateLimiter() const;
+    void updateActiveCategories();
+
+    // observer list, it is replaced as a whole when an observer is attached or detached so that
+    // the observers can be called without holding a lock
+    std::shared_ptr<const ObserverList> _aclObservers {std::make_shared<const ObserverList>()};
+    // guards swapping the observer list and the rate limiter
+    mutable std::mutex _observerMutex;
+    // one bit per LogStyle that any observer accepts
+    std::atomic<unsigned int> _activeCategories {0};
+    // drops repeated warnings if set
+    std::shared_ptr<ConsoleRateLimiter> _rateLimiter;
 
     std::map<std::string, int> _logLevels;
     int _defaultLogLevel;
 
     friend class ConsoleOutput;
+    friend class ConsoleDispatcher;
+    friend class LoggerFlag;
 };
 
 /** Access to the Console
@@ -979,6 +1055,21 @@ public:
         return lev <= level();
     }
 
+    /// returns the category of the messages printed for a log level
+    static constexpr LogStyle logStyle(int lev)
+    {
+        switch (lev) {
+            case FC_LOGLEVEL_ERR:
+                return LogStyle::Error;
+            case FC_LOGLEVEL_WARN:
+                return LogStyle::Warning;
+            case FC_LOGLEVEL_MSG:
+                return LogStyle::Message;
+            default:
+                return LogStyle::Log;
+        }
+    }
+
     int level() const
     {
         return Console().LogLevel(lvl);
@@ -1171,11 +1262,20 @@ template<Base::LogStyle category,
 inline void
 Base::ConsoleSingleton::Send(const std::string& notifiername, const char* pMsg, Args&&... args)
 {
+    // don't format messages nobody listens to
+    if (!IsActive(category)) {
+        return;
+    }
+
     std::string format = fmt::sprintf(pMsg, args...);
 
-    if (connectionMode == Direct) {
+    ConnectionMode mode = connectionMode;
+    if (mode == Direct) {
         Notify<category, recipient, contenttype>(notifiername, format);
     }
+    else if (mode == Async) {
+        postAsync(category, recipient, contenttype, notifiername, format);
+    }
     else {
 
         auto type = getConsoleMsg(category);
@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <xercesc/dom/DOM.hpp>
 #include <xercesc/framework/LocalFileFormatTarget.hpp>
 #include <xercesc/framework/LocalFileInputSource.hpp>
@@ -674,6 +675,10 @@ ParameterGrp::GetAttributeMap(ParamType Type, const char* sFilter) const
 
 void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
 {
+    // a group notification without name means that the group is cleared
+    if (Type != ParamType::FCGroup || !Name) {
+        _InvalidateCache(Type, Name);
+    }
     if (_Manager) {
         _Manager->signalParamChanged(this, Type, Name, Value);
     }
@@ -702,6 +707,8 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
     // find or create the Element
     DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
     if (pcElem) {
+        // a newly created element may hold the same value without notification
+        _InvalidateCache(T, Name);
         XStr attr("Value");
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
@@ -715,21 +722,101 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
     }
 }
 
-bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
+namespace
+{
+std::string cacheKey(ParameterGrp::ParamType Type, const char* Name)
+{
+    std::string key(1, static_cast<char>(Type));
+    key += Name;
+    return key;
+}
+}  // namespace
+
+ParameterGrp::CachedValue ParameterGrp::_GetCachedValue(ParamType Type, const char* Name) const
 {
     if (!_pGroupNode) {
-        return bPreset;
+        return {};
+    }
+    // without a name the first element of the type is returned which is not cached
+    if (!Name) {
+        std::unique_lock<std::shared_mutex> lock(_CacheMutex);
+        return _ReadValue(Type, Name);
+    }
+
+    std::string key = cacheKey(Type, Name);
+    {
+        std::shared_lock<std::shared_mutex> lock(_CacheMutex);
+        auto it = _Cache.find(key);
+        if (it != _Cache.end()) {
+            return it->second;
+        }
+    }
+
+    // The DOM is only read with the exclusive lock held. Another thread may
+    // have filled the entry in the meantime, so search again.
+    std::unique_lock<std::shared_mutex> lock(_CacheMutex);
+    auto it = _Cache.find(key);
+    if (it == _Cache.end()) {
+        it = _Cache.emplace(std::move(key), _ReadValue(Type, Name)).first;
+    }
+    return it->second;
+}
+
+ParameterGrp::CachedValue ParameterGrp::_ReadValue(ParamType Type, const char* Name) const
+{
+    const char* T = TypeName(Type);
+    if (!T || Type == ParamType::FCGroup) {
+        return {};
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
+    DOMElement* pcElem = FindElement(_pGroupNode, T, Name);
+    // if not return an empty value
     if (!pcElem) {
-        return bPreset;
+        return {};
     }
 
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), "1") == 0);
+    if (Type == ParamType::FCText) {
+        DOMNode* pcElem2 = pcElem->getFirstChild();
+        if (pcElem2) {
+            return std::string(StrXUTF8(pcElem2->getNodeValue()).c_str());
+        }
+        return std::string();
+    }
+
+    StrX value(pcElem->getAttribute(XStr("Value").unicodeForm()));
+    switch (Type) {
+        case ParamType::FCBool:
+            return strcmp(value.c_str(), "1") == 0;
+        case ParamType::FCInt:
+            return atol(value.c_str());
+        case ParamType::FCUInt:
+            return strtoul(value.c_str(), nullptr, 10);
+        case ParamType::FCFloat:
+            return atof(value.c_str());
+        default:
+            return {};
+    }
+}
+
+void ParameterGrp::_InvalidateCache(ParamType Type, const char* Name)
+{
+    std::unique_lock<std::shared_mutex> lock(_CacheMutex);
+    if (!Name) {
+        _Cache.clear();
+    }
+    else {
+        _Cache.erase(cacheKey(Type, Name));
+    }
+}
+
+bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
+{
+    CachedValue value = _GetCachedValue(ParamType::FCBool, Name);
+    if (const bool* pValue = std::get_if<bool>(&value)) {
+        return *pValue;
+    }
+    return bPreset;
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -793,18 +880,11 @@ std::vector<std::pair<std::string, bool>> ParameterGrp::GetBoolMap(const char* s
 
 long ParameterGrp::GetInt(const char* Name, long lPreset) const
 {
-    if (!_pGroupNode) {
-        return lPreset;
+    CachedValue value = _GetCachedValue(ParamType::FCInt, Name);
+    if (const long* pValue = std::get_if<long>(&value)) {
+        return *pValue;
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return lPreset;
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -863,18 +943,11 @@ std::vector<std::pair<std::string, long>> ParameterGrp::GetIntMap(const char* sF
 
 unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset) const
 {
-    if (!_pGroupNode) {
-        return lPreset;
+    CachedValue value = _GetCachedValue(ParamType::FCUInt, Name);
+    if (const unsigned long* pValue = std::get_if<unsigned long>(&value)) {
+        return *pValue;
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-    // if yes check the value and return
-    return strtoul(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), nullptr, 10);
+    return lPreset;
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -938,18 +1011,11 @@ ParameterGrp::GetUnsignedMap(const char* sFilter) const
 
 double ParameterGrp::GetFloat(const char* Name, double dPreset) const
 {
-    if (!_pGroupNode) {
-        return dPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
-        return dPreset;
+    CachedValue value = _GetCachedValue(ParamType::FCFloat, Name);
+    if (const double* pValue = std::get_if<double>(&value)) {
+        return *pValue;
     }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return dPreset;
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1052,25 +1118,14 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
 
 std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
 {
-    if (!_pGroupNode) {
-        return pPreset ? pPreset : "";
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
-        if (!pPreset) {
-            return {};
-        }
-        return {pPreset};
+    CachedValue value = _GetCachedValue(ParamType::FCText, Name);
+    if (std::string* pValue = std::get_if<std::string>(&value)) {
+        return std::move(*pValue);
     }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
+    if (!pPreset) {
+        return {};
     }
-    return {};
+    return {pPreset};
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1525,6 +1580,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _InvalidateCache(ParamType::FCInvalid, nullptr);
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1821,6 +1877,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    _InvalidateCache(ParamType::FCInvalid, nullptr);
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1935,6 +1992,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStr("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStr("Name").unicodeForm(), XStr("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _InvalidateCache(ParamType::FCInvalid, nullptr);
 }
 
 void ParameterManager::CheckDocument() const
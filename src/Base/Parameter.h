@@ -50,6 +50,10 @@ using PyObject = struct _object;
 #endif
 
 #include <map>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <variant>
 #include <vector>
 #include <boost_signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -89,6 +93,12 @@ class ParameterManager;
  *  Its main task is making user parameter persistent, saving
  *  last used values in dialog boxes, setting and retrieving all
  *  kind of preferences and so on.
+ *  \par
+ *  Values read with GetBool(), GetInt(), GetUnsigned(), GetFloat() and
+ *  GetASCII() are cached per group, so that only the first access has to
+ *  search the DOM. The cache is invalidated whenever a change notification
+ *  is sent. Reading values from several threads at the same time is safe,
+ *  modifying a group must still be done from one thread only.
  *  @see ParameterManager
  */
 class BaseExport ParameterGrp: public Base::Handled, public Base::Subject<const char*>
@@ -290,6 +300,16 @@ protected:
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
+    /// value of a parameter, std::monostate if there is no such parameter
+    using CachedValue =
+        std::variant<std::monostate, bool, long, unsigned long, double, std::string>;
+    /// returns the value of a parameter from the cache and reads it on a cache miss
+    CachedValue _GetCachedValue(ParamType Type, const char* Name) const;
+    /// reads the value of a parameter from the DOM
+    CachedValue _ReadValue(ParamType Type, const char* Name) const;
+    /// removes a parameter from the cache, or all parameters if Name is null
+    void _InvalidateCache(ParamType Type, const char* Name);
+
     XERCES_CPP_NAMESPACE_QUALIFIER DOMElement*
     FindNextElement(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode* Prev, const char* Type) const;
 
@@ -339,6 +359,10 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+    /// cache of the parameter values, the key is the type followed by the name
+    mutable std::unordered_map<std::string, CachedValue> _Cache;
+    /// protects the cache against concurrent readers
+    mutable std::shared_mutex _CacheMutex;
 };
 
 /** The parameter serializer class
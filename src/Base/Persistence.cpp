@@ -72,6 +72,11 @@ void Persistence::SaveDocFile(Writer& /*writer*/) const
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::deferDocFile(const std::shared_ptr<DeferredFile>& /*file*/)
+{
+    return false;
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
     std::string tmp;
@@ -24,10 +24,13 @@
 #ifndef APP_PERSISTENCE_H
 #define APP_PERSISTENCE_H
 
+#include <memory>
+
 #include "BaseClass.h"
 
 namespace Base
 {
+class DeferredFile;
 class Reader;
 class Writer;
 class XMLReader;
@@ -142,6 +145,13 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** This method is offered a file of the archive before RestoreDocFile() would be called
+     * If the reader was asked to defer the files (see XMLReader::setDeferFiles()) an object can
+     * keep \a file and restore it later with DeferredFile::restore() when it actually needs the
+     * data. In this case it must return true and RestoreDocFile() is not called by the reader.
+     * The default implementation returns false, i.e. the file is read immediately.
+     */
+    virtual bool deferDocFile(const std::shared_ptr<DeferredFile>& /*file*/);
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
@@ -35,6 +35,7 @@
 #include <fcntl.h>
 #include <cstdio>
 #include <cassert>
+#include <cctype>
 #include <ctime>
 #include <cfloat>
 #ifdef FC_OS_WIN32
@@ -63,6 +64,9 @@
 #endif
 
 // STL
+#include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <string>
 #include <string_view>
 #include <list>
@@ -73,7 +77,9 @@
 #include <stack>
 #include <queue>
 #include <memory>
+#include <mutex>
 #include <bitset>
+#include <thread>
 
 // streams
 #include <iostream>
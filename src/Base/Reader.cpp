@@ -24,7 +24,10 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <array>
+#include <cctype>
 #include <memory>
+#include <unordered_map>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
@@ -43,6 +46,7 @@
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -51,6 +55,108 @@ XERCES_CPP_NAMESPACE_USE
 
 using namespace std;
 
+namespace
+{
+
+// Starts a document written by XMLReader::convertToBinary(). The first byte cannot start an XML
+// document, neither in UTF-8 nor in UTF-16.
+constexpr std::array<char, 8> binaryMagic {'\xFC', 'F', 'C', 'B', 'X', 'M', 'L', '\x01'};
+// Set in the type byte of a record if the characters of the step follow
+constexpr int binaryCharsFlag = 0x80;
+constexpr int binaryTypeMask = 0x0F;
+
+void writeSize(std::ostream& out, std::size_t value)
+{
+    while (value >= 0x80) {
+        out.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.put(static_cast<char>(value));
+}
+
+std::size_t readSize(std::istream& in)
+{
+    std::size_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int byte = in.get();
+        if (byte == std::char_traits<char>::eof()) {
+            throw Base::XMLParseException("Unexpected end of binary XML document");
+        }
+        value |= static_cast<std::size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw Base::XMLParseException("Invalid size in binary XML document");
+}
+
+void writeString(std::ostream& out, const std::string& str)
+{
+    writeSize(out, str.size());
+    out.write(str.c_str(), static_cast<std::streamsize>(str.size()));
+}
+
+std::string readString(std::istream& in)
+{
+    std::string str(readSize(in), '\0');
+    if (!in.read(&str[0], static_cast<std::streamsize>(str.size()))) {
+        throw Base::XMLParseException("Unexpected end of binary XML document");
+    }
+    return str;
+}
+
+// A string is written as a reference into a table that grows while writing. The reference 0 is
+// followed by a new entry of the table, 1 by a string that is not added to the table and any
+// other reference n addresses the existing entry n-2.
+class StringTable
+{
+public:
+    void write(std::ostream& out, const std::string& str, bool intern = true)
+    {
+        if (!intern) {
+            writeSize(out, 1);
+            writeString(out, str);
+            return;
+        }
+        auto res = indices.emplace(str, indices.size() + 2);
+        if (res.second) {
+            writeSize(out, 0);
+            writeString(out, str);
+        }
+        else {
+            writeSize(out, res.first->second);
+        }
+    }
+
+private:
+    std::unordered_map<std::string, std::size_t> indices;
+};
+
+std::string readReference(std::istream& in, std::vector<std::string>& table)
+{
+    std::size_t index = readSize(in);
+    if (index == 0) {
+        table.push_back(readString(in));
+        return table.back();
+    }
+    if (index == 1) {
+        return readString(in);
+    }
+    if (index - 2 >= table.size()) {
+        throw Base::XMLParseException("Invalid string reference in binary XML document");
+    }
+    return table[index - 2];
+}
+
+// Attribute values like property names and types repeat a lot while numbers rarely do
+bool internValue(const std::string& value)
+{
+    return !value.empty() && value.size() <= 64
+        && std::isalpha(static_cast<unsigned char>(value[0]));
+}
+
+}  // namespace
+
 
 // ---------------------------------------------------------------------------
 //  Base::XMLReader: Constructors and Destructor
@@ -65,6 +171,18 @@ Base::XMLReader::XMLReader(const char* FileName, std::istream& str)
     str.imbue(std::locale::classic());
 #endif
 
+    // a binary encoded document doesn't need the parser
+    if (str.peek() == std::char_traits<char>::to_int_type(binaryMagic[0])) {
+        std::array<char, binaryMagic.size()> magic {};
+        str.read(magic.data(), magic.size());
+        BinaryStream = &str;
+        _valid = (magic == binaryMagic);
+        if (_valid) {
+            readBinary();
+        }
+        return;
+    }
+
     // create the parser
     parser = XMLReaderFactory::createXMLReader();  // NOLINT
 
@@ -178,6 +296,11 @@ bool Base::XMLReader::read()
 {
     ReadType = None;
 
+    if (BinaryStream) {
+        readBinary();
+        return true;
+    }
+
     try {
         parser->parseNext(token);
     }
@@ -201,6 +324,107 @@ bool Base::XMLReader::read()
     return true;
 }
 
+void Base::XMLReader::readBinary()
+{
+    int flags = BinaryStream->get();
+    if (flags == std::char_traits<char>::eof()) {
+        // like the parser nothing happens after the end of the document
+        return;
+    }
+
+    int type = flags & binaryTypeMask;
+    if (type == StartElement || type == StartEndElement) {
+        LocalName = readReference(*BinaryStream, BinaryNames);
+        AttrMap.clear();
+        std::size_t count = readSize(*BinaryStream);
+        for (std::size_t i = 0; i < count; i++) {
+            std::string name = readReference(*BinaryStream, BinaryNames);
+            AttrMap[name] = readReference(*BinaryStream, BinaryValues);
+        }
+        if (type == StartElement) {
+            Level++;
+        }
+    }
+    else if (type == EndElement) {
+        Level--;
+        LocalName = readReference(*BinaryStream, BinaryNames);
+    }
+    else if (type > EndCDATA) {
+        throw Base::XMLParseException("Invalid record in binary XML document");
+    }
+
+    if (flags & binaryCharsFlag) {
+        Characters = readString(*BinaryStream);
+        CharacterCount += Characters.size();
+    }
+    ReadType = static_cast<decltype(ReadType)>(type);
+}
+
+void Base::XMLReader::convertToBinary(std::istream& xml, std::ostream& out)
+{
+    XMLReader reader("<memory>", xml);
+    if (!reader.isValid()) {
+        throw Base::XMLParseException("Invalid XML document");
+    }
+
+    out.write(binaryMagic.data(), binaryMagic.size());
+    StringTable names;
+    StringTable values;
+    int level = 0;
+    unsigned int count = 0;
+    // Write a record for the state of the reader after each step, i.e. after the constructor
+    // and after every call of read() until the end of the document
+    for (;;) {
+        int type = reader.ReadType;
+        if (type == StartElement) {
+            level++;
+        }
+        else if (type == EndElement) {
+            level--;
+        }
+        // Each step is expected to change the level according to its type only
+        if (reader.Level != level) {
+            throw Base::XMLParseException("Unsupported structure of XML document");
+        }
+
+        bool chars = reader.CharacterCount != count;
+        count = reader.CharacterCount;
+        out.put(static_cast<char>(chars ? type | binaryCharsFlag : type));
+        if (type == StartElement || type == StartEndElement) {
+            names.write(out, reader.LocalName);
+            writeSize(out, reader.AttrMap.size());
+            for (const auto& it : reader.AttrMap) {
+                names.write(out, it.first);
+                values.write(out, it.second, internValue(it.second));
+            }
+        }
+        else if (type == EndElement) {
+            names.write(out, reader.LocalName);
+        }
+        if (chars) {
+            writeString(out, reader.Characters);
+        }
+
+        if (type == EndDocument) {
+            break;
+        }
+        reader.read();
+    }
+}
+
+std::string Base::XMLReader::binaryFileName(const std::string& name)
+{
+    if (name == "Document.xml" || name == "GuiDocument.xml") {
+        return name.substr(0, name.size() - 3) + "bxml";
+    }
+    return {};
+}
+
+bool Base::XMLReader::isBinary() const
+{
+    return BinaryStream != nullptr;
+}
+
 void Base::XMLReader::readElement(const char* ElementName)
 {
     bool ok {};
@@ -429,18 +653,44 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+    // The archive is only opened a second time if any object accepts to defer its file
+    std::shared_ptr<zipios::ZipFile> archive;
+    auto deferFile = [&](const FileEntry& file) {
+        if (!_deferFiles) {
+            return false;
+        }
+        try {
+            if (!archive) {
+                archive = std::make_shared<zipios::ZipFile>(_File.filePath());
+            }
+            auto deferred = std::make_shared<DeferredFile>(archive, entry->getName(), FileVersion);
+            return file.Object->deferDocFile(deferred);
+        }
+        catch (const std::exception& e) {
+            Base::Console().Warning("Cannot defer reading of %s: %s\n",
+                                    file.FileName.c_str(),
+                                    e.what());
+            return false;
+        }
+    };
+
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
         std::vector<FileEntry>::const_iterator jt = it;
         // Check if the current entry is registered, otherwise check the next registered files as
         // soon as both file names match
-        while (jt != FileList.end() && entry->getName() != jt->FileName) {
+        while (jt != FileList.end() && entry->getName() != jt->FileName
+               && entry->getName() != binaryFileName(jt->FileName)) {
             ++jt;
         }
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
-        if (jt != FileList.end()) {
+        if (jt != FileList.end() && deferFile(*jt)) {
+            // The object reads the file later on, closing the entry skips its data
+            it = jt + 1;
+        }
+        else if (jt != FileList.end()) {
             try {
                 Base::Reader reader(zipstream, jt->FileName, FileVersion);
                 jt->Object->RestoreDocFile(reader);
@@ -474,6 +724,16 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
     }
 }
 
+void Base::XMLReader::setDeferFiles(bool on)
+{
+    _deferFiles = on;
+}
+
+bool Base::XMLReader::isDeferFiles() const
+{
+    return _deferFiles;
+}
+
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
 {
     FileEntry temp;
@@ -696,3 +956,44 @@ std::shared_ptr<Base::XMLReader> Base::Reader::getLocalReader() const
 {
     return (this->localreader);
 }
+
+// ----------------------------------------------------------
+
+Base::DeferredFile::DeferredFile(std::shared_ptr<zipios::ZipFile> archive,
+                                 std::string fileName,
+                                 int version)
+    : archive(std::move(archive))
+    , fileName(std::move(fileName))
+    , fileVersion(version)
+{}
+
+const std::string& Base::DeferredFile::getFileName() const
+{
+    return fileName;
+}
+
+bool Base::DeferredFile::restore(Base::Persistence& object)
+{
+    try {
+        std::unique_ptr<std::istream> str(archive->getInputStream(fileName));
+        if (!str) {
+            Base::Console().Error("Missing embedded file: %s\n", fileName.c_str());
+            failed = true;
+            return false;
+        }
+        Base::Reader reader(*str, fileName, fileVersion);
+        object.RestoreDocFile(reader);
+        failed = false;
+        return true;
+    }
+    catch (...) {
+        Base::Console().Error("Reading failed from embedded file: %s\n", fileName.c_str());
+        failed = true;
+        return false;
+    }
+}
+
+bool Base::DeferredFile::hasFailed() const
+{
+    return failed;
+}
@@ -40,6 +40,7 @@
 
 namespace zipios
 {
+class ZipFile;
 class ZipInputStream;
 }
 
@@ -232,6 +233,12 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Offer the requested files to their objects instead of reading them
+     * If enabled readFiles() passes a DeferredFile to Persistence::deferDocFile() and skips the
+     * file if the object accepts it.
+     */
+    void setDeferFiles(bool on);
+    bool isDeferFiles() const;
     /// get all registered file names
     const std::vector<std::string>& getFilenames() const;
     bool isRegistered(Base::Persistence* Object) const;
@@ -259,6 +266,23 @@ public:
     /// set the status bits
     void setStatus(ReaderStatus pos, bool on);
 
+    /** @name Binary encoding */
+    //@{
+    /** Converts the XML document \a xml into the compact binary encoding
+     * The binary encoding stores the sequence of read steps of the document as length-prefixed
+     * records with interned element and attribute names. A reader detects it automatically, so
+     * Restore() methods work unchanged but the XML parser is bypassed.
+     */
+    static void convertToBinary(std::istream& xml, std::ostream& out);
+    /** Returns the name of the document file \a name in the binary encoding
+     * Document.xml and GuiDocument.xml are stored as Document.bxml and GuiDocument.bxml, so that
+     * tools expecting text XML don't pick them up. Returns an empty string for any other file.
+     */
+    static std::string binaryFileName(const std::string& name);
+    /// returns true if the read document uses the binary encoding
+    bool isBinary() const;
+    //@}
+
 protected:
     /// read the next element
     bool read();
@@ -304,6 +328,10 @@ protected:
     void resetErrors() override;
     //@}
 
+private:
+    /// read the next step of a binary encoded document
+    void readBinary();
+
 private:
     int Level {0};
     std::string LocalName;
@@ -329,10 +357,15 @@ private:
 
 
     FileInfo _File;
-    XERCES_CPP_NAMESPACE_QUALIFIER SAX2XMLReader* parser;
+    XERCES_CPP_NAMESPACE_QUALIFIER SAX2XMLReader* parser {nullptr};
     XERCES_CPP_NAMESPACE_QUALIFIER XMLPScanToken token;
     bool _valid {false};
     bool _verbose {true};
+    bool _deferFiles {false};
+
+    std::istream* BinaryStream {nullptr};
+    std::vector<std::string> BinaryNames;
+    std::vector<std::string> BinaryValues;
 
     struct FileEntry
     {
@@ -364,6 +397,30 @@ private:
     std::shared_ptr<Base::XMLReader> localreader;
 };
 
+/** A file of a project archive whose reading has been deferred
+ * It is handed out by XMLReader::readFiles() to objects that accept it in
+ * Persistence::deferDocFile(). Restoring it opens the archive again, so the file must
+ * still exist at its original location.
+ */
+class BaseExport DeferredFile
+{
+public:
+    DeferredFile(std::shared_ptr<zipios::ZipFile> archive, std::string fileName, int version);
+    const std::string& getFileName() const;
+    /// calls RestoreDocFile() of \a object with the content of the file
+    bool restore(Base::Persistence& object);
+    /** Returns true if restore() could not read the file
+     * The object then doesn't hold the data of the file and must not be saved in its place.
+     */
+    bool hasFailed() const;
+
+private:
+    std::shared_ptr<zipios::ZipFile> archive;
+    std::string fileName;
+    int fileVersion;
+    bool failed {false};
+};
+
 }  // namespace Base
 
 
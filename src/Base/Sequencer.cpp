@@ -24,6 +24,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <QMutexLocker>
 #endif
 
@@ -118,7 +119,12 @@ void SequencerBase::startStep()
 
 bool SequencerBase::next(bool canAbort)
 {
-    this->nProgress++;
+    return advanceTo(this->nProgress + 1, canAbort);
+}
+
+bool SequencerBase::advanceTo(size_t progress, bool canAbort)
+{
+    this->nProgress = std::max(this->nProgress, progress);
     float fDiv = this->nTotalSteps > 0 ? static_cast<float>(this->nTotalSteps) : 1000.0F;
     int perc = int((float(this->nProgress) * (100.0F / fDiv)));
 
@@ -234,7 +240,21 @@ void ConsoleSequencer::resetData()
 
 // ---------------------------------------------------------
 
+ProgressToken::ProgressToken(size_t steps)
+    : _nTotalSteps(steps)
+{}
+
+void ProgressToken::checkAbort() const
+{
+    if (wasCanceled()) {
+        throw AbortException("User aborted");
+    }
+}
+
+// ---------------------------------------------------------
+
 SequencerLauncher::SequencerLauncher(const char* pszStr, size_t steps)
+    : threadId(std::this_thread::get_id())
 {
     QMutexLocker locker(&SequencerP::mutex);
     // Have we already an instance of SequencerLauncher created?
@@ -286,3 +306,36 @@ bool SequencerLauncher::wasCanceled() const
 {
     return SequencerBase::Instance().wasCanceled();
 }
+
+bool SequencerLauncher::poll(ProgressToken& token)
+{
+    // the sequencer must only be touched by the thread that started it
+    if (std::this_thread::get_id() != threadId || token.wasCanceled()) {
+        return !token.wasCanceled();
+    }
+
+    QMutexLocker locker(&SequencerP::mutex);
+    if (SequencerP::_topLauncher != this) {
+        return true;  // ignore
+    }
+
+    SequencerBase& seq = SequencerBase::Instance();
+    try {
+        size_t steps = seq.numberOfSteps();
+        size_t progress = token.progress();
+        if (steps != token.numberOfSteps() && token.numberOfSteps() > 0) {
+            double scale = double(steps) / double(token.numberOfSteps());
+            progress = static_cast<size_t>(double(progress) * scale);
+        }
+        seq.advanceTo(progress, true);
+        seq.checkAbort();
+    }
+    catch (const AbortException&) {
+        token.cancel();
+    }
+
+    if (seq.wasCanceled()) {
+        token.cancel();
+    }
+    return !token.wasCanceled();
+}
@@ -24,6 +24,9 @@
 #ifndef BASE_SEQUENCER_H
 #define BASE_SEQUENCER_H
 
+#include <atomic>
+#include <thread>
+
 #include "Exception.h"
 
 
@@ -31,6 +34,7 @@ namespace Base
 {
 
 class AbortException;
+class ProgressToken;
 class SequencerLauncher;
 
 /**
@@ -106,6 +110,9 @@ class SequencerLauncher;
  * \note It's not supported to create an instance of SequencerBase or a sub-class
  * in another thread than the main thread. But you can create SequencerLauncher
  * instances in other threads.
+ * \note Operations that distribute their work over several threads must not call
+ * SequencerLauncher.next() from the worker threads. Instead the workers advance a
+ * \a ProgressToken that the thread owning the launcher passes to SequencerLauncher.poll().
  *
  * \author Werner Mayer
  */
@@ -175,6 +182,11 @@ protected:
      * is thrown.
      */
     bool next(bool canAbort = false);
+    /**
+     * Sets the progress to \a progress steps and updates the indicator the same way
+     * as next() does. The progress never goes backwards.
+     */
+    bool advanceTo(size_t progress, bool canAbort = false);
     /**
      * Stops the sequencer if all operations are finished. It returns false if
      * there are still pending operations, otherwise it returns true.
@@ -282,6 +294,70 @@ private:
     void resetData() override;
 };
 
+/**
+ * \brief The ProgressToken class collects the progress of an operation whose work is
+ * distributed over several threads.
+ * Unlike the sequencer all methods of this class can be called from any thread. The
+ * workers only advance the token while the thread that created the SequencerLauncher
+ * regularly passes it to SequencerLauncher::poll(). This shows the progress and forwards
+ * a cancellation of the user to the token so that the workers can stop early.
+ *  \code
+ *  Base::SequencerLauncher seq("my text", count);
+ *  Base::ProgressToken token(count);
+ *  #pragma omp parallel for
+ *  for (int i=0; i<count; i++)
+ *  {
+ *    if (!seq.poll(token)) // only has an effect in the thread owning seq
+ *      continue;
+ *    // do something
+ *    token.next();
+ *  }
+ *  token.checkAbort();
+ *  \endcode
+ */
+class BaseExport ProgressToken
+{
+public:
+    explicit ProgressToken(size_t steps);
+    /** Advances the progress by \a count steps. */
+    void next(size_t count = 1)
+    {
+        _nProgress.fetch_add(count, std::memory_order_relaxed);
+    }
+    /** Returns the number of finished steps. */
+    size_t progress() const
+    {
+        return _nProgress.load(std::memory_order_relaxed);
+    }
+    /** Returns the total number of steps. */
+    size_t numberOfSteps() const
+    {
+        return _nTotalSteps;
+    }
+    /** Requests the workers to stop. */
+    void cancel()
+    {
+        _bCanceled.store(true, std::memory_order_relaxed);
+    }
+    /** Returns true if the operation was canceled. */
+    bool wasCanceled() const
+    {
+        return _bCanceled.load(std::memory_order_relaxed);
+    }
+    /** Throws an AbortException if the operation was canceled. */
+    void checkAbort() const;
+
+    ProgressToken(const ProgressToken&) = delete;
+    ProgressToken(ProgressToken&&) = delete;
+    ProgressToken& operator=(const ProgressToken&) = delete;
+    ProgressToken& operator=(ProgressToken&&) = delete;
+
+private:
+    std::atomic<size_t> _nProgress {0};
+    std::atomic<bool> _bCanceled {false};
+    const size_t _nTotalSteps;
+};
+
 /** The SequencerLauncher class is provided for convenience. It allows you to run an instance of the
  * sequencer by instantiating an object of this class -- most suitable on the stack. So this
  * mechanism can be used for try-catch-blocks to destroy the object automatically if the C++
@@ -375,11 +451,21 @@ public:
     bool next(bool canAbort = false);
     void setProgress(size_t);
     bool wasCanceled() const;
+    /**
+     * Shows the progress of \a token and cancels it if the user aborted the operation.
+     * Only the thread that created this launcher updates the sequencer, for any other
+     * thread this method only checks the token. Returns false if the token was canceled.
+     * This method never throws an AbortException.
+     */
+    bool poll(ProgressToken& token);
 
     SequencerLauncher(const SequencerLauncher&) = delete;
     SequencerLauncher(SequencerLauncher&&) = delete;
     void operator=(const SequencerLauncher&) = delete;
     void operator=(SequencerLauncher&&) = delete;
+
+private:
+    const std::thread::id threadId;
 };
 
 /** Access to the only SequencerBase instance */
@@ -27,6 +27,8 @@
 #include <QBuffer>
 #include <QByteArray>
 #include <QIODevice>
+#include <algorithm>
+#include <array>
 #include <cstring>
 #ifdef __GNUC__
 #include <cstdint>
@@ -40,6 +42,90 @@
 
 using namespace Base;
 
+namespace
+{
+
+template<std::size_t N>
+struct UIntOfSize;
+
+template<>
+struct UIntOfSize<2>
+{
+    using type = uint16_t;
+};
+
+template<>
+struct UIntOfSize<4>
+{
+    using type = uint32_t;
+};
+
+template<>
+struct UIntOfSize<8>
+{
+    using type = uint64_t;
+};
+
+inline uint16_t byteSwap(uint16_t v)
+{
+    return static_cast<uint16_t>((v >> 8) | (v << 8));
+}
+
+inline uint32_t byteSwap(uint32_t v)
+{
+    return ((v >> 24) & 0x000000FFU) | ((v >> 8) & 0x0000FF00U) | ((v << 8) & 0x00FF0000U)
+        | ((v << 24) & 0xFF000000U);
+}
+
+inline uint64_t byteSwap(uint64_t v)
+{
+    return (uint64_t(byteSwap(uint32_t(v))) << 32) | uint64_t(byteSwap(uint32_t(v >> 32)));
+}
+
+// Swaps the bytes of count values from src to dst. The values are processed as unsigned
+// integers of the same size with branch-free shifts so that the compiler can vectorize the loop.
+template<typename T>
+void swapArray(const T* src, T* dst, std::size_t count)
+{
+    using UInt = typename UIntOfSize<sizeof(T)>::type;
+    for (std::size_t i = 0; i < count; i++) {
+        UInt u {};
+        std::memcpy(&u, src + i, sizeof(UInt));
+        u = byteSwap(u);
+        std::memcpy(dst + i, &u, sizeof(UInt));
+    }
+}
+
+template<typename T>
+void writeArrayImpl(std::ostream& out, bool swap, const T* data, std::size_t count)
+{
+    if (!swap) {
+        out.write(reinterpret_cast<const char*>(data), std::streamsize(count * sizeof(T)));
+        return;
+    }
+
+    constexpr std::size_t blockSize = 1024;
+    std::array<T, blockSize> buffer {};
+    while (count > 0) {
+        std::size_t num = std::min(count, blockSize);
+        swapArray(data, buffer.data(), num);
+        out.write(reinterpret_cast<const char*>(buffer.data()), std::streamsize(num * sizeof(T)));
+        data += num;
+        count -= num;
+    }
+}
+
+template<typename T>
+void readArrayImpl(std::istream& in, bool swap, T* data, std::size_t count)
+{
+    in.read(reinterpret_cast<char*>(data), std::streamsize(count * sizeof(T)));
+    if (swap) {
+        swapArray(data, data, count);
+    }
+}
+
+}  // namespace
+
 Stream::Stream() = default;
 
 Stream::~Stream() = default;
@@ -150,6 +236,54 @@ OutputStream& OutputStream::operator<<(double d)
     return *this;
 }
 
+OutputStream& OutputStream::writeArray(const int16_t* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::writeArray(const uint16_t* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::writeArray(const int32_t* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::writeArray(const uint32_t* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::writeArray(const int64_t* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::writeArray(const uint64_t* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::writeArray(const float* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::writeArray(const double* data, std::size_t count)
+{
+    writeArrayImpl(_out, isSwapped(), data, count);
+    return *this;
+}
+
 InputStream::InputStream(std::istream& rin)
     : _in(rin)
 {}
@@ -246,6 +380,54 @@ InputStream& InputStream::operator>>(double& d)
     return *this;
 }
 
+InputStream& InputStream::readArray(int16_t* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
+InputStream& InputStream::readArray(uint16_t* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
+InputStream& InputStream::readArray(int32_t* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
+InputStream& InputStream::readArray(uint32_t* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
+InputStream& InputStream::readArray(int64_t* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
+InputStream& InputStream::readArray(uint64_t* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
+InputStream& InputStream::readArray(float* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
+InputStream& InputStream::readArray(double* data, std::size_t count)
+{
+    readArrayImpl(_in, isSwapped(), data, count);
+    return *this;
+}
+
 // ----------------------------------------------------------------------
 
 ByteArrayOStreambuf::ByteArrayOStreambuf(QByteArray& ba)
@@ -28,6 +28,7 @@
 #include <cstdint>
 #endif
 
+#include <cstddef>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -94,6 +95,27 @@ public:
     OutputStream& operator<<(float f);
     OutputStream& operator<<(double d);
 
+    /** @name Bulk output
+     * Writes \a count values at once. If the byte order matches the one of the machine the
+     * data is handed over to the underlying stream in a single call, otherwise it is swapped
+     * block-wise through a small buffer.
+     */
+    //@{
+    OutputStream& writeArray(const int16_t* data, std::size_t count);
+    OutputStream& writeArray(const uint16_t* data, std::size_t count);
+    OutputStream& writeArray(const int32_t* data, std::size_t count);
+    OutputStream& writeArray(const uint32_t* data, std::size_t count);
+    OutputStream& writeArray(const int64_t* data, std::size_t count);
+    OutputStream& writeArray(const uint64_t* data, std::size_t count);
+    OutputStream& writeArray(const float* data, std::size_t count);
+    OutputStream& writeArray(const double* data, std::size_t count);
+    template<typename T>
+    OutputStream& writeArray(const std::vector<T>& values)
+    {
+        return writeArray(values.data(), values.size());
+    }
+    //@}
+
     OutputStream(const OutputStream&) = delete;
     OutputStream(OutputStream&&) = delete;
     void operator=(const OutputStream&) = delete;
@@ -125,6 +147,27 @@ public:
     InputStream& operator>>(float& f);
     InputStream& operator>>(double& d);
 
+    /** @name Bulk input
+     * Reads \a count values at once into \a data which must provide space for them.
+     * Values are byte swapped in place afterwards if needed. The vector overload fills all
+     * elements of the already sized vector.
+     */
+    //@{
+    InputStream& readArray(int16_t* data, std::size_t count);
+    InputStream& readArray(uint16_t* data, std::size_t count);
+    InputStream& readArray(int32_t* data, std::size_t count);
+    InputStream& readArray(uint32_t* data, std::size_t count);
+    InputStream& readArray(int64_t* data, std::size_t count);
+    InputStream& readArray(uint64_t* data, std::size_t count);
+    InputStream& readArray(float* data, std::size_t count);
+    InputStream& readArray(double* data, std::size_t count);
+    template<typename T>
+    InputStream& readArray(std::vector<T>& values)
+    {
+        return readArray(values.data(), values.size());
+    }
+    //@}
+
     explicit operator bool() const
     {
         // test if _Ipfx succeeded
@@ -30,9 +30,11 @@
 #include "Writer.h"
 #include "Base64.h"
 #include "Base64Filter.h"
+#include "Console.h"
 #include "Exception.h"
 #include "FileInfo.h"
 #include "Persistence.h"
+#include "Reader.h"
 #include "Stream.h"
 #include "Tools.h"
 
@@ -325,25 +327,64 @@ void Writer::decInd()
 ZipWriter::ZipWriter(const char* FileName)
     : ZipStream(FileName)
 {
-#ifdef _MSC_VER
-    ZipStream.imbue(std::locale::empty());
-#else
-    ZipStream.imbue(std::locale::classic());
-#endif
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(ios::fixed, ios::floatfield);
+    setupStream(ZipStream);
 }
 
 ZipWriter::ZipWriter(std::ostream& os)
     : ZipStream(os)
+{
+    setupStream(ZipStream);
+}
+
+void ZipWriter::setupStream(std::ostream& str)
 {
 #ifdef _MSC_VER
-    ZipStream.imbue(std::locale::empty());
+    str.imbue(std::locale::empty());
 #else
-    ZipStream.imbue(std::locale::classic());
+    str.imbue(std::locale::classic());
 #endif
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(ios::fixed, ios::floatfield);
+    str.precision(std::numeric_limits<double>::digits10 + 1);
+    str.setf(ios::fixed, ios::floatfield);
+}
+
+void ZipWriter::putNextEntry(const char* str)
+{
+    finishEntry();
+
+    // Only the document files are converted, any other file with the extension xml may be
+    // read by something else than Base::XMLReader
+    std::string name(str);
+    if (getMode("BinaryXML") && !XMLReader::binaryFileName(name).empty()) {
+        XmlEntryName = name;
+        XmlStream = std::make_unique<std::stringstream>();
+        setupStream(*XmlStream);
+        return;
+    }
+    ZipStream.putNextEntry(str);
+}
+
+void ZipWriter::finishEntry()
+{
+    if (!XmlStream) {
+        return;
+    }
+
+    std::unique_ptr<std::stringstream> xml;
+    xml.swap(XmlStream);
+    std::stringstream binary;
+    try {
+        XMLReader::convertToBinary(*xml, binary);
+        ZipStream.putNextEntry(XMLReader::binaryFileName(XmlEntryName));
+        ZipStream << binary.rdbuf();
+    }
+    catch (const Base::Exception& e) {
+        // The text is still a valid document file
+        Base::Console().Warning("Failed to write binary XML (%s), keep text\n", e.what());
+        xml->clear();
+        xml->seekg(0);
+        ZipStream.putNextEntry(XmlEntryName);
+        ZipStream << xml->rdbuf();
+    }
 }
 
 void ZipWriter::writeFiles()
@@ -353,14 +394,20 @@ void ZipWriter::writeFiles()
     size_t index = 0;
     while (index < FileList.size()) {
         FileEntry entry = FileList[index];
-        ZipStream.putNextEntry(entry.FileName);
+        putNextEntry(entry.FileName.c_str());
         entry.Object->SaveDocFile(*this);
         index++;
     }
+    finishEntry();
 }
 
 ZipWriter::~ZipWriter()
 {
+    try {
+        finishEntry();
+    }
+    catch (...) {
+    }
     ZipStream.close();
 }
 
@@ -195,7 +195,7 @@ public:
 
     std::ostream& Stream() override
     {
-        return ZipStream;
+        return XmlStream ? *XmlStream : ZipStream;
     }
 
     void setComment(const char* str)
@@ -206,18 +206,28 @@ public:
     {
         ZipStream.setLevel(level);
     }
-    void putNextEntry(const char* str)
-    {
-        ZipStream.putNextEntry(str);
-    }
+    /** Starts the next file of the archive
+     * If the mode "BinaryXML" is set, the document files Document.xml and GuiDocument.xml
+     * are stored in the binary encoding of Base::XMLReader::convertToBinary(), under the name
+     * given by Base::XMLReader::binaryFileName().
+     */
+    void putNextEntry(const char* str);
 
     ZipWriter(const ZipWriter&) = delete;
     ZipWriter(ZipWriter&&) = delete;
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    void setupStream(std::ostream&);
+    /// writes the buffered XML of the current file in the binary encoding
+    void finishEntry();
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::unique_ptr<std::stringstream> XmlStream;
+    /// name of the buffered file, the entry is only started once its encoding is known
+    std::string XmlEntryName;
 };
 
 /** The StringWriter class
@@ -65,6 +65,8 @@ def createDocument(filename, outpath):
 
 def getFilesList(filename):
     """ Determine list of files referenced in a Document.xml or GuiDocument.xml """
+    if filename.endswith(".bxml"):
+        raise ValueError("Binary encoded document files are not supported: " + filename)
     dirname = os.path.dirname(filename)
     handler = DocumentHandler(dirname)
     parser = xml.sax.make_parser()
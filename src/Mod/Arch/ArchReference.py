@@ -256,6 +256,18 @@ class ArchReference:
                 return None
         return self.exists(filename)
 
+    def hasTextFile(self,zdoc,name):
+
+        "checks if a FCStd file contains the given xml file, binary encoded files cannot be read"
+
+        names = zdoc.namelist()
+        if name in names:
+            return True
+        binname = os.path.splitext(name)[0] + ".bxml"
+        if binname in names:
+            FreeCAD.Console.PrintError(translate("Arch","Unable to read the binary encoded file %s in %s. Save the referenced file without the BinaryXML option.") % (binname,zdoc.filename) + "\n")
+        return False
+
     def getPartsList(self,obj,filename=None):
 
         "returns a list of Part-based objects in a FCStd file"
@@ -266,6 +278,8 @@ class ArchReference:
         if not filename:
             return parts
         zdoc = zipfile.ZipFile(filename)
+        if not self.hasTextFile(zdoc,"Document.xml"):
+            return parts
         with zdoc.open("Document.xml") as docf:
             name = None
             label = None
@@ -322,7 +336,7 @@ class ArchReference:
         if not obj.Part:
             return None
         zdoc = zipfile.ZipFile(filename)
-        if not "GuiDocument.xml" in zdoc.namelist():
+        if not self.hasTextFile(zdoc,"GuiDocument.xml"):
             return None
         colorfile = None
         with zdoc.open("GuiDocument.xml") as docf:
@@ -627,7 +641,7 @@ class ViewProviderArchReference:
         if not obj.Part:
             return None
         zdoc = zipfile.ZipFile(filename)
-        if not "Document.xml" in zdoc.namelist():
+        if not obj.Proxy.hasTextFile(zdoc,"Document.xml"):
             return None
         ivfile = None
         with zdoc.open("Document.xml") as docf:
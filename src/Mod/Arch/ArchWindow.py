@@ -539,7 +539,7 @@ class _CommandWindow:
                             zfile = zipfile.ZipFile(path)
                             files = zfile.namelist()
                             # check for meta-file if it's really a FreeCAD document
-                            if files[0] == "Document.xml":
+                            if files[0] in ("Document.xml", "Document.bxml"):
                                 image="thumbnails/Thumbnail.png"
                                 if image in files:
                                     image = zfile.read(image)
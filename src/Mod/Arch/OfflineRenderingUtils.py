@@ -227,6 +227,8 @@ def getGuiData(filename):
                             for i in range(1,int(len(buf)/4)):
                                 cols.append((buf[i*4+3]/255.0,buf[i*4+2]/255.0,buf[i*4+1]/255.0,buf[i*4]/255.0))
                             guidata[key][propname]["value"] = cols
+        elif "GuiDocument.bxml" in zdoc.namelist():
+            print("Visual data of binary encoded file",filename,"cannot be read")
         zdoc.close()
         #print ("guidata:",guidata)
     return guidata
@@ -65,6 +65,7 @@
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Reader.h>
+#include <Base/Sequencer.h>
 #include <Base/Stream.h>
 #include <Base/TimeInfo.h>
 #include <Base/Writer.h>
@@ -909,8 +910,17 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
         nodes.push_back(aNode);
     }
 
+    // the workers advance the token, the launching thread shows it and checks for abort
+    Base::SequencerLauncher seq("Searching nodes in solid...", nodes.size());
+    Base::ProgressToken token(nodes.size());
+
 #pragma omp parallel for schedule(dynamic)
     for (auto aNode : nodes) {
+        if (!seq.poll(token)) {
+            continue;
+        }
+        token.next();
+
         double xyz[3];
         aNode->GetXYZ(xyz);
         Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
@@ -935,6 +945,8 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
             }
         }
     }
+
+    token.checkAbort();
     return result;
 }
 
@@ -37,6 +37,7 @@
 #include <QEventLoop>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QTimer>
 #include <QtConcurrentMap>
 #endif
 
@@ -938,26 +939,46 @@ App::DocumentObjectExecReturn* Feature::execute()
         // Build vector of increasing indices
         std::vector<unsigned long> index(count);
         std::iota(index.begin(), index.end(), 0);
+        // The workers advance the token, the event loop below shows it and checks for abort
+        std::stringstream str;
+        str << "Inspecting " << this->Label.getValue() << "...";
+        Base::SequencerLauncher seq(str.str().c_str(), count);
+        Base::ProgressToken token(count);
+        std::function<DistanceInspectionRMS(int)> fMapProgress = [&](unsigned int i) {
+            if (token.wasCanceled()) {
+                return DistanceInspectionRMS();
+            }
+            DistanceInspectionRMS result = fMap(i);
+            token.next();
+            return result;
+        };
         // Perform map-reduce operation : compute distances and update sum of squares for RMS
         // computation
         QFuture<DistanceInspectionRMS> future =
-            QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
-        // Setup progress bar
-        Base::FutureWatcherProgress progress("Inspecting...", actual->countPoints());
+            QtConcurrent::mappedReduced(index, fMapProgress, &DistanceInspectionRMS::operator+=);
         QFutureWatcher<DistanceInspectionRMS> watcher;
-        QObject::connect(&watcher,
-                         &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
-                         &progress,
-                         &Base::FutureWatcherProgress::progressValueChanged);
         // Keep UI responsive during computation
         QEventLoop loop;
         QObject::connect(&watcher,
                          &QFutureWatcher<DistanceInspectionRMS>::finished,
                          &loop,
                          &QEventLoop::quit);
+        QTimer timer;
+        QObject::connect(&timer, &QTimer::timeout, &loop, [&seq, &token]() {
+            seq.poll(token);
+        });
+        timer.start(100);
         watcher.setFuture(future);
         loop.exec();
+        timer.stop();
         res = future.result();
+        if (token.wasCanceled()) {
+            delete actual;
+            for (auto it : inspectNominal) {
+                delete it;
+            }
+            token.checkAbort();
+        }
     }
     else {
         // Single-threaded operation
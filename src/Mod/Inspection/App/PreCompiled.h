@@ -53,6 +53,7 @@
 #include <QEventLoop>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QTimer>
 #include <QtConcurrentMap>
 
 #endif  //_PreComp_
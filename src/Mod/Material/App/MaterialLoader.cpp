@@ -24,9 +24,15 @@
 #include <QString>
 #endif
 
+#include <QCryptographicHash>
+#include <QDateTime>
 #include <QDirIterator>
 #include <QFileInfo>
 #include <QMetaType>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QtConcurrentMap>
 
 #include <App/Application.h>
 #include <Base/Interpreter.h>
@@ -34,6 +40,7 @@
 
 #include "Materials.h"
 
+#include "Exceptions.h"
 #include "MaterialConfigLoader.h"
 #include "MaterialLibrary.h"
 #include "MaterialLoader.h"
@@ -43,6 +50,108 @@
 
 using namespace Materials;
 
+namespace
+{
+
+// What the library index knows about a card, so an unchanged card isn't read at startup
+struct MaterialIndexEntry
+{
+    qint64 modified = 0;
+    qint64 size = 0;
+    QString uuid;
+    QString name;
+    QString parentUuid;
+    QStringList physicalModels;
+    QStringList appearanceModels;
+};
+
+const char* const indexHeader = "FreeCAD material index 1";
+
+QString indexPath(const MaterialLibrary& library)
+{
+    QByteArray hash =
+        QCryptographicHash::hash(library.getDirectoryPath().toUtf8(), QCryptographicHash::Md5);
+    QDir cacheDir(QString::fromStdString(App::Application::getUserCachePath()));
+    return cacheDir.filePath(QString::fromStdString("Material/") + QString::fromLatin1(hash.toHex())
+                             + QString::fromStdString(".index"));
+}
+
+// Read the index of the library, keyed by the path of the card relative to the library
+std::map<QString, MaterialIndexEntry> readIndex(const MaterialLibrary& library)
+{
+    std::map<QString, MaterialIndexEntry> index;
+
+    QFile file(indexPath(library));
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return index;
+    }
+    QTextStream stream(&file);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    stream.setCodec("UTF-8");
+#endif
+
+    QString tab = QString::fromStdString("\t");
+    QString comma = QString::fromStdString(",");
+    QStringList header = stream.readLine().split(tab);
+    if (header.size() != 2 || header[0] != QString::fromStdString(indexHeader)
+        || header[1] != library.getDirectoryPath()) {
+        return index;
+    }
+
+    while (!stream.atEnd()) {
+        QStringList fields = stream.readLine().split(tab);
+        if (fields.size() != 8) {
+            continue;
+        }
+        MaterialIndexEntry entry;
+        entry.modified = fields[1].toLongLong();
+        entry.size = fields[2].toLongLong();
+        entry.uuid = fields[3];
+        entry.name = fields[4];
+        entry.parentUuid = fields[5];
+        if (!fields[6].isEmpty()) {
+            entry.physicalModels = fields[6].split(comma);
+        }
+        if (!fields[7].isEmpty()) {
+            entry.appearanceModels = fields[7].split(comma);
+        }
+        index[fields[0]] = entry;
+    }
+
+    return index;
+}
+
+void writeIndex(const MaterialLibrary& library, const std::map<QString, MaterialIndexEntry>& index)
+{
+    QString path = indexPath(library);
+    QDir().mkpath(QFileInfo(path).path());
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        Base::Console().Log("Unable to write material index '%s'\n", path.toStdString().c_str());
+        return;
+    }
+    QTextStream stream(&file);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    stream.setCodec("UTF-8");
+#endif
+
+    QString tab = QString::fromStdString("\t");
+    QString comma = QString::fromStdString(",");
+    stream << QString::fromStdString(indexHeader) << tab << library.getDirectoryPath() << "\n";
+    for (auto& it : index) {
+        const MaterialIndexEntry& entry = it.second;
+        stream << it.first << tab << entry.modified << tab << entry.size << tab << entry.uuid
+               << tab << entry.name << tab << entry.parentUuid << tab
+               << entry.physicalModels.join(comma) << tab << entry.appearanceModels.join(comma)
+               << "\n";
+    }
+    stream.flush();
+    file.commit();
+}
+
+}  // namespace
+
 MaterialEntry::MaterialEntry(const std::shared_ptr<MaterialLibrary>& library,
                              const QString& modelName,
                              const QString& dir,
@@ -160,8 +269,7 @@ std::shared_ptr<Material3DArray> MaterialYamlEntry::read3DArray(const YAML::Node
     return array3d;
 }
 
-void MaterialYamlEntry::addToTree(
-    std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap)
+std::shared_ptr<Material> MaterialYamlEntry::makeMaterial()
 {
     std::set<QString> exclude;
     exclude.insert(QString::fromStdString("General"));
@@ -306,13 +414,22 @@ void MaterialYamlEntry::addToTree(
         }
     }
 
-    QString path = QDir(directory).absolutePath();
+    return finalModel;
+}
+
+void MaterialYamlEntry::addToTree(
+    std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap)
+{
+    auto finalModel = makeMaterial();
+
+    QString path = QDir(getDirectory()).absolutePath();
     // Base::Console().Log("\tPath '%s'\n", path.toStdString().c_str());
-    (*materialMap)[uuid] = library->addMaterial(finalModel, path);
+    (*materialMap)[getUUID()] = getLibrary()->addMaterial(finalModel, path);
 }
 
 std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>>
     MaterialLoader::_materialEntryMap = nullptr;
+QMutex MaterialLoader::_mutex;
 
 MaterialLoader::MaterialLoader(
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap,
@@ -382,6 +499,17 @@ MaterialLoader::getMaterialFromPath(std::shared_ptr<MaterialLibrary> library,
         return model;
     }
 
+    return getMaterialFromYAMLPath(library, path);
+}
+
+// Only reads the file, so cards can be read in parallel
+std::shared_ptr<MaterialEntry>
+MaterialLoader::getMaterialFromYAMLPath(std::shared_ptr<MaterialLibrary> library,
+                                        const QString& path) const
+{
+    std::shared_ptr<MaterialEntry> model = nullptr;
+    std::string pathName = path.toStdString();
+
     YAML::Node yamlroot;
     try {
         yamlroot = YAML::LoadFile(pathName);
@@ -434,6 +562,11 @@ void MaterialLoader::dereference(
             return;
         }
 
+        // The values come from the parent's card, so it has to be read first
+        if (material->isLoaded()) {
+            load(materialMap, parent);
+        }
+
         // Ensure the parent has been dereferenced
         dereference(materialMap, parent);
 
@@ -453,6 +586,11 @@ void MaterialLoader::dereference(
             }
         }
 
+        // Until its card is read a material only inherits the models
+        if (!material->isLoaded()) {
+            return;
+        }
+
         // Add values
         auto properties = parent->getPhysicalProperties();
         for (auto itp = properties.begin(); itp != properties.end(); itp++) {
@@ -483,29 +621,171 @@ void MaterialLoader::dereference(std::shared_ptr<Material> material)
     dereference(_materialMap, material);
 }
 
+void MaterialLoader::load(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap,
+                          std::shared_ptr<Material> material)
+{
+    if (material->isLoaded()) {
+        return;
+    }
+
+    loadCard(material);
+    dereference(materialMap, material);
+}
+
+void MaterialLoader::loadCard(std::shared_ptr<Material> material)
+{
+    QMutexLocker locker(&_mutex);
+    if (material->isLoaded()) {
+        return;
+    }
+
+    auto library = material->getLibrary();
+    // The directory is relative to the library, getLocalPath() expects it to start with a '/'
+    QString path =
+        library->getLocalPath(QString::fromStdString("/") + material->getDirectory());
+    std::string pathName = path.toStdString();
+
+    std::shared_ptr<Material> card;
+    YAML::Node yamlroot;
+    try {
+        yamlroot = YAML::LoadFile(pathName);
+
+        MaterialYamlEntry entry(library,
+                                material->getName(),
+                                path,
+                                material->getUUID(),
+                                yamlroot);
+        card = entry.makeMaterial();
+    }
+    catch (YAML::Exception const& e) {
+        Base::Console().Error("YAML parsing error: '%s'\n", pathName.c_str());
+        Base::Console().Error("\t'%s'\n", e.what());
+        showYaml(yamlroot);
+    }
+
+    if (card) {
+        // Keep the place in the library the material was indexed with
+        card->setLibrary(library);
+        card->setDirectory(material->getDirectory());
+        *material = *card;
+    }
+
+    // Don't try again if the card can't be read
+    material->setLoaded(true);
+}
+
 void MaterialLoader::loadLibrary(std::shared_ptr<MaterialLibrary> library)
 {
     if (_materialEntryMap == nullptr) {
         _materialEntryMap = std::make_unique<std::map<QString, std::shared_ptr<MaterialEntry>>>();
     }
 
+    struct Card
+    {
+        QString path;
+        qint64 modified;
+        qint64 size;
+        const MaterialIndexEntry* indexed;
+        bool configStyle;
+        std::shared_ptr<MaterialEntry> entry;
+    };
+
+    // Cards that haven't changed since the index was written aren't read until they are used
+    auto index = readIndex(*library);
+    std::vector<Card> cards;
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
         auto pathname = it.next();
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
-                auto model = getMaterialFromPath(library, file.canonicalFilePath());
-                if (model) {
-                    (*_materialEntryMap)[model->getUUID()] = model;
+                Card card {file.canonicalFilePath(),
+                           file.lastModified().toMSecsSinceEpoch(),
+                           file.size(),
+                           nullptr,
+                           false,
+                           nullptr};
+                auto found = index.find(library->getRelativePath(card.path));
+                if (found != index.end() && found->second.modified == card.modified
+                    && found->second.size == card.size) {
+                    card.indexed = &found->second;
                 }
+                cards.push_back(card);
+            }
+        }
+    }
+
+    // Read the other cards in parallel
+    QtConcurrent::blockingMap(cards, [this, &library](Card& card) {
+        if (card.indexed) {
+            return;
+        }
+        if (MaterialConfigLoader::isConfigStyle(card.path)) {
+            // Old format cards are read below, one at a time
+            card.configStyle = true;
+            return;
+        }
+        card.entry = getMaterialFromYAMLPath(library, card.path);
+    });
+
+    std::vector<std::shared_ptr<MaterialEntry>> entries;
+    std::size_t indexedCount = 0;
+    for (auto& card : cards) {
+        if (card.indexed) {
+            const MaterialIndexEntry& indexed = *card.indexed;
+            auto material =
+                std::make_shared<Material>(library, card.path, indexed.uuid, indexed.name);
+            material->setParentUUID(indexed.parentUuid);
+            for (auto& model : indexed.physicalModels) {
+                material->addPhysical(model);
+            }
+            for (auto& model : indexed.appearanceModels) {
+                material->addAppearance(model);
             }
+            material->setLoaded(false);
+            (*_materialMap)[indexed.uuid] = library->addMaterial(material, card.path);
+            indexedCount++;
+        }
+        else if (card.configStyle) {
+            getMaterialFromPath(library, card.path);
         }
+        else if (card.entry) {
+            (*_materialEntryMap)[card.entry->getUUID()] = card.entry;
+            entries.push_back(card.entry);
+        }
+    }
+
+    for (auto& entry : entries) {
+        entry->addToTree(_materialMap);
     }
 
-    for (auto it = _materialEntryMap->begin(); it != _materialEntryMap->end(); it++) {
-        it->second->addToTree(_materialMap);
+    // Update the index if any card was read or removed
+    if (entries.empty() && indexedCount == index.size()) {
+        return;
+    }
+    std::map<QString, MaterialIndexEntry> newIndex;
+    for (auto& card : cards) {
+        if (!card.indexed && !card.entry) {
+            continue;
+        }
+        std::shared_ptr<Material> material;
+        try {
+            material = library->getMaterialByPath(card.path);
+        }
+        catch (const MaterialNotFound&) {
+            continue;
+        }
+        MaterialIndexEntry entry;
+        entry.modified = card.modified;
+        entry.size = card.size;
+        entry.uuid = material->getUUID();
+        entry.name = material->getName();
+        entry.parentUuid = material->getParentUUID();
+        entry.physicalModels = *material->getPhysicalModels();
+        entry.appearanceModels = *material->getAppearanceModels();
+        newIndex[library->getRelativePath(card.path)] = entry;
     }
+    writeIndex(*library, newIndex);
 }
 
 void MaterialLoader::loadLibraries()
@@ -25,6 +25,7 @@
 #include <memory>
 
 #include <QDir>
+#include <QMutex>
 #include <QString>
 #include <yaml-cpp/yaml.h>
 
@@ -83,6 +84,7 @@ public:
 
     void
     addToTree(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap) override;
+    std::shared_ptr<Material> makeMaterial();
 
     const YAML::Node& getModel() const
     {
@@ -105,7 +107,7 @@ private:
     YAML::Node _model;
 };
 
-class MaterialLoader
+class MaterialsExport MaterialLoader
 {
 public:
     MaterialLoader(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap,
@@ -121,6 +123,8 @@ public:
     std::shared_ptr<MaterialEntry> getMaterialFromYAML(std::shared_ptr<MaterialLibrary> library,
                                                        YAML::Node& yamlroot,
                                                        const QString& path) const;
+    static void load(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap,
+                     std::shared_ptr<Material> material);
 
 private:
     MaterialLoader();
@@ -129,11 +133,15 @@ private:
     void dereference(std::shared_ptr<Material> material);
     std::shared_ptr<MaterialEntry> getMaterialFromPath(std::shared_ptr<MaterialLibrary> library,
                                                        const QString& path) const;
+    std::shared_ptr<MaterialEntry>
+    getMaterialFromYAMLPath(std::shared_ptr<MaterialLibrary> library, const QString& path) const;
+    static void loadCard(std::shared_ptr<Material> material);
     void addLibrary(std::shared_ptr<MaterialLibrary> model);
     void loadLibrary(std::shared_ptr<MaterialLibrary> library);
     void loadLibraries();
 
     static std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>> _materialEntryMap;
+    static QMutex _mutex;
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> _materialMap;
     std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> _libraryList;
 };
@@ -109,14 +109,27 @@ bool MaterialManager::isMaterial(const QFileInfo& file)
     return false;
 }
 
+// Reads all the cards that haven't been used yet
+std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> MaterialManager::getMaterials()
+{
+    for (auto& it : *_materialMap) {
+        MaterialLoader::load(_materialMap, it.second);
+    }
+    return _materialMap;
+}
+
 std::shared_ptr<Material> MaterialManager::getMaterial(const QString& uuid) const
 {
+    std::shared_ptr<Material> material;
     try {
-        return _materialMap->at(uuid);
+        material = _materialMap->at(uuid);
     }
     catch (std::out_of_range&) {
         throw MaterialNotFound();
     }
+
+    MaterialLoader::load(_materialMap, material);
+    return material;
 }
 
 std::shared_ptr<Material> MaterialManager::getMaterialByPath(const QString& path) const
@@ -134,7 +147,9 @@ std::shared_ptr<Material> MaterialManager::getMaterialByPath(const QString& path
             //                     library->getDirectory().toStdString().c_str());
             // Base::Console().Log("MaterialManager::getMaterialByPath() Path '%s'\n",
             //                     cleanPath.toStdString().c_str());
-            return library->getMaterialByPath(cleanPath);
+            auto material = library->getMaterialByPath(cleanPath);
+            MaterialLoader::load(_materialMap, material);
+            return material;
         }
     }
     Base::Console().Log("MaterialManager::getMaterialByPath() Library not found for path '%s'\n",
@@ -146,8 +161,10 @@ std::shared_ptr<Material> MaterialManager::getMaterialByPath(const QString& path
 std::shared_ptr<Material> MaterialManager::getMaterialByPath(const QString& path,
                                                              const QString& lib) const
 {
-    auto library = getLibrary(lib);           // May throw LibraryNotFound
-    return library->getMaterialByPath(path);  // May throw MaterialNotFound
+    auto library = getLibrary(lib);                    // May throw LibraryNotFound
+    auto material = library->getMaterialByPath(path);  // May throw MaterialNotFound
+    MaterialLoader::load(_materialMap, material);
+    return material;
 }
 
 bool MaterialManager::exists(const QString& uuid) const
@@ -228,7 +245,9 @@ MaterialManager::materialsWithModel(QString uuid)
         QString key = it->first;
         auto material = it->second;
 
+        // The index knows the models of a card, the values are only read when it is returned
         if (material->hasModel(uuid)) {
+            MaterialLoader::load(_materialMap, material);
             (*dict)[key] = material;
         }
     }
@@ -246,6 +265,11 @@ MaterialManager::materialsWithModelComplete(QString uuid)
         QString key = it->first;
         auto material = it->second;
 
+        // Only the cards with the model have to be read to check the values
+        if (!material->hasModel(uuid)) {
+            continue;
+        }
+        MaterialLoader::load(_materialMap, material);
         if (material->isModelComplete(uuid)) {
             (*dict)[key] = material;
         }
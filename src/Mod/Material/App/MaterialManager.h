@@ -48,10 +48,7 @@ public:
     MaterialManager();
     ~MaterialManager() override = default;
 
-    std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> getMaterials()
-    {
-        return _materialMap;
-    }
+    std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> getMaterials();
     std::shared_ptr<Material> getMaterial(const QString& uuid) const;
     std::shared_ptr<Material> getMaterialByPath(const QString& path) const;
     std::shared_ptr<Material> getMaterialByPath(const QString& path, const QString& library) const;
@@ -425,6 +425,7 @@ TYPESYSTEM_SOURCE(Materials::Material, Base::BaseClass)
 
 Material::Material()
     : _dereferenced(false)
+    , _loaded(true)
     , _editState(ModelEdit_None)
 {}
 
@@ -436,6 +437,7 @@ Material::Material(const std::shared_ptr<MaterialLibrary>& library,
     , _uuid(uuid)
     , _name(name)
     , _dereferenced(false)
+    , _loaded(true)
     , _editState(ModelEdit_None)
 {
     setDirectory(directory);
@@ -453,6 +455,7 @@ Material::Material(const Material& other)
     , _url(other._url)
     , _reference(other._reference)
     , _dereferenced(other._dereferenced)
+    , _loaded(other._loaded)
     , _editState(other._editState)
 {
     for (auto& it : other._tags) {
@@ -1340,6 +1343,7 @@ Material& Material::operator=(const Material& other)
     _url = other._url;
     _reference = other._reference;
     _dereferenced = other._dereferenced;
+    _loaded = other._loaded;
     _editState = other._editState;
 
     _tags.clear();
@@ -322,6 +322,18 @@ public:
         _dereferenced = true;
     }
 
+    /*
+     * Materials created from a library index only know their models until the card is read
+     */
+    bool isLoaded() const
+    {
+        return _loaded;
+    }
+    void setLoaded(bool loaded)
+    {
+        _loaded = loaded;
+    }
+
     /*
      * Normalize models by removing any inherited models
      */
@@ -387,6 +399,7 @@ private:
     std::map<QString, std::shared_ptr<MaterialProperty>> _physical;
     std::map<QString, std::shared_ptr<MaterialProperty>> _appearance;
     bool _dereferenced;
+    bool _loaded;
     ModelEdit _editState;
 };
 
@@ -901,17 +901,37 @@ void MeshKernel::Write(std::ostream& rclOut) const
     // write the number of points and facets
     str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
 
-    // write the data
-    for (const auto& it : _aclPointArray) {
-        str << it.x << it.y << it.z;
-    }
-
-    for (const auto& it : _aclFacetArray) {
-        str << static_cast<uint32_t>(it._aulPoints[0]) << static_cast<uint32_t>(it._aulPoints[1])
-            << static_cast<uint32_t>(it._aulPoints[2]);
-        str << static_cast<uint32_t>(it._aulNeighbours[0])
-            << static_cast<uint32_t>(it._aulNeighbours[1])
-            << static_cast<uint32_t>(it._aulNeighbours[2]);
+    // write the data block-wise to avoid a stream call per value
+    const std::size_t blockSize = 4096;
+    std::vector<float> coords;
+    coords.reserve(3 * blockSize);
+    for (std::size_t i = 0; i < _aclPointArray.size(); i += blockSize) {
+        std::size_t last = std::min(i + blockSize, _aclPointArray.size());
+        coords.clear();
+        for (std::size_t j = i; j < last; j++) {
+            const MeshPoint& pnt = _aclPointArray[j];
+            coords.push_back(pnt.x);
+            coords.push_back(pnt.y);
+            coords.push_back(pnt.z);
+        }
+        str.writeArray(coords);
+    }
+
+    std::vector<uint32_t> indices;
+    indices.reserve(6 * blockSize);
+    for (std::size_t i = 0; i < _aclFacetArray.size(); i += blockSize) {
+        std::size_t last = std::min(i + blockSize, _aclFacetArray.size());
+        indices.clear();
+        for (std::size_t j = i; j < last; j++) {
+            const MeshFacet& face = _aclFacetArray[j];
+            indices.push_back(static_cast<uint32_t>(face._aulPoints[0]));
+            indices.push_back(static_cast<uint32_t>(face._aulPoints[1]));
+            indices.push_back(static_cast<uint32_t>(face._aulPoints[2]));
+            indices.push_back(static_cast<uint32_t>(face._aulNeighbours[0]));
+            indices.push_back(static_cast<uint32_t>(face._aulNeighbours[1]));
+            indices.push_back(static_cast<uint32_t>(face._aulNeighbours[2]));
+        }
+        str.writeArray(indices);
     }
 
     str << _clBoundBox.MinX << _clBoundBox.MaxX;
@@ -956,19 +976,37 @@ void MeshKernel::Read(std::istream& rclIn)
         str >> uCtPts >> uCtFts;
 
         try {
-            // read the data
+            // read the data block-wise to avoid a stream call per value
+            const std::size_t blockSize = 4096;
             MeshPointArray pointArray;
             pointArray.resize(uCtPts);
-            for (auto& it : pointArray) {
-                str >> it.x >> it.y >> it.z;
+            std::vector<float> coords(3 * blockSize);
+            for (std::size_t i = 0; i < pointArray.size(); i += blockSize) {
+                std::size_t num = std::min(blockSize, pointArray.size() - i);
+                str.readArray(coords.data(), 3 * num);
+                for (std::size_t j = 0; j < num; j++) {
+                    pointArray[i + j].Set(coords[3 * j], coords[3 * j + 1], coords[3 * j + 2]);
+                }
             }
 
             MeshFacetArray facetArray;
             facetArray.resize(uCtFts);
 
+            std::vector<uint32_t> indices(6 * blockSize);
+            std::size_t index = blockSize;
             uint32_t v1 {}, v2 {}, v3 {};
-            for (auto& it : facetArray) {
-                str >> v1 >> v2 >> v3;
+            for (std::size_t i = 0; i < facetArray.size(); i++, index++) {
+                if (index == blockSize) {
+                    std::size_t num = std::min(blockSize, facetArray.size() - i);
+                    str.readArray(indices.data(), 6 * num);
+                    index = 0;
+                }
+
+                MeshFacet& it = facetArray[i];
+                const uint32_t* values = indices.data() + 6 * index;
+                v1 = values[0];
+                v2 = values[1];
+                v3 = values[2];
 
                 // make sure to have valid indices
                 if (v1 >= uCtPts || v2 >= uCtPts || v3 >= uCtPts) {
@@ -983,7 +1021,9 @@ void MeshKernel::Read(std::istream& rclIn)
                 // the empty neighbour must be explicitly set to 'FACET_INDEX_MAX'
                 // because in algorithms this value is always used to check
                 // for open edges.
-                str >> v1 >> v2 >> v3;
+                v1 = values[3];
+                v2 = values[4];
+                v3 = values[5];
 
                 // make sure to have valid indices
                 if (v1 >= uCtFts && v1 < open_edge) {
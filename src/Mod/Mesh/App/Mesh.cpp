@@ -61,17 +61,19 @@ const float MeshObject::Epsilon = 1.0e-5F;
 TYPESYSTEM_SOURCE(Mesh::MeshObject, Data::ComplexGeoData)
 TYPESYSTEM_SOURCE(Mesh::MeshSegment, Data::Segment)
 
-MeshObject::MeshObject() = default;
+MeshObject::MeshObject()
+    : _kernel(std::make_shared<MeshCore::MeshKernel>())
+{}
 
 MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel)  // NOLINT
-    : _kernel(Kernel)
+    : _kernel(std::make_shared<MeshCore::MeshKernel>(Kernel))
 {
     // copy the mesh structure
 }
 
 MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel, const Base::Matrix4D& Mtrx)  // NOLINT
     : _Mtrx(Mtrx)
-    , _kernel(Kernel)
+    , _kernel(std::make_shared<MeshCore::MeshKernel>(Kernel))
 {
     // copy the mesh structure
 }
@@ -80,7 +82,7 @@ MeshObject::MeshObject(const MeshObject& mesh)
     : _Mtrx(mesh._Mtrx)
     , _kernel(mesh._kernel)
 {
-    // copy the mesh structure
+    // share the mesh structure until one of the meshes is modified
     copySegments(mesh);
 }
 
@@ -88,7 +90,7 @@ MeshObject::MeshObject(MeshObject&& mesh)
     : _Mtrx(mesh._Mtrx)
     , _kernel(mesh._kernel)
 {
-    // copy the mesh structure
+    // share the mesh structure until one of the meshes is modified
     copySegments(mesh);
 }
 
@@ -174,8 +176,8 @@ Base::Matrix4D MeshObject::getTransform() const
 
 Base::BoundBox3d MeshObject::getBoundBox() const
 {
-    _kernel.RecalcBoundBox();
-    Base::BoundBox3f Bnd = _kernel.GetBoundBox();
+    kernel().RecalcBoundBox();
+    Base::BoundBox3f Bnd = kernel().GetBoundBox();
 
     Base::BoundBox3d Bnd2;
     if (Bnd.IsValid()) {
@@ -189,7 +191,7 @@ Base::BoundBox3d MeshObject::getBoundBox() const
 
 bool MeshObject::getCenterOfGravity(Base::Vector3d& center) const
 {
-    MeshCore::MeshAlgorithm alg(_kernel);
+    MeshCore::MeshAlgorithm alg(kernel());
     Base::Vector3f pnt = alg.GetGravityPoint();
     center = transformPointToOutside(pnt);
     return true;
@@ -218,7 +220,7 @@ void MeshObject::swapSegments(MeshObject& mesh)
 MeshObject& MeshObject::operator=(const MeshObject& mesh)
 {
     if (this != &mesh) {
-        // copy the mesh structure
+        // share the mesh structure until one of the meshes is modified
         setTransform(mesh._Mtrx);
         this->_kernel = mesh._kernel;
         copySegments(mesh);
@@ -230,7 +232,7 @@ MeshObject& MeshObject::operator=(const MeshObject& mesh)
 MeshObject& MeshObject::operator=(MeshObject&& mesh)
 {
     if (this != &mesh) {
-        // copy the mesh structure
+        // share the mesh structure
         setTransform(mesh._Mtrx);
         this->_kernel = mesh._kernel;
         copySegments(mesh);
@@ -239,15 +241,34 @@ MeshObject& MeshObject::operator=(MeshObject&& mesh)
     return *this;
 }
 
+MeshCore::MeshKernel& MeshObject::kernel()
+{
+    return flagKernel();
+}
+
+MeshCore::MeshKernel& MeshObject::flagKernel() const
+{
+    if (_kernel.use_count() > 1) {
+        _kernel = std::make_shared<MeshCore::MeshKernel>(*_kernel);
+    }
+    return *_kernel;
+}
+
 void MeshObject::setKernel(const MeshCore::MeshKernel& m)
 {
-    this->_kernel = m;
+    if (_kernel.use_count() > 1) {
+        // no need to copy the shared kernel only to overwrite it
+        _kernel = std::make_shared<MeshCore::MeshKernel>(m);
+    }
+    else {
+        *_kernel = m;
+    }
     this->_segments.clear();
 }
 
 void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 {
-    this->_kernel.Swap(Kernel);
+    this->kernel().Swap(Kernel);
     // clear the segments because we don't know how the new
     // topology looks like
     this->_segments.clear();
@@ -255,7 +276,13 @@ void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 
 void MeshObject::swap(MeshObject& mesh)
 {
-    this->_kernel.Swap(mesh._kernel);
+    if (_kernel.use_count() > 1 || mesh._kernel.use_count() > 1) {
+        // swapping the shared kernels avoids copying them
+        this->_kernel.swap(mesh._kernel);
+    }
+    else {
+        this->_kernel->Swap(*mesh._kernel);
+    }
     swapSegments(mesh);
     Base::Matrix4D tmp = this->_Mtrx;
     this->_Mtrx = mesh._Mtrx;
@@ -265,7 +292,7 @@ void MeshObject::swap(MeshObject& mesh)
 std::string MeshObject::representation() const
 {
     std::stringstream str;
-    MeshCore::MeshInfo info(_kernel);
+    MeshCore::MeshInfo info(kernel());
     info.GeneralInformation(str);
     return str.str();
 }
@@ -273,24 +300,24 @@ std::string MeshObject::representation() const
 std::string MeshObject::topologyInfo() const
 {
     std::stringstream str;
-    MeshCore::MeshInfo info(_kernel);
+    MeshCore::MeshInfo info(kernel());
     info.TopologyInformation(str);
     return str.str();
 }
 
 unsigned long MeshObject::countPoints() const
 {
-    return _kernel.CountPoints();
+    return kernel().CountPoints();
 }
 
 unsigned long MeshObject::countFacets() const
 {
-    return _kernel.CountFacets();
+    return kernel().CountFacets();
 }
 
 unsigned long MeshObject::countEdges() const
 {
-    return _kernel.CountEdges();
+    return kernel().CountEdges();
 }
 
 unsigned long MeshObject::countSegments() const
@@ -300,23 +327,23 @@ unsigned long MeshObject::countSegments() const
 
 bool MeshObject::isSolid() const
 {
-    MeshCore::MeshEvalSolid cMeshEval(_kernel);
+    MeshCore::MeshEvalSolid cMeshEval(kernel());
     return cMeshEval.Evaluate();
 }
 
 double MeshObject::getSurface() const
 {
-    return _kernel.GetSurface();
+    return kernel().GetSurface();
 }
 
 double MeshObject::getVolume() const
 {
-    return _kernel.GetVolume();
+    return kernel().GetVolume();
 }
 
 Base::Vector3d MeshObject::getPoint(PointIndex index) const
 {
-    MeshCore::MeshPoint vertf = _kernel.GetPoint(index);
+    MeshCore::MeshPoint vertf = kernel().GetPoint(index);
     Base::Vector3d vertd(vertf.x, vertf.y, vertf.z);
     vertd = _Mtrx * vertd;
     return vertd;
@@ -333,14 +360,14 @@ void MeshObject::getPoints(std::vector<Base::Vector3d>& Points,
                            double /*Accuracy*/,
                            uint16_t /*flags*/) const
 {
-    Points = transformPointsToOutside(_kernel.GetPoints());
-    MeshCore::MeshRefNormalToPoints ptNormals(_kernel);
+    Points = transformPointsToOutside(kernel().GetPoints());
+    MeshCore::MeshRefNormalToPoints ptNormals(kernel());
     Normals = transformVectorsToOutside(ptNormals.GetValues());
 }
 
 Mesh::Facet MeshObject::getMeshFacet(FacetIndex index) const
 {
-    Mesh::Facet face(_kernel.GetFacets()[index], this, index);
+    Mesh::Facet face(kernel().GetFacets()[index], this, index);
     return face;
 }
 
@@ -349,14 +376,14 @@ void MeshObject::getFaces(std::vector<Base::Vector3d>& Points,
                           double /*Accuracy*/,
                           uint16_t /*flags*/) const
 {
-    unsigned long ctpoints = _kernel.CountPoints();
+    unsigned long ctpoints = kernel().CountPoints();
     Points.reserve(ctpoints);
     for (unsigned long i = 0; i < ctpoints; i++) {
         Points.push_back(getPoint(i));
     }
 
-    unsigned long ctfacets = _kernel.CountFacets();
-    const MeshCore::MeshFacetArray& ary = _kernel.GetFacets();
+    unsigned long ctfacets = kernel().CountFacets();
+    const MeshCore::MeshFacetArray& ary = kernel().GetFacets();
     Topo.reserve(ctfacets);
     for (unsigned long i = 0; i < ctfacets; i++) {
         Facet face {};
@@ -369,7 +396,7 @@ void MeshObject::getFaces(std::vector<Base::Vector3d>& Points,
 
 unsigned int MeshObject::getMemSize() const
 {
-    return _kernel.GetMemSize();
+    return kernel().GetMemSize();
 }
 
 void MeshObject::Save(Base::Writer& /*writer*/) const
@@ -379,7 +406,7 @@ void MeshObject::Save(Base::Writer& /*writer*/) const
 
 void MeshObject::SaveDocFile(Base::Writer& writer) const
 {
-    _kernel.Write(writer.Stream());
+    kernel().Write(writer.Stream());
 }
 
 void MeshObject::Restore(Base::XMLReader& /*reader*/)
@@ -397,7 +424,7 @@ void MeshObject::save(const char* file,
                       const MeshCore::Material* mat,
                       const char* objectname) const
 {
-    MeshCore::MeshOutput aWriter(this->_kernel, mat);
+    MeshCore::MeshOutput aWriter(this->kernel(), mat);
     if (objectname) {
         aWriter.SetObjectName(objectname);
     }
@@ -428,7 +455,7 @@ void MeshObject::save(std::ostream& str,
                       const MeshCore::Material* mat,
                       const char* objectname) const
 {
-    MeshCore::MeshOutput aWriter(this->_kernel, mat);
+    MeshCore::MeshOutput aWriter(this->kernel(), mat);
     if (objectname) {
         aWriter.SetObjectName(objectname);
     }
@@ -476,12 +503,12 @@ bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::M
 
 void MeshObject::swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std::string>& g)
 {
-    _kernel.Swap(kernel);
+    this->kernel().Swap(kernel);
     // Some file formats define several objects per file (e.g. OBJ).
     // Now we mark each object as an own segment so that we can break
     // the object into its original objects again.
     this->_segments.clear();
-    const MeshCore::MeshFacetArray& faces = _kernel.GetFacets();
+    const MeshCore::MeshFacetArray& faces = this->kernel().GetFacets();
     MeshCore::MeshFacetArray::_TConstIterator it;
     std::vector<FacetIndex> segment;
     segment.reserve(faces.size());
@@ -514,24 +541,24 @@ void MeshObject::swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std:
 
 void MeshObject::save(std::ostream& out) const
 {
-    _kernel.Write(out);
+    kernel().Write(out);
 }
 
 void MeshObject::load(std::istream& in)
 {
-    _kernel.Read(in);
+    kernel().Read(in);
     this->_segments.clear();
 
 #ifndef FC_DEBUG
     try {
-        MeshCore::MeshEvalNeighbourhood nb(_kernel);
+        MeshCore::MeshEvalNeighbourhood nb(kernel());
         if (!nb.Evaluate()) {
             Base::Console().Warning("Errors in neighbourhood of mesh found...");
-            _kernel.RebuildNeighbours();
+            kernel().RebuildNeighbours();
             Base::Console().Warning("fixed\n");
         }
 
-        MeshCore::MeshEvalTopology eval(_kernel);
+        MeshCore::MeshEvalTopology eval(kernel());
         if (!eval.Evaluate()) {
             Base::Console().Warning("The mesh data structure has some defects\n");
         }
@@ -573,24 +600,24 @@ void MeshObject::writeInventor(std::ostream& str, float creaseangle) const
 
 void MeshObject::addFacet(const MeshCore::MeshGeomFacet& facet)
 {
-    _kernel.AddFacet(facet);
+    kernel().AddFacet(facet);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
-    _kernel.AddFacets(facets);
+    kernel().AddFacets(facets);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets, bool checkManifolds)
 {
-    _kernel.AddFacets(facets, checkManifolds);
+    kernel().AddFacets(facets, checkManifolds);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets,
                            const std::vector<Base::Vector3f>& points,
                            bool checkManifolds)
 {
-    _kernel.AddFacets(facets, points, checkManifolds);
+    kernel().AddFacets(facets, points, checkManifolds);
 }
 
 void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facets,
@@ -614,12 +641,15 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
         point_v.push_back(p);
     }
 
-    _kernel.AddFacets(facet_v, point_v, checkManifolds);
+    kernel().AddFacets(facet_v, point_v, checkManifolds);
 }
 
 void MeshObject::setFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
-    _kernel = facets;
+    if (_kernel.use_count() > 1) {
+        _kernel = std::make_shared<MeshCore::MeshKernel>();
+    }
+    *_kernel = facets;
 }
 
 void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facets,
@@ -642,17 +672,17 @@ void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
         point_v.push_back(p);
     }
 
-    _kernel.Adopt(point_v, facet_v, true);
+    kernel().Adopt(point_v, facet_v, true);
 }
 
 void MeshObject::addMesh(const MeshObject& mesh)
 {
-    _kernel.Merge(mesh._kernel);
+    kernel().Merge(mesh.kernel());
 }
 
 void MeshObject::addMesh(const MeshCore::MeshKernel& kernel)
 {
-    _kernel.Merge(kernel);
+    this->kernel().Merge(kernel);
 }
 
 void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
@@ -660,7 +690,7 @@ void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
     if (removeIndices.empty()) {
         return;
     }
-    _kernel.DeleteFacets(removeIndices);
+    kernel().DeleteFacets(removeIndices);
     deletedFacets(removeIndices);
 }
 
@@ -669,7 +699,7 @@ void MeshObject::deletePoints(const std::vector<PointIndex>& removeIndices)
     if (removeIndices.empty()) {
         return;
     }
-    _kernel.DeletePoints(removeIndices);
+    kernel().DeletePoints(removeIndices);
     this->_segments.clear();
 }
 
@@ -682,7 +712,7 @@ void MeshObject::deletedFacets(const std::vector<FacetIndex>& remFacets)
         return;  // nothing to do
     }
     // set an array with the original indices and mark the removed as MeshCore::FACET_INDEX_MAX
-    std::vector<FacetIndex> f_indices(_kernel.CountFacets() + remFacets.size());
+    std::vector<FacetIndex> f_indices(kernel().CountFacets() + remFacets.size());
     for (FacetIndex remFacet : remFacets) {
         f_indices[remFacet] = MeshCore::FACET_INDEX_MAX;
     }
@@ -717,60 +747,60 @@ void MeshObject::deletedFacets(const std::vector<FacetIndex>& remFacets)
 void MeshObject::deleteSelectedFacets()
 {
     std::vector<FacetIndex> facets;
-    MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(facets, MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(this->kernel()).GetFacetsFlag(facets, MeshCore::MeshFacet::SELECTED);
     deleteFacets(facets);
 }
 
 void MeshObject::deleteSelectedPoints()
 {
     std::vector<PointIndex> points;
-    MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(points, MeshCore::MeshPoint::SELECTED);
+    MeshCore::MeshAlgorithm(this->kernel()).GetPointsFlag(points, MeshCore::MeshPoint::SELECTED);
     deletePoints(points);
 }
 
 void MeshObject::clearFacetSelection() const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetFacetFlag(MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(this->flagKernel()).ResetFacetFlag(MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::clearPointSelection() const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetPointFlag(MeshCore::MeshPoint::SELECTED);
+    MeshCore::MeshAlgorithm(this->flagKernel()).ResetPointFlag(MeshCore::MeshPoint::SELECTED);
 }
 
 void MeshObject::addFacetsToSelection(const std::vector<FacetIndex>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).SetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(this->flagKernel()).SetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::addPointsToSelection(const std::vector<PointIndex>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).SetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
+    MeshCore::MeshAlgorithm(this->flagKernel()).SetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
 void MeshObject::removeFacetsFromSelection(const std::vector<FacetIndex>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(this->flagKernel()).ResetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::removePointsFromSelection(const std::vector<PointIndex>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
+    MeshCore::MeshAlgorithm(this->flagKernel()).ResetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
 void MeshObject::getFacetsFromSelection(std::vector<FacetIndex>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(this->kernel()).GetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::getPointsFromSelection(std::vector<PointIndex>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
+    MeshCore::MeshAlgorithm(this->kernel()).GetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
 unsigned long MeshObject::countSelectedFacets() const
 {
-    return MeshCore::MeshAlgorithm(this->_kernel).CountFacetFlag(MeshCore::MeshFacet::SELECTED);
+    return MeshCore::MeshAlgorithm(this->kernel()).CountFacetFlag(MeshCore::MeshFacet::SELECTED);
 }
 
 bool MeshObject::hasSelectedFacets() const
@@ -780,7 +810,7 @@ bool MeshObject::hasSelectedFacets() const
 
 unsigned long MeshObject::countSelectedPoints() const
 {
-    return MeshCore::MeshAlgorithm(this->_kernel).CountPointFlag(MeshCore::MeshPoint::SELECTED);
+    return MeshCore::MeshAlgorithm(this->kernel()).CountPointFlag(MeshCore::MeshPoint::SELECTED);
 }
 
 bool MeshObject::hasSelectedPoints() const
@@ -790,7 +820,7 @@ bool MeshObject::hasSelectedPoints() const
 
 std::vector<PointIndex> MeshObject::getPointsFromFacets(const std::vector<FacetIndex>& facets) const
 {
-    return _kernel.GetFacetPoints(facets);
+    return kernel().GetFacetPoints(facets);
 }
 
 bool MeshObject::nearestFacetOnRay(const MeshObject::TRay& ray,
@@ -855,21 +885,21 @@ std::vector<MeshObject::TFaceSection> MeshObject::foraminate(const TRay& ray, do
 void MeshObject::updateMesh(const std::vector<FacetIndex>& facets) const
 {
     std::vector<PointIndex> points;
-    points = _kernel.GetFacetPoints(facets);
+    points = kernel().GetFacetPoints(facets);
 
-    MeshCore::MeshAlgorithm alg(_kernel);
+    MeshCore::MeshAlgorithm alg(flagKernel());
     alg.SetFacetsFlag(facets, MeshCore::MeshFacet::SEGMENT);
     alg.SetPointsFlag(points, MeshCore::MeshPoint::SEGMENT);
 }
 
 void MeshObject::updateMesh() const
 {
-    MeshCore::MeshAlgorithm alg(_kernel);
+    MeshCore::MeshAlgorithm alg(flagKernel());
     alg.ResetFacetFlag(MeshCore::MeshFacet::SEGMENT);
     alg.ResetPointFlag(MeshCore::MeshPoint::SEGMENT);
     for (const auto& segment : this->_segments) {
         std::vector<PointIndex> points;
-        points = _kernel.GetFacetPoints(segment.getIndices());
+        points = kernel().GetFacetPoints(segment.getIndices());
         alg.SetFacetsFlag(segment.getIndices(), MeshCore::MeshFacet::SEGMENT);
         alg.SetPointsFlag(points, MeshCore::MeshPoint::SEGMENT);
     }
@@ -878,7 +908,7 @@ void MeshObject::updateMesh() const
 std::vector<std::vector<FacetIndex>> MeshObject::getComponents() const
 {
     std::vector<std::vector<FacetIndex>> segments;
-    MeshCore::MeshComponents comp(_kernel);
+    MeshCore::MeshComponents comp(kernel());
     comp.SearchForComponents(MeshCore::MeshComponents::OverEdge, segments);
     return segments;
 }
@@ -886,7 +916,7 @@ std::vector<std::vector<FacetIndex>> MeshObject::getComponents() const
 unsigned long MeshObject::countComponents() const
 {
     std::vector<std::vector<FacetIndex>> segments;
-    MeshCore::MeshComponents comp(_kernel);
+    MeshCore::MeshComponents comp(kernel());
     comp.SearchForComponents(MeshCore::MeshComponents::OverEdge, segments);
     return segments.size();
 }
@@ -894,16 +924,16 @@ unsigned long MeshObject::countComponents() const
 void MeshObject::removeComponents(unsigned long count)
 {
     std::vector<FacetIndex> removeIndices;
-    MeshCore::MeshTopoAlgorithm(_kernel).FindComponents(count, removeIndices);
-    _kernel.DeleteFacets(removeIndices);
+    MeshCore::MeshTopoAlgorithm(kernel()).FindComponents(count, removeIndices);
+    kernel().DeleteFacets(removeIndices);
     deletedFacets(removeIndices);
 }
 
 unsigned long MeshObject::getPointDegree(const std::vector<FacetIndex>& indices,
                                          std::vector<PointIndex>& point_degree) const
 {
-    const MeshCore::MeshFacetArray& faces = _kernel.GetFacets();
-    std::vector<PointIndex> pointDeg(_kernel.CountPoints());
+    const MeshCore::MeshFacetArray& faces = kernel().GetFacets();
+    std::vector<PointIndex> pointDeg(kernel().CountPoints());
 
     for (const auto& face : faces) {
         pointDeg[face._aulPoints[0]]++;
@@ -931,32 +961,32 @@ void MeshObject::fillupHoles(unsigned long length,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
     std::list<std::vector<PointIndex>> aFailed;
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.FillupHoles(length, level, cTria, aFailed);
 }
 
 void MeshObject::offset(float fSize)
 {
-    std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> normals = kernel().CalcVertexNormals();
 
     unsigned int i = 0;
     // go through all the vertex normals
     for (std::vector<Base::Vector3f>::iterator It = normals.begin(); It != normals.end();
          ++It, i++) {
         // and move each mesh point in the normal direction
-        _kernel.MovePoint(i, It->Normalize() * fSize);
+        kernel().MovePoint(i, It->Normalize() * fSize);
     }
-    _kernel.RecalcBoundBox();
+    kernel().RecalcBoundBox();
 }
 
 void MeshObject::offsetSpecial2(float fSize)
 {
     Base::Builder3D builder;
-    std::vector<Base::Vector3f> PointNormals = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> PointNormals = kernel().CalcVertexNormals();
     std::vector<Base::Vector3f> FaceNormals;
     std::set<FacetIndex> fliped;
 
-    MeshCore::MeshFacetIterator it(_kernel);
+    MeshCore::MeshFacetIterator it(kernel());
     for (it.Init(); it.More(); it.Next()) {
         FaceNormals.push_back(it->GetNormal().Normalize());
     }
@@ -966,15 +996,15 @@ void MeshObject::offsetSpecial2(float fSize)
     // go through all the vertex normals
     for (std::vector<Base::Vector3f>::iterator It = PointNormals.begin(); It != PointNormals.end();
          ++It, i++) {
-        Base::Line3f line {_kernel.GetPoint(i), _kernel.GetPoint(i) + It->Normalize() * fSize};
+        Base::Line3f line {kernel().GetPoint(i), kernel().GetPoint(i) + It->Normalize() * fSize};
         Base::DrawStyle drawStyle;
         builder.addNode(Base::LineItem {line, drawStyle});
         // and move each mesh point in the normal direction
-        _kernel.MovePoint(i, It->Normalize() * fSize);
+        kernel().MovePoint(i, It->Normalize() * fSize);
     }
-    _kernel.RecalcBoundBox();
+    kernel().RecalcBoundBox();
 
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(kernel());
 
     for (int l = 0; l < 1; l++) {
         for (it.Init(), i = 0; it.More(); it.Next(), i++) {
@@ -1010,7 +1040,7 @@ void MeshObject::offsetSpecial2(float fSize)
     alg.Cleanup();
 
     // search for intersected facets
-    MeshCore::MeshEvalSelfIntersection eval(_kernel);
+    MeshCore::MeshEvalSelfIntersection eval(kernel());
     std::vector<std::pair<FacetIndex, FacetIndex>> faces;
     eval.GetIntersections(faces);
     builder.saveToLog();
@@ -1018,41 +1048,46 @@ void MeshObject::offsetSpecial2(float fSize)
 
 void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 {
-    std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> normals = kernel().CalcVertexNormals();
 
     unsigned int i = 0;
     // go through all the vertex normals
     for (std::vector<Base::Vector3f>::iterator It = normals.begin(); It != normals.end();
          ++It, i++) {
-        auto Pnt = _kernel.GetPoint(i);
+        auto Pnt = kernel().GetPoint(i);
         if (Pnt.z < zmax && Pnt.z > zmin) {
             Pnt.z = 0;
-            _kernel.MovePoint(i, Pnt.Normalize() * fSize);
+            kernel().MovePoint(i, Pnt.Normalize() * fSize);
         }
         else {
             // and move each mesh point in the normal direction
-            _kernel.MovePoint(i, It->Normalize() * fSize);
+            kernel().MovePoint(i, It->Normalize() * fSize);
         }
     }
 }
 
 void MeshObject::clear()
 {
-    _kernel.Clear();
+    if (_kernel.use_count() > 1) {
+        _kernel = std::make_shared<MeshCore::MeshKernel>();
+    }
+    else {
+        _kernel->Clear();
+    }
     this->_segments.clear();
     setTransform(Base::Matrix4D());
 }
 
 void MeshObject::transformToEigenSystem()
 {
-    MeshCore::MeshEigensystem cMeshEval(_kernel);
+    MeshCore::MeshEigensystem cMeshEval(kernel());
     cMeshEval.Evaluate();
     this->setTransform(cMeshEval.Transform());
 }
 
 Base::Matrix4D MeshObject::getEigenSystem(Base::Vector3d& v) const
 {
-    MeshCore::MeshEigensystem cMeshEval(_kernel);
+    MeshCore::MeshEigensystem cMeshEval(kernel());
     cMeshEval.Evaluate();
     Base::Vector3f uvw = cMeshEval.GetBoundings();
     v.Set(uvw.x, uvw.y, uvw.z);
@@ -1067,34 +1102,34 @@ void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
     vec.x += _Mtrx[0][3];
     vec.y += _Mtrx[1][3];
     vec.z += _Mtrx[2][3];
-    _kernel.MovePoint(index, transformPointToInside(vec));
+    kernel().MovePoint(index, transformPointToInside(vec));
 }
 
 void MeshObject::setPoint(PointIndex index, const Base::Vector3d& p)
 {
-    _kernel.SetPoint(index, transformPointToInside(p));
+    kernel().SetPoint(index, transformPointToInside(p));
 }
 
 void MeshObject::smooth(int iterations, float d_max)
 {
-    _kernel.Smooth(iterations, d_max);
+    kernel().Smooth(iterations, d_max);
 }
 
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
-    MeshCore::MeshSimplify dm(this->_kernel);
+    MeshCore::MeshSimplify dm(this->kernel());
     dm.simplify(fTolerance, fReduction);
 }
 
 void MeshObject::decimate(int targetSize)
 {
-    MeshCore::MeshSimplify dm(this->_kernel);
+    MeshCore::MeshSimplify dm(this->kernel());
     dm.simplify(targetSize);
 }
 
 Base::Vector3d MeshObject::getPointNormal(PointIndex index) const
 {
-    std::vector<Base::Vector3f> temp = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> temp = kernel().CalcVertexNormals();
     Base::Vector3d normal = transformVectorToOutside(temp[index]);
     normal.Normalize();
     return normal;
@@ -1102,7 +1137,7 @@ Base::Vector3d MeshObject::getPointNormal(PointIndex index) const
 
 std::vector<Base::Vector3d> MeshObject::getPointNormals() const
 {
-    std::vector<Base::Vector3f> temp = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> temp = kernel().CalcVertexNormals();
 
     std::vector<Base::Vector3d> normals = transformVectorsToOutside(temp);
     for (auto& n : normals) {
@@ -1116,7 +1151,7 @@ void MeshObject::crossSections(const std::vector<MeshObject::TPlane>& planes,
                                float fMinEps,
                                bool bConnectPolygons) const
 {
-    MeshCore::MeshKernel kernel(this->_kernel);
+    MeshCore::MeshKernel kernel(this->kernel());
     kernel.Transform(this->_Mtrx);
 
     MeshCore::MeshFacetGrid grid(kernel);
@@ -1132,7 +1167,7 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
                      const Base::ViewProjMethod& proj,
                      MeshObject::CutType type)
 {
-    MeshCore::MeshKernel kernel(this->_kernel);
+    MeshCore::MeshKernel kernel(this->kernel());
     kernel.Transform(getTransform());
 
     MeshCore::MeshAlgorithm meshAlg(kernel);
@@ -1162,7 +1197,7 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
                       const Base::ViewProjMethod& proj,
                       MeshObject::CutType type)
 {
-    MeshCore::MeshKernel kernel(this->_kernel);
+    MeshCore::MeshKernel kernel(this->kernel());
     kernel.Transform(getTransform());
 
     MeshCore::MeshTrimming trim(kernel, &proj, polygon2d);
@@ -1192,13 +1227,13 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
         for (auto& it : triangle) {
             it.Transform(mat);
         }
-        this->_kernel.AddFacets(triangle);
+        this->kernel().AddFacets(triangle);
     }
 }
 
 void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& normal)
 {
-    MeshCore::MeshTrimByPlane trim(this->_kernel);
+    MeshCore::MeshTrimByPlane trim(this->kernel());
     std::vector<FacetIndex> trimFacets, removeFacets;
     std::vector<MeshCore::MeshGeomFacet> triangle;
 
@@ -1210,23 +1245,23 @@ void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& n
     meshPlacement.multVec(base, basePlane);
     meshPlacement.getRotation().multVec(normal, normalPlane);
 
-    MeshCore::MeshFacetGrid meshGrid(this->_kernel);
+    MeshCore::MeshFacetGrid meshGrid(this->kernel());
     trim.CheckFacets(meshGrid, basePlane, normalPlane, trimFacets, removeFacets);
     trim.TrimFacets(trimFacets, basePlane, normalPlane, triangle);
     if (!removeFacets.empty()) {
         this->deleteFacets(removeFacets);
     }
     if (!triangle.empty()) {
-        this->_kernel.AddFacets(triangle);
+        this->kernel().AddFacets(triangle);
     }
 }
 
 MeshObject* MeshObject::unite(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(this->kernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.kernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1,
                                   kernel2,
@@ -1240,9 +1275,9 @@ MeshObject* MeshObject::unite(const MeshObject& mesh) const
 MeshObject* MeshObject::intersect(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(this->kernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.kernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1,
                                   kernel2,
@@ -1256,9 +1291,9 @@ MeshObject* MeshObject::intersect(const MeshObject& mesh) const
 MeshObject* MeshObject::subtract(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(this->kernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.kernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1,
                                   kernel2,
@@ -1272,9 +1307,9 @@ MeshObject* MeshObject::subtract(const MeshObject& mesh) const
 MeshObject* MeshObject::inner(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(this->kernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.kernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1,
                                   kernel2,
@@ -1288,9 +1323,9 @@ MeshObject* MeshObject::inner(const MeshObject& mesh) const
 MeshObject* MeshObject::outer(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(this->kernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.kernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1,
                                   kernel2,
@@ -1304,9 +1339,9 @@ MeshObject* MeshObject::outer(const MeshObject& mesh) const
 std::vector<std::vector<Base::Vector3f>>
 MeshObject::section(const MeshObject& mesh, bool connectLines, float fMinDist) const
 {
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(this->kernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.kernel());
     kernel2.Transform(mesh._Mtrx);
     std::vector<std::vector<Base::Vector3f>> lines;
 
@@ -1342,9 +1377,9 @@ MeshObject::section(const MeshObject& mesh, bool connectLines, float fMinDist) c
 
 void MeshObject::refine()
 {
-    unsigned long cnt = _kernel.CountFacets();
-    MeshCore::MeshFacetIterator cF(_kernel);
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    unsigned long cnt = kernel().CountFacets();
+    MeshCore::MeshFacetIterator cF(kernel());
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
 
     // x < 30 deg => cos(x) > sqrt(3)/2 or x > 120 deg => cos(x) < -0.5
     for (unsigned long i = 0; i < cnt; i++) {
@@ -1361,23 +1396,23 @@ void MeshObject::refine()
 
 void MeshObject::removeNeedles(float length)
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshRemoveNeedles eval(_kernel, length);
+    unsigned long count = kernel().CountFacets();
+    MeshCore::MeshRemoveNeedles eval(kernel(), length);
     eval.Fixup();
-    if (_kernel.CountFacets() < count) {
+    if (kernel().CountFacets() < count) {
         this->_segments.clear();
     }
 }
 
 void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 {
-    MeshCore::MeshFixCaps eval(_kernel, fMaxAngle, fSplitFactor);
+    MeshCore::MeshFixCaps eval(kernel(), fMaxAngle, fSplitFactor);
     eval.Fixup();
 }
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     if (fMaxAngle > 0.0f) {
         topalg.OptimizeTopology(fMaxAngle);
     }
@@ -1392,16 +1427,16 @@ void MeshObject::optimizeTopology(float fMaxAngle)
 
 void MeshObject::optimizeEdges()
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.AdjustEdgesToCurvatureDirection();
 }
 
 void MeshObject::splitEdges()
 {
     std::vector<std::pair<FacetIndex, FacetIndex>> adjacentFacet;
-    MeshCore::MeshAlgorithm alg(_kernel);
+    MeshCore::MeshAlgorithm alg(kernel());
     alg.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
-    const MeshCore::MeshFacetArray& rFacets = _kernel.GetFacets();
+    const MeshCore::MeshFacetArray& rFacets = kernel().GetFacets();
     for (MeshCore::MeshFacetArray::_TConstIterator pF = rFacets.begin(); pF != rFacets.end();
          ++pF) {
         int id = 2;
@@ -1416,8 +1451,8 @@ void MeshObject::splitEdges()
         }
     }
 
-    MeshCore::MeshFacetIterator cIter(_kernel);
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshFacetIterator cIter(kernel());
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     for (const auto& it : adjacentFacet) {
         cIter.Set(it.first);
         Base::Vector3f mid = 0.5f * (cIter->_aclPoints[0] + cIter->_aclPoints[2]);
@@ -1431,25 +1466,25 @@ void MeshObject::splitEdges()
 
 void MeshObject::splitEdge(FacetIndex facet, FacetIndex neighbour, const Base::Vector3f& v)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.SplitEdge(facet, neighbour, v);
 }
 
 void MeshObject::splitFacet(FacetIndex facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.SplitFacet(facet, v1, v2);
 }
 
 void MeshObject::swapEdge(FacetIndex facet, FacetIndex neighbour)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.SwapEdge(facet, neighbour);
 }
 
 void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.CollapseEdge(facet, neighbour);
 
     std::vector<FacetIndex> remFacets;
@@ -1460,7 +1495,7 @@ void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 
 void MeshObject::collapseFacet(FacetIndex facet)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.CollapseFacet(facet);
 
     std::vector<FacetIndex> remFacets;
@@ -1470,7 +1505,7 @@ void MeshObject::collapseFacet(FacetIndex facet)
 
 void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 {
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(kernel());
     for (FacetIndex it : facets) {
         alg.CollapseFacet(it);
     }
@@ -1480,46 +1515,46 @@ void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 
 void MeshObject::insertVertex(FacetIndex facet, const Base::Vector3f& v)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.InsertVertex(facet, v);
 }
 
 void MeshObject::snapVertex(FacetIndex facet, const Base::Vector3f& v)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(kernel());
     topalg.SnapVertex(facet, v);
 }
 
 unsigned long MeshObject::countNonUniformOrientedFacets() const
 {
-    MeshCore::MeshEvalOrientation cMeshEval(_kernel);
+    MeshCore::MeshEvalOrientation cMeshEval(kernel());
     std::vector<FacetIndex> inds = cMeshEval.GetIndices();
     return inds.size();
 }
 
 void MeshObject::flipNormals()
 {
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(kernel());
     alg.FlipNormals();
 }
 
 void MeshObject::harmonizeNormals()
 {
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(kernel());
     alg.HarmonizeNormals();
 }
 
 bool MeshObject::hasNonManifolds() const
 {
-    MeshCore::MeshEvalTopology cMeshEval(_kernel);
+    MeshCore::MeshEvalTopology cMeshEval(kernel());
     return !cMeshEval.Evaluate();
 }
 
 void MeshObject::removeNonManifolds()
 {
-    MeshCore::MeshEvalTopology f_eval(_kernel);
+    MeshCore::MeshEvalTopology f_eval(kernel());
     if (!f_eval.Evaluate()) {
-        MeshCore::MeshFixTopology f_fix(_kernel, f_eval.GetFacets());
+        MeshCore::MeshFixTopology f_fix(kernel(), f_eval.GetFacets());
         f_fix.Fixup();
         deletedFacets(f_fix.GetDeletedFaces());
     }
@@ -1527,7 +1562,7 @@ void MeshObject::removeNonManifolds()
 
 void MeshObject::removeNonManifoldPoints()
 {
-    MeshCore::MeshEvalPointManifolds p_eval(_kernel);
+    MeshCore::MeshEvalPointManifolds p_eval(kernel());
     if (!p_eval.Evaluate()) {
         std::vector<FacetIndex> faces;
         p_eval.GetFacetIndices(faces);
@@ -1537,7 +1572,7 @@ void MeshObject::removeNonManifoldPoints()
 
 bool MeshObject::hasSelfIntersections() const
 {
-    MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
+    MeshCore::MeshEvalSelfIntersection cMeshEval(kernel());
     return !cMeshEval.Evaluate();
 }
 
@@ -1574,11 +1609,11 @@ MeshObject::getSelfIntersections(const MeshObject::TFacePairs& facets) const
 void MeshObject::removeSelfIntersections()
 {
     std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
-    MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
+    MeshCore::MeshEvalSelfIntersection cMeshEval(kernel());
     cMeshEval.GetIntersections(selfIntersections);
 
     if (!selfIntersections.empty()) {
-        MeshCore::MeshFixSelfIntersection cMeshFix(_kernel, selfIntersections);
+        MeshCore::MeshFixSelfIntersection cMeshFix(kernel(), selfIntersections);
         deleteFacets(cMeshFix.GetFacets());
     }
 }
@@ -1589,7 +1624,7 @@ void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
     if (indices.size() % 2 != 0) {
         return;
     }
-    unsigned long cntfacets = _kernel.CountFacets();
+    unsigned long cntfacets = kernel().CountFacets();
     if (std::find_if(indices.begin(),
                      indices.end(),
                      [cntfacets](FacetIndex v) {
@@ -1609,7 +1644,7 @@ void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
     }
 
     if (!selfIntersections.empty()) {
-        MeshCore::MeshFixSelfIntersection cMeshFix(_kernel, selfIntersections);
+        MeshCore::MeshFixSelfIntersection cMeshFix(kernel(), selfIntersections);
         cMeshFix.Fixup();
         this->_segments.clear();
     }
@@ -1618,8 +1653,8 @@ void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 void MeshObject::removeFoldsOnSurface()
 {
     std::vector<FacetIndex> indices;
-    MeshCore::MeshEvalFoldsOnSurface s_eval(_kernel);
-    MeshCore::MeshEvalFoldOversOnSurface f_eval(_kernel);
+    MeshCore::MeshEvalFoldsOnSurface s_eval(kernel());
+    MeshCore::MeshEvalFoldOversOnSurface f_eval(kernel());
 
     f_eval.Evaluate();
     std::vector<FacetIndex> inds = f_eval.GetIndices();
@@ -1638,7 +1673,7 @@ void MeshObject::removeFoldsOnSurface()
 
     // do this as additional check after removing folds on closed area
     for (int i = 0; i < 5; i++) {
-        MeshCore::MeshEvalFoldsOnBoundary b_eval(_kernel);
+        MeshCore::MeshEvalFoldsOnBoundary b_eval(kernel());
         if (b_eval.Evaluate()) {
             break;
         }
@@ -1652,141 +1687,141 @@ void MeshObject::removeFoldsOnSurface()
 void MeshObject::removeFullBoundaryFacets()
 {
     std::vector<FacetIndex> facets;
-    if (!MeshCore::MeshEvalBorderFacet(_kernel, facets).Evaluate()) {
+    if (!MeshCore::MeshEvalBorderFacet(kernel(), facets).Evaluate()) {
         deleteFacets(facets);
     }
 }
 
 bool MeshObject::hasInvalidPoints() const
 {
-    MeshCore::MeshEvalNaNPoints nan(_kernel);
+    MeshCore::MeshEvalNaNPoints nan(kernel());
     return !nan.GetIndices().empty();
 }
 
 void MeshObject::removeInvalidPoints()
 {
-    MeshCore::MeshEvalNaNPoints nan(_kernel);
+    MeshCore::MeshEvalNaNPoints nan(kernel());
     deletePoints(nan.GetIndices());
 }
 
 bool MeshObject::hasPointsOnEdge() const
 {
-    MeshCore::MeshEvalPointOnEdge nan(_kernel);
+    MeshCore::MeshEvalPointOnEdge nan(kernel());
     return !nan.Evaluate();
 }
 
 void MeshObject::removePointsOnEdge(bool fillBoundary)
 {
-    MeshCore::MeshFixPointOnEdge nan(_kernel, fillBoundary);
+    MeshCore::MeshFixPointOnEdge nan(kernel(), fillBoundary);
     nan.Fixup();
 }
 
 void MeshObject::mergeFacets()
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixMergeFacets merge(_kernel);
+    unsigned long count = kernel().CountFacets();
+    MeshCore::MeshFixMergeFacets merge(kernel());
     merge.Fixup();
-    if (_kernel.CountFacets() < count) {
+    if (kernel().CountFacets() < count) {
         this->_segments.clear();
     }
 }
 
 void MeshObject::validateIndices()
 {
-    unsigned long count = _kernel.CountFacets();
+    unsigned long count = kernel().CountFacets();
 
     // for invalid neighbour indices we don't need to check first
     // but start directly with the validation
-    MeshCore::MeshFixNeighbourhood fix(_kernel);
+    MeshCore::MeshFixNeighbourhood fix(kernel());
     fix.Fixup();
 
-    MeshCore::MeshEvalRangeFacet rf(_kernel);
+    MeshCore::MeshEvalRangeFacet rf(kernel());
     if (!rf.Evaluate()) {
-        MeshCore::MeshFixRangeFacet fix(_kernel);
+        MeshCore::MeshFixRangeFacet fix(kernel());
         fix.Fixup();
     }
 
-    MeshCore::MeshEvalRangePoint rp(_kernel);
+    MeshCore::MeshEvalRangePoint rp(kernel());
     if (!rp.Evaluate()) {
-        MeshCore::MeshFixRangePoint fix(_kernel);
+        MeshCore::MeshFixRangePoint fix(kernel());
         fix.Fixup();
     }
 
-    MeshCore::MeshEvalCorruptedFacets cf(_kernel);
+    MeshCore::MeshEvalCorruptedFacets cf(kernel());
     if (!cf.Evaluate()) {
-        MeshCore::MeshFixCorruptedFacets fix(_kernel);
+        MeshCore::MeshFixCorruptedFacets fix(kernel());
         fix.Fixup();
     }
 
-    if (_kernel.CountFacets() < count) {
+    if (kernel().CountFacets() < count) {
         this->_segments.clear();
     }
 }
 
 bool MeshObject::hasInvalidNeighbourhood() const
 {
-    MeshCore::MeshEvalNeighbourhood eval(_kernel);
+    MeshCore::MeshEvalNeighbourhood eval(kernel());
     return !eval.Evaluate();
 }
 
 bool MeshObject::hasPointsOutOfRange() const
 {
-    MeshCore::MeshEvalRangePoint eval(_kernel);
+    MeshCore::MeshEvalRangePoint eval(kernel());
     return !eval.Evaluate();
 }
 
 bool MeshObject::hasFacetsOutOfRange() const
 {
-    MeshCore::MeshEvalRangeFacet eval(_kernel);
+    MeshCore::MeshEvalRangeFacet eval(kernel());
     return !eval.Evaluate();
 }
 
 bool MeshObject::hasCorruptedFacets() const
 {
-    MeshCore::MeshEvalCorruptedFacets eval(_kernel);
+    MeshCore::MeshEvalCorruptedFacets eval(kernel());
     return !eval.Evaluate();
 }
 
 void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDeformedFacets eval(_kernel,
+    unsigned long count = kernel().CountFacets();
+    MeshCore::MeshFixDeformedFacets eval(kernel(),
                                          Base::toRadians(15.0f),
                                          Base::toRadians(150.0f),
                                          fMaxAngle,
                                          fEps);
     eval.Fixup();
-    if (_kernel.CountFacets() < count) {
+    if (kernel().CountFacets() < count) {
         this->_segments.clear();
     }
 }
 
 void MeshObject::validateDegenerations(float fEps)
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDegeneratedFacets eval(_kernel, fEps);
+    unsigned long count = kernel().CountFacets();
+    MeshCore::MeshFixDegeneratedFacets eval(kernel(), fEps);
     eval.Fixup();
-    if (_kernel.CountFacets() < count) {
+    if (kernel().CountFacets() < count) {
         this->_segments.clear();
     }
 }
 
 void MeshObject::removeDuplicatedPoints()
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDuplicatePoints eval(_kernel);
+    unsigned long count = kernel().CountFacets();
+    MeshCore::MeshFixDuplicatePoints eval(kernel());
     eval.Fixup();
-    if (_kernel.CountFacets() < count) {
+    if (kernel().CountFacets() < count) {
         this->_segments.clear();
     }
 }
 
 void MeshObject::removeDuplicatedFacets()
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDuplicateFacets eval(_kernel);
+    unsigned long count = kernel().CountFacets();
+    MeshCore::MeshFixDuplicateFacets eval(kernel());
     eval.Fixup();
-    if (_kernel.CountFacets() < count) {
+    if (kernel().CountFacets() < count) {
         this->_segments.clear();
     }
 }
@@ -2045,7 +2080,7 @@ void MeshObject::addSegment(const Segment& s)
 
 void MeshObject::addSegment(const std::vector<FacetIndex>& inds)
 {
-    unsigned long maxIndex = _kernel.CountFacets();
+    unsigned long maxIndex = kernel().CountFacets();
     for (FacetIndex it : inds) {
         if (it >= maxIndex) {
             throw Base::IndexError("Index out of range");
@@ -2069,8 +2104,8 @@ MeshObject* MeshObject::meshFromSegment(const std::vector<FacetIndex>& indices)
 {
     MeshCore::MeshFacetArray facets;
     facets.reserve(indices.size());
-    const MeshCore::MeshPointArray& kernel_p = _kernel.GetPoints();
-    const MeshCore::MeshFacetArray& kernel_f = _kernel.GetFacets();
+    const MeshCore::MeshPointArray& kernel_p = kernel().GetPoints();
+    const MeshCore::MeshFacetArray& kernel_f = kernel().GetFacets();
     for (FacetIndex it : indices) {
         facets.push_back(kernel_f[it]);
     }
@@ -2086,31 +2121,31 @@ std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type
                                                    unsigned long minFacets) const
 {
     std::vector<Segment> segm;
-    if (this->_kernel.CountFacets() == 0) {
+    if (this->kernel().CountFacets() == 0) {
         return segm;
     }
 
-    MeshCore::MeshSegmentAlgorithm finder(this->_kernel);
+    MeshCore::MeshSegmentAlgorithm finder(this->kernel());
     std::shared_ptr<MeshCore::MeshDistanceSurfaceSegment> surf;
     switch (type) {
         case PLANE:
             surf.reset(
                 new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::PlaneSurfaceFit,
-                                                                   this->_kernel,
+                                                                   this->kernel(),
                                                                    minFacets,
                                                                    dev));
             break;
         case CYLINDER:
             surf.reset(
                 new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::CylinderSurfaceFit,
-                                                                   this->_kernel,
+                                                                   this->kernel(),
                                                                    minFacets,
                                                                    dev));
             break;
         case SPHERE:
             surf.reset(
                 new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::SphereSurfaceFit,
-                                                                   this->_kernel,
+                                                                   this->kernel(),
                                                                    minFacets,
                                                                    dev));
             break;
@@ -25,6 +25,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -178,11 +179,11 @@ public:
     void setKernel(const MeshCore::MeshKernel& m);
     MeshCore::MeshKernel& getKernel()
     {
-        return _kernel;
+        return kernel();
     }
     const MeshCore::MeshKernel& getKernel() const
     {
-        return _kernel;
+        return kernel();
     }
 
     Base::BoundBox3d getBoundBox() const override;
@@ -192,6 +193,11 @@ public:
     //@{
     // Implemented from Persistence
     unsigned int getMemSize() const override;
+    /// Returns true if the kernel is shared with a copy of this mesh
+    bool isShared() const
+    {
+        return _kernel.use_count() > 1;
+    }
     void Save(Base::Writer& writer) const override;
     void SaveDocFile(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
@@ -466,10 +472,21 @@ private:
     void swapKernel(MeshCore::MeshKernel& m, const std::vector<std::string>& g);
     void copySegments(const MeshObject&);
     void swapSegments(MeshObject&);
+    /// Returns the kernel for writing, it gets its own copy first if it's shared with another mesh
+    MeshCore::MeshKernel& kernel();
+    /// Returns the kernel for changing the flags of its elements, e.g. the selection. The flags
+    /// are part of the kernel, so like kernel() it gets its own copy first if it's shared.
+    MeshCore::MeshKernel& flagKernel() const;
+    const MeshCore::MeshKernel& kernel() const
+    {
+        return *_kernel;
+    }
 
 private:
     Base::Matrix4D _Mtrx;
-    MeshCore::MeshKernel _kernel;
+    // Copies of a mesh share the kernel until one of them is modified, so that e.g. the undo
+    // snapshot of a mesh property doesn't duplicate the whole mesh
+    mutable std::shared_ptr<MeshCore::MeshKernel> _kernel;
     std::vector<Segment> _segments;
     static const float Epsilon;
 };
@@ -22,6 +22,9 @@
 
 #include "PreCompiled.h"
 
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Reader.h>
@@ -148,9 +151,8 @@ void PropertyNormalList::SaveDocFile(Base::Writer& writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
-    for (auto it : _lValueList) {
-        str << it.x << it.y << it.z;
-    }
+    static_assert(sizeof(Base::Vector3f) == 3 * sizeof(float), "Vector3f must not be padded");
+    str.writeArray(reinterpret_cast<const float*>(_lValueList.data()), 3 * _lValueList.size());
 }
 
 void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
@@ -159,9 +161,7 @@ void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
     uint32_t uCt = 0;
     str >> uCt;
     std::vector<Base::Vector3f> values(uCt);
-    for (auto& it : values) {
-        str >> it.x >> it.y >> it.z;
-    }
+    str.readArray(reinterpret_cast<float*>(values.data()), 3 * values.size());
     setValues(values);
 }
 
@@ -744,6 +744,7 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
+    deferredFile.reset();
     _meshObject = mesh;
     hasSetValue();
 }
@@ -751,6 +752,7 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
+    deferredFile.reset();
     *_meshObject = mesh;
     hasSetValue();
 }
@@ -758,41 +760,50 @@ void PropertyMeshKernel::setValue(const MeshObject& mesh)
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    deferredFile.reset();
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
+    restoreDeferred();
     aboutToSetValue();
+    deferredFile.reset();
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
+    restoreDeferred();
     aboutToSetValue();
+    deferredFile.reset();
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
 const MeshObject& PropertyMeshKernel::getValue() const
 {
+    restoreDeferred();
     return *_meshObject;
 }
 
 const MeshObject* PropertyMeshKernel::getValuePtr() const
 {
+    restoreDeferred();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 const Data::ComplexGeoData* PropertyMeshKernel::getComplexData() const
 {
+    restoreDeferred();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
 {
+    restoreDeferred();
     return _meshObject->getBoundBox();
 }
 
@@ -804,8 +815,14 @@ unsigned int PropertyMeshKernel::getMemSize() const
     return size;
 }
 
+unsigned int PropertyMeshKernel::getUnsharedMemSize() const
+{
+    return _meshObject->isShared() ? 0 : getMemSize();
+}
+
 MeshObject* PropertyMeshKernel::startEditing()
 {
+    restoreDeferred();
     aboutToSetValue();
     return static_cast<MeshObject*>(_meshObject);
 }
@@ -817,6 +834,7 @@ void PropertyMeshKernel::finishEditing()
 
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    restoreDeferred();
     aboutToSetValue();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
@@ -825,6 +843,7 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
+    restoreDeferred();
     aboutToSetValue();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
@@ -845,6 +864,7 @@ Base::Matrix4D PropertyMeshKernel::getTransform() const
 
 PyObject* PropertyMeshKernel::getPyObject()
 {
+    restoreDeferred();
     if (!meshPyObject) {
         meshPyObject = new MeshPy(
             &*_meshObject);  // Lgtm[cpp/resource-not-released-in-destructor] ** Not destroyed in
@@ -882,6 +902,7 @@ void PropertyMeshKernel::setPyObject(PyObject* value)
 
 void PropertyMeshKernel::Save(Base::Writer& writer) const
 {
+    restoreDeferred();
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
         MeshCore::MeshOutput saver(_meshObject->getKernel());
@@ -921,6 +942,12 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
+    restoreDeferred();
+    if (deferredFile) {
+        // Don't replace the mesh that couldn't be read with an empty one
+        writer.addError("Mesh file " + deferredFile->getFileName() + " was not read");
+        return;
+    }
     _meshObject->save(writer.Stream());
 }
 
@@ -931,10 +958,43 @@ void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyMeshKernel::deferDocFile(const std::shared_ptr<Base::DeferredFile>& file)
+{
+    deferredFile = file;
+    return true;
+}
+
+void PropertyMeshKernel::restoreDeferred() const
+{
+    if (!deferredFile || deferredFile->hasFailed()) {
+        return;
+    }
+
+    // Reading the file doesn't change the value of the property from the point of view of its
+    // container, so read it into a temporary property to suppress any notification
+    PropertyMeshKernel prop;
+    if (deferredFile->restore(prop)) {
+        deferredFile.reset();
+        _meshObject->swap(prop._meshObject->getKernel());
+        return;
+    }
+
+    // The failed file is kept until a new value is set, so that the empty mesh isn't saved
+    auto obj = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
+    if (obj && obj->getDocument()) {
+        Base::Console().Error("Failed to read the mesh of %s\n", obj->getFullName().c_str());
+        obj->getDocument()->setStatus(App::Document::RestoreError, true);
+    }
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
     // Note: Copy the content, do NOT reference the same mesh object
+    // The mesh kernel itself is shared until one of the two meshes is modified, so this is cheap
+    // even for a big mesh (e.g. when saving the property for undo)
+    restoreDeferred();
     PropertyMeshKernel* prop = new PropertyMeshKernel();
+    prop->deferredFile = this->deferredFile;
     *(prop->_meshObject) = *(this->_meshObject);
     return prop;
 }
@@ -942,8 +1002,10 @@ App::Property* PropertyMeshKernel::Copy() const
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
     // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
+    prop.restoreDeferred();
+    aboutToSetValue();
+    deferredFile = prop.deferredFile;
     *(this->_meshObject) = *(prop._meshObject);
     hasSetValue();
 }
@@ -90,6 +90,7 @@ public:
     void Paste(const App::Property& from) override;
 
     unsigned int getMemSize() const override;
+    unsigned int getUnsharedMemSize() const override;
 
     void transformGeometry(const Base::Matrix4D& rclMat);
 
@@ -315,14 +316,20 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool deferDocFile(const std::shared_ptr<Base::DeferredFile>& file) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
+private:
+    /// reads the mesh file if its reading was deferred on restore
+    void restoreDeferred() const;
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
+    mutable std::shared_ptr<Base::DeferredFile> deferredFile;
 };
 
 }  // namespace Mesh
@@ -35,7 +35,11 @@
 # include <TopoDS.hxx>
 #endif // _PreComp_
 
+#include <atomic>
+#include <boost/functional/hash.hpp>
+
 #include <App/Application.h>
+#include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/ObjectIdentifier.h>
 #include <Base/Console.h>
@@ -60,6 +64,7 @@ PropertyPartShape::~PropertyPartShape() = default;
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
     aboutToSetValue();
+    _Deferred.reset();
     _Shape = sh;
     hasSetValue();
 }
@@ -67,28 +72,33 @@ void PropertyPartShape::setValue(const TopoShape& sh)
 void PropertyPartShape::setValue(const TopoDS_Shape& sh)
 {
     aboutToSetValue();
+    _Deferred.reset();
     _Shape.setShape(sh);
     hasSetValue();
 }
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    restoreDeferred();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    restoreDeferred();
     return this->_Shape;
 }
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    restoreDeferred();
     return &(this->_Shape);
 }
 
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
     Base::BoundBox3d box;
+    restoreDeferred();
     if (_Shape.getShape().IsNull())
         return box;
     try {
@@ -114,16 +124,23 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D &rclTrf)
 {
+    // While restoring, the placement of the object is set before the shape file is read and the
+    // transformation stored in the file takes precedence anyway
+    if (_Deferred && isContainerRestoring())
+        return;
+    restoreDeferred();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    restoreDeferred();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 {
+    restoreDeferred();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -131,6 +148,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 
 PyObject *PropertyPartShape::getPyObject()
 {
+    restoreDeferred();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop)
         prop->setConst();
@@ -152,7 +170,9 @@ void PropertyPartShape::setPyObject(PyObject *value)
 
 App::Property *PropertyPartShape::Copy() const
 {
+    restoreDeferred();
     PropertyPartShape *prop = new PropertyPartShape();
+    prop->_Deferred = this->_Deferred;
     prop->_Shape = this->_Shape;
     if (!_Shape.getShape().IsNull()) {
         BRepBuilderAPI_Copy copy(_Shape.getShape());
@@ -164,8 +184,11 @@ App::Property *PropertyPartShape::Copy() const
 
 void PropertyPartShape::Paste(const App::Property &from)
 {
+    const auto& prop = dynamic_cast<const PropertyPartShape&>(from);
+    prop.restoreDeferred();
     aboutToSetValue();
-    _Shape = dynamic_cast<const PropertyPartShape&>(from)._Shape;
+    _Deferred = prop._Deferred;
+    _Shape = prop._Shape;
     hasSetValue();
 }
 
@@ -360,6 +383,12 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 {
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
+    restoreDeferred();
+    if (_Deferred) {
+        // Don't replace the shape that couldn't be read with an empty one
+        writer.addError("Shape file " + _Deferred->getFileName() + " was not read");
+        return;
+    }
     if (_Shape.getShape().IsNull())
         return;
     TopoDS_Shape myShape = _Shape.getShape();
@@ -404,6 +433,40 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     }
 }
 
+bool PropertyPartShape::deferDocFile(const std::shared_ptr<Base::DeferredFile>& file)
+{
+    _Deferred = file;
+    return true;
+}
+
+void PropertyPartShape::restoreDeferred() const
+{
+    if (!_Deferred || _Deferred->hasFailed())
+        return;
+
+    // Reading the file doesn't change the value of the property from the point of view of its
+    // container, so read it into a temporary property to suppress any notification
+    PropertyPartShape prop;
+    if (_Deferred->restore(prop)) {
+        _Deferred.reset();
+        const_cast<PropertyPartShape*>(this)->_Shape = prop._Shape;
+        return;
+    }
+
+    // The failed file is kept until a new value is set, so that the empty shape isn't saved
+    auto obj = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
+    if (obj && obj->getDocument()) {
+        Base::Console().Error("Failed to read the shape of %s\n", obj->getFullName().c_str());
+        obj->getDocument()->setStatus(App::Document::RestoreError, true);
+    }
+}
+
+bool PropertyPartShape::isContainerRestoring() const
+{
+    auto obj = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
+    return obj && obj->isRestoring();
+}
+
 // -------------------------------------------------------------------------
 
 TYPESYSTEM_SOURCE(Part::PropertyShapeHistory , App::PropertyLists)
@@ -87,6 +87,7 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    bool deferDocFile(const std::shared_ptr<Base::DeferredFile>& file) override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
@@ -100,9 +101,13 @@ private:
     void saveToFile(Base::Writer &writer) const;
     void loadFromFile(Base::Reader &reader);
     void loadFromStream(Base::Reader &reader);
+    /// reads the shape file if its reading was deferred on restore
+    void restoreDeferred() const;
+    bool isContainerRestoring() const;
 
 private:
     TopoShape _Shape;
+    mutable std::shared_ptr<Base::DeferredFile> _Deferred;
 };
 
 struct PartExport ShapeHistory {
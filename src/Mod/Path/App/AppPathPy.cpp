@@ -48,6 +48,7 @@
 #include "Area.h"
 #include "PathPy.h"
 #include "FeaturePath.h"
+#include "VoronoiPy.h"
 
 
 #define PATH_CATCH catch (Standard_Failure &e)                      \
@@ -90,9 +91,33 @@ namespace PathApp {
   public:
       VoronoiModule() : Py::ExtensionModule<VoronoiModule>("Voronoi")
       {
+          add_varargs_method("constructDiagrams",&VoronoiModule::constructDiagrams,
+              "constructDiagrams(diagrams, threads=1): Constructs all given diagrams, using the given number\n"
+              "of threads (0 means one thread per CPU core)"
+          );
           initialize("Working with Voronoi diagrams and data structures");
       }
       ~VoronoiModule() override {}
+
+  private:
+      Py::Object constructDiagrams(const Py::Tuple& args)
+      {
+          PyObject *pObj;
+          int threads = 1;
+          if (!PyArg_ParseTuple(args.ptr(), "O|i", &pObj, &threads))
+              throw Py::Exception();
+
+          std::vector<Path::Voronoi*> diagrams;
+          Py::Sequence seq(pObj);
+          for (Py::Sequence::iterator it = seq.begin(); it != seq.end(); ++it) {
+              PyObject* item = (*it).ptr();
+              if (!PyObject_TypeCheck(item, &(Path::VoronoiPy::Type)))
+                  throw Py::TypeError("diagrams must be a list of Path.Voronoi.Diagram");
+              diagrams.push_back(static_cast<Path::VoronoiPy*>(item)->getVoronoiPtr());
+          }
+          Path::Voronoi::construct(diagrams, threads);
+          return Py::None();
+      }
   };
 
   class Module : public Py::ExtensionModule<Module>
@@ -157,9 +182,8 @@ namespace PathApp {
               App::DocumentObject* obj = static_cast<App::DocumentObjectPy*>(pObj)->getDocumentObjectPtr();
               if (obj->getTypeId().isDerivedFrom(Base::Type::fromName("Path::Feature"))) {
                   const Path::Toolpath& path = static_cast<Path::Feature*>(obj)->Path.getValue();
-                  std::string gcode = path.toGCode();
                   Base::ofstream ofile(file);
-                  ofile << gcode;
+                  path.toGCode(ofile);
                   ofile.close();
               }
               else {
@@ -195,11 +219,8 @@ namespace PathApp {
           try {
               // read the gcode file
               Base::ifstream filestr(file);
-              std::stringstream buffer;
-              buffer << filestr.rdbuf();
-              std::string gcode = buffer.str();
               Path::Toolpath path;
-              path.setFromGCode(gcode);
+              path.setFromGCode(filestr);
               Path::Feature *object = static_cast<Path::Feature *>(pcDoc->addObject("Path::Feature",file.fileNamePure().c_str()));
               object->Path.setValue(path);
               pcDoc->recompute();
@@ -26,7 +26,11 @@
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
 #ifndef _PreComp_
+# include <atomic>
 # include <cfloat>
+# include <exception>
+# include <mutex>
+# include <thread>
 
 # include <boost_geometry.hpp>
 # include <boost/geometry/geometries/register/point.hpp>
@@ -39,6 +43,7 @@
 # include <BRepAdaptor_Curve.hxx>
 # include <BRepAdaptor_Surface.hxx>
 # include <BRepBndLib.hxx>
+# include <BRepBuilderAPI_Copy.hxx>
 # include <BRepBuilderAPI_MakeEdge.hxx>
 # include <BRepBuilderAPI_MakeFace.hxx>
 # include <BRepBuilderAPI_MakeVertex.hxx>
@@ -1398,7 +1403,7 @@ std::vector<shared_ptr<Area> > Area::makeSections(
     if (plane.IsNull())
         throw Base::ValueError("failed to obtain section plane");
 
-    FC_TIME_INIT2(t, t1);
+    FC_TIME_INIT(t);
 
     TopLoc_Location loc(trsf);
 
@@ -1533,7 +1538,46 @@ std::vector<shared_ptr<Area> > Area::makeSections(
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
+    if (project) {
+        for (size_t i = 0; i < heights.size(); ++i) {
+            gp_Pln pln(gp_Pnt(0, 0, heights[i]), gp_Dir(0, 0, 1));
+            Standard_Real a, b, c, d;
+            pln.Coefficients(a, b, c, d);
+            BRepLib_MakeFace mkFace(pln, xMin, xMax, yMin, yMax);
+            const TopoDS_Shape& face = mkFace.Face();
+
+            shared_ptr<Area> area(std::make_shared<Area>(&myParams));
+            area->myParams.Outline = false;
+            area->setPlane(face.Moved(locInverse));
+
+            for (const auto& s : projectedShapes) {
+                gp_Trsf t;
+                t.SetTranslation(gp_Vec(0, 0, -d));
+                TopLoc_Location wloc(t);
+                area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
+            }
+            sections.push_back(area);
+        }
+        FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
+        return sections;
+    }
+
+    // Explode the solids only once, they are shared by all section heights
+    struct SectionInput {
+        short op;
+        std::vector<TopoDS_Shape> solids;
+    };
+    std::vector<SectionInput> inputs;
+    inputs.reserve(myShapes.size());
+    for (const Shape& s : myShapes) {
+        inputs.push_back({s.op, {}});
+        for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More(); xp.Next())
+            inputs.back().solids.push_back(xp.Current());
+    }
+
+    // Returns a null area if the section at the given index is discarded
+    auto makeSection = [&](size_t i, const std::vector<SectionInput>& shapes) {
+        FC_TIME_INIT(t1);
         double z = heights[i];
         bool retried = !can_retry;
         while (true) {
@@ -1547,27 +1591,15 @@ std::vector<shared_ptr<Area> > Area::makeSections(
             area->myParams.Outline = false;
             area->setPlane(face.Moved(locInverse));
 
-            if (project) {
-                for (const auto& s : projectedShapes) {
-                    gp_Trsf t;
-                    t.SetTranslation(gp_Vec(0, 0, -d));
-                    TopLoc_Location wloc(t);
-                    area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
-                }
-                sections.push_back(area);
-                break;
-            }
-
-            for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
-                const auto& s = *it;
+            for (auto it = shapes.begin(); it != shapes.end(); ++it) {
                 BRep_Builder builder;
                 TopoDS_Compound comp;
                 builder.MakeCompound(comp);
 
-                for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More(); xp.Next()) {
-                    showShape(xp.Current(), nullptr, "section_%u_shape", i);
+                for (const TopoDS_Shape& solid : it->solids) {
+                    showShape(solid, nullptr, "section_%u_shape", i);
                     std::list<TopoDS_Wire> wires;
-                    Part::CrossSection section(a, b, c, xp.Current());
+                    Part::CrossSection section(a, b, c, solid);
                     wires = section.slice(-d);
                     showShapes(wires, nullptr, "section_%u_wire", i);
                     if (wires.empty()) {
@@ -1612,11 +1644,11 @@ std::vector<shared_ptr<Area> > Area::makeSections(
                 if (TopExp_Explorer(comp, TopAbs_EDGE).More()) {
                     const TopoDS_Shape& shape = comp.Moved(locInverse);
                     showShape(shape, nullptr, "section_%u_result", i);
-                    area->add(shape, s.op);
+                    area->add(shape, it->op);
                 }
                 else if (area->myShapes.empty()) {
                     auto itNext = it;
-                    if (++itNext != myShapes.end() &&
+                    if (++itNext != shapes.end() &&
                         (itNext->op == OperationIntersection ||
                             itNext->op == OperationDifference))
                     {
@@ -1625,21 +1657,75 @@ std::vector<shared_ptr<Area> > Area::makeSections(
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
                 FC_TIME_LOG(t1, "makeSection " << z);
-                showShape(area->getShape(), nullptr, "section_%u_final", i);
-                break;
+                if (FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE)
+                    showShape(area->getShape(), nullptr, "section_%u_final", i);
+                return area;
             }
             if (retried) {
                 AREA_WARN("Discard empty section");
-                break;
-            }
-            else {
-                AREA_TRACE("retry section " << z << "->" << z + tolerance);
-                z += tolerance;
-                retried = true;
+                return shared_ptr<Area>();
             }
+            AREA_TRACE("retry section " << z << "->" << z + tolerance);
+            z += tolerance;
+            retried = true;
         }
+    };
+
+    // showShape() adds document objects, so the debug output forces serial slicing
+    size_t threads = myParams.SectionThreads > 0 ? static_cast<size_t>(myParams.SectionThreads)
+                                                 : std::thread::hardware_concurrency();
+    if (threads > heights.size())
+        threads = heights.size();
+    if (threads <= 1 || FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+        for (size_t i = 0; i < heights.size(); ++i) {
+            shared_ptr<Area> area = makeSection(i, inputs);
+            if (area)
+                sections.push_back(area);
+        }
+        FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
+        return sections;
+    }
+
+    // Each worker slices its own copy of the solids, because the boolean
+    // operations used by Part::CrossSection may update the input tolerances.
+    // The results are stored by height index to keep the section order.
+    std::vector<shared_ptr<Area> > results(heights.size());
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t n = 0; n < threads; ++n) {
+        workers.emplace_back([&]() {
+            try {
+                std::vector<SectionInput> copies;
+                copies.reserve(inputs.size());
+                for (const SectionInput& input : inputs) {
+                    copies.push_back({input.op, {}});
+                    for (const TopoDS_Shape& solid : input.solids)
+                        copies.back().solids.push_back(BRepBuilderAPI_Copy(solid).Shape());
+                }
+                for (size_t i = next++; i < heights.size() && !failed; i = next++)
+                    results[i] = makeSection(i, copies);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+                failed = true;
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+    if (error)
+        std::rethrow_exception(error);
+
+    for (const shared_ptr<Area>& area : results) {
+        if (area)
+            sections.push_back(area);
     }
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
     return sections;
@@ -160,6 +160,8 @@
         "When the section hits or over the shape boundary, a section with the height of that boundary\n"\
         "will be created. A small offset is usually required to avoid the tangential cut.",\
         App::PropertyPrecision))\
+    ((long,threads,SectionThreads,1,"Number of threads used to slice the sections concurrently.\n"\
+        "0 means one thread per CPU core."))\
      AREA_PARAMS_SECTION_EXTRA
 
 #ifdef AREA_OFFSET_ALGO
@@ -22,8 +22,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <cctype>
+# include <charconv>
 # include <cinttypes>
-# include <iomanip>
+# include <cmath>
 # include <boost/algorithm/string.hpp>
 #endif
 
@@ -99,26 +101,34 @@ bool Command::has(const std::string& attr) const
 
 std::string Command::toGCode (int precision, bool padzero) const
 {
-    std::stringstream str;
-    str.fill('0');
-    str << Name;
+    std::string str;
+    appendGCode(str, precision, padzero);
+    return str;
+}
+
+void Command::appendGCode (std::string& str, int precision, bool padzero) const
+{
+    str += Name;
     if(precision<0)
         precision = 0;
     double scale = std::pow(10.0,precision+1);
     std::int64_t iscale = static_cast<std::int64_t>(scale)/10;
+    char buf[32];
     for(std::map<std::string,double>::const_iterator i = Parameters.begin(); i != Parameters.end(); ++i) {
         if(i->first == "N") continue;
 
-        str << " " << i->first;
+        str += ' ';
+        str += i->first;
 
         std::int64_t v = static_cast<std::int64_t>(i->second*scale);
         if(v<0) {
             v = -v;
-            str << '-'; //shall we allow -0 ?
+            str += '-'; //shall we allow -0 ?
         }
         v+=5;
         v /= 10;
-        str << (v/iscale);
+        char *end = std::to_chars(buf, buf+sizeof(buf), v/iscale).ptr;
+        str.append(buf, end);
         if(!precision) continue;
 
         int width = precision;
@@ -130,71 +140,90 @@ std::string Command::toGCode (int precision, bool padzero) const
                 --width;
             }
         }
-        str << '.' << std::setw(width) << std::right << digits;
+        str += '.';
+        end = std::to_chars(buf, buf+sizeof(buf), digits).ptr;
+        if(end-buf < width)
+            str.append(width-(end-buf), '0');
+        str.append(buf, end);
     }
-    return str.str();
 }
 
-void Command::setFromGCode (const std::string& str)
+void Command::setFromGCode (std::string_view str)
 {
     Parameters.clear();
-    std::string mode = "none";
-    std::string key;
-    std::string value;
-    for (unsigned int i=0; i < str.size(); i++) {
-        if ( (isdigit(str[i])) || (str[i] == '-') || (str[i] == '.') ) {
-            value += str[i];
-        } else if (isalpha(str[i])) {
-            if (mode == "command") {
-                if (!key.empty() && !value.empty()) {
-                    std::string cmd = key + value;
-                    boost::to_upper(cmd);
-                    Name = cmd;
-                    key = "";
-                    value = "";
-                    mode = "argument";
+    enum class Mode { None, Command, Argument, Comment };
+    Mode mode = Mode::None;
+    // the key is a single letter, or '(' after the end of a comment
+    char key = 0;
+    // numbers are collected in a fixed buffer, only comments need a string
+    char number[64];
+    std::size_t length = 0;
+    std::string comment;
+    auto append = [&](char c) {
+        if (mode == Mode::Comment)
+            comment += c;
+        else if (length < sizeof(number) - 1)
+            number[length++] = c;
+        else
+            throw Base::BadFormatError("Badly formatted GCode argument");
+    };
+    auto addParameter = [&]() {
+        number[length] = 0;
+        Parameters[std::string(1, std::toupper(static_cast<unsigned char>(key)))] = std::atof(number);
+    };
+    for (char c : str) {
+        if ( (std::isdigit(static_cast<unsigned char>(c))) || (c == '-') || (c == '.') ) {
+            append(c);
+        } else if (std::isalpha(static_cast<unsigned char>(c))) {
+            if (mode == Mode::Command) {
+                if (key && length) {
+                    Name.assign(1, key);
+                    Name.append(number, length);
+                    boost::to_upper(Name);
+                    key = 0;
+                    length = 0;
                 } else {
                     throw Base::BadFormatError("Badly formatted GCode command");
                 }
-                mode = "argument";
-            } else if (mode == "none") {
-                mode = "command";
-            } else if (mode == "argument") {
-                if (!key.empty() && !value.empty()) {
-                    double val = std::atof(value.c_str());
-                    boost::to_upper(key);
-                    Parameters[key] = val;
-                    key = "";
-                    value = "";
+                mode = Mode::Argument;
+            } else if (mode == Mode::None) {
+                mode = Mode::Command;
+            } else if (mode == Mode::Argument) {
+                if (key && length) {
+                    addParameter();
+                    key = 0;
+                    length = 0;
                 } else {
                     throw Base::BadFormatError("Badly formatted GCode argument");
                 }
-            } else if (mode == "comment") {
-                value += str[i];
+            } else {
+                comment += c;
             }
-            key = str[i];
-        } else if (str[i] == '(') {
-            mode = "comment";
-        } else if (str[i] == ')') {
-            key = "(";
-            value += ")";
+            key = c;
+        } else if (c == '(') {
+            if (mode != Mode::Comment)
+                comment.assign(number, length);
+            mode = Mode::Comment;
+        } else if (c == ')') {
+            key = '(';
+            append(')');
         } else {
             // add non-ascii characters only if this is a comment
-            if (mode == "comment") {
-                value += str[i];
+            if (mode == Mode::Comment) {
+                comment += c;
             }
         }
     }
-    if (!key.empty() && !value.empty()) {
-        if ( (mode == "command") || (mode == "comment") ) {
-            std::string cmd = key + value;
-            if (mode == "command")
-                boost::to_upper(cmd);
-            Name = cmd;
+    if (key && (mode == Mode::Comment ? !comment.empty() : length > 0)) {
+        if (mode == Mode::Comment) {
+            Name.assign(1, key);
+            Name += comment;
+        } else if (mode == Mode::Command) {
+            Name.assign(1, key);
+            Name.append(number, length);
+            boost::to_upper(Name);
         } else {
-            double val = std::atof(value.c_str());
-            boost::to_upper(key);
-            Parameters[key] = val;
+            addParameter();
         }
     } else {
         throw Base::BadFormatError("Badly formatted GCode argument");
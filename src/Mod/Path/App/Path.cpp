@@ -274,7 +274,7 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void bulkAddCommand(const std::string &gcodestr, std::vector<Command*> &commands, bool &inches)
+static void bulkAddCommand(std::string_view gcodestr, std::vector<Command*> &commands, bool &inches)
 {
     Command *cmd = new Command();
     cmd->setFromGCode(gcodestr);
@@ -292,56 +292,78 @@ static void bulkAddCommand(const std::string &gcodestr, std::vector<Command*> &c
     }
 }
 
-void Toolpath::setFromGCode(const std::string instr)
+// Splits the string by () or G or M commands and adds the commands to the list.
+// Unless this is the final piece of the input, the last command or an unclosed
+// comment may continue in the next piece. They are not added and the returned
+// position tells where they start.
+static std::size_t bulkAddCommands(std::string_view str, std::vector<Command*> &commands, bool &inches, bool final)
 {
-    clear();
-
-    // remove comments
-    //boost::regex e("\\(.*?\\)");
-    //std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
-
-    // split input string by () or G or M commands
-    std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
-    bool inches = false;
-    while (found != std::string::npos)
+    static const char *separators = "(gGmM";
+    bool comment = false;
+    std::size_t found = str.find_first_of(separators);
+    std::size_t last = std::string_view::npos;
+    while (found != std::string_view::npos)
     {
         if (str[found] == '(') {
             // start of comment
-            if ( (last > -1) && (mode == "command") ) {
+            if ( (last != std::string_view::npos) && !comment ) {
                 // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found-last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                bulkAddCommand(str.substr(last, found-last), commands, inches);
             }
-            mode = "comment";
+            comment = true;
             last = found;
             found = str.find_first_of(')', found+1);
         } else if (str[found] == ')') {
             // end of comment
-            std::string gcodestr = str.substr(last, found-last+1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
-            found = str.find_first_of("(gGmM", found+1);
-            mode = "command";
-        } else if (mode == "command") {
+            bulkAddCommand(str.substr(last, found-last+1), commands, inches);
+            last = std::string_view::npos;
+            found = str.find_first_of(separators, found+1);
+            comment = false;
+        } else {
             // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found-last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+            if (last != std::string_view::npos) {
+                bulkAddCommand(str.substr(last, found-last), commands, inches);
             }
             last = found;
-            found = str.find_first_of("(gGmM", found+1);
+            found = str.find_first_of(separators, found+1);
         }
     }
+    if (last == std::string_view::npos)
+        return str.size();
+    if (!final)
+        return last;
     // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last,std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-        }
+    if (!comment) {
+        bulkAddCommand(str.substr(last), commands, inches);
     }
+    return str.size();
+}
+
+void Toolpath::setFromGCode(std::string_view str)
+{
+    clear();
+
+    bool inches = false;
+    bulkAddCommands(str, vpcCommands, inches, true);
+    recalculate();
+}
+
+void Toolpath::setFromGCode(std::istream &in)
+{
+    clear();
+
+    // only the commands that may continue in the next chunk are kept in the buffer
+    const std::size_t chunkSize = 1 << 16;
+    std::string buffer;
+    bool inches = false;
+    while (in) {
+        std::size_t size = buffer.size();
+        buffer.resize(size + chunkSize);
+        in.read(&buffer[size], chunkSize);
+        buffer.resize(size + static_cast<std::size_t>(in.gcount()));
+        buffer.erase(0, bulkAddCommands(buffer, vpcCommands, inches, false));
+    }
+    bulkAddCommands(buffer, vpcCommands, inches, true);
     recalculate();
 }
 
@@ -349,12 +371,29 @@ std::string Toolpath::toGCode() const
 {
     std::string result;
     for (std::vector<Command*>::const_iterator it=vpcCommands.begin();it!=vpcCommands.end();++it) {
-        result += (*it)->toGCode();
+        (*it)->appendGCode(result);
         result += "\n";
     }
     return result;
 }
 
+void Toolpath::toGCode(std::ostream &out) const
+{
+    // write in chunks instead of building the gcode of the whole path first
+    const std::size_t chunkSize = 1 << 16;
+    std::string buffer;
+    buffer.reserve(chunkSize + 256);
+    for (std::vector<Command*>::const_iterator it=vpcCommands.begin();it!=vpcCommands.end();++it) {
+        (*it)->appendGCode(buffer);
+        buffer += "\n";
+        if (buffer.size() >= chunkSize) {
+            out.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    out.write(buffer.data(), buffer.size());
+}
+
 void Toolpath::recalculate() // recalculates the path cache
 {
 
@@ -458,9 +497,9 @@ void Toolpath::Save (Writer &writer) const
 
 void Toolpath::SaveDocFile (Base::Writer &writer) const
 {
-    if (toGCode().empty())
+    if (vpcCommands.empty())
         return;
-    writer.Stream() << toGCode();
+    toGCode(writer.Stream());
 }
 
 void Toolpath::Restore(XMLReader &reader)
@@ -476,14 +515,7 @@ void Toolpath::Restore(XMLReader &reader)
 
 void Toolpath::RestoreDocFile(Base::Reader &reader)
 {
-    std::string gcode;
-    std::string line;
-    while (reader >> line) {
-        gcode += line;
-        gcode += " ";
-    }
-    setFromGCode(gcode);
-
+    setFromGCode(reader);
 }
 
 
@@ -23,6 +23,9 @@
 #ifndef PATH_Path_H
 #define PATH_Path_H
 
+#include <iosfwd>
+#include <string_view>
+
 #include <Base/BoundBox.h>
 #include <Base/Persistence.h>
 #include <Base/Vector3D.h>
@@ -61,8 +64,10 @@ namespace Path
             double getLength(); // return the Length (mm) of the Path
             double getCycleTime(double, double, double, double); // return the Cycle Time (s) of the Path
             void recalculate(); // recalculates the points
-            void setFromGCode(const std::string); // sets the path from the contents of the given GCode string
+            void setFromGCode(std::string_view); // sets the path from the contents of the given GCode string
+            void setFromGCode(std::istream&); // sets the path from the GCode read in chunks from the given stream
             std::string toGCode() const; // gets a gcode string representation from the Path
+            void toGCode(std::ostream&) const; // writes the gcode of the Path in chunks to the given stream
             Base::BoundBox3d getBoundBox() const;
 
             // shortcut functions
@@ -43,11 +43,18 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <atomic>
+#include <charconv>
 #include <cinttypes>
+#include <exception>
 #include <iomanip>
+#include <limits>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Boost
@@ -64,6 +71,7 @@
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
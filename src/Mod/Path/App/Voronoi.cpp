@@ -22,6 +22,12 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
+# include <atomic>
+# include <exception>
+# include <limits>
+# include <mutex>
+# include <thread>
 # include <Standard_math.hxx>
 #endif
 
@@ -183,6 +189,52 @@ void Voronoi::construct()
   vd->reIndex();
 }
 
+void Voronoi::construct(const std::vector<Voronoi*> &list, int threads)
+{
+  // a diagram passed more than once is only built once, two threads must not build it together
+  std::vector<Voronoi*> diagrams(list);
+  std::sort(diagrams.begin(), diagrams.end());
+  diagrams.erase(std::unique(diagrams.begin(), diagrams.end()), diagrams.end());
+
+  size_t count = threads > 0 ? static_cast<size_t>(threads) : std::thread::hardware_concurrency();
+  count = std::min(count, diagrams.size());
+  if (count <= 1) {
+    for (Voronoi *vo : diagrams) {
+      vo->construct();
+    }
+    return;
+  }
+
+  // the diagrams don't share any data, so each one can be built by a different thread
+  std::atomic<size_t> next(0);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  std::vector<std::thread> workers;
+  workers.reserve(count);
+  for (size_t n = 0; n < count; ++n) {
+    workers.emplace_back([&]() {
+      try {
+        for (size_t i = next++; i < diagrams.size(); i = next++) {
+          diagrams[i]->construct();
+        }
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = diagrams.size();
+      }
+    });
+  }
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
 void Voronoi::colorExterior(const Voronoi::diagram_type::edge_type *edge, std::size_t colorValue) {
   if (edge->color()) {
     // end recursion
@@ -285,6 +337,159 @@ void Voronoi::colorColinear(Voronoi::color_type color, double degree) {
   }
 }
 
+void Voronoi::colorSecondary(Voronoi::color_type color) {
+  for (auto it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+    if (it->is_secondary()) {
+      it->color(color);
+    }
+  }
+}
+
+static double distanceBetween(double x0, double y0, double x1, double y1) {
+  return sqrt((x0 - x1) * (x0 - x1) + (y0 - y1) * (y0 - y1));
+}
+
+// distance of v to the line through the segment
+static double distanceToLine(const Voronoi::vertex_type &v, const Voronoi::segment_type &segment) {
+  double sx = high(segment).x() - low(segment).x();
+  double sy = high(segment).y() - low(segment).y();
+  double px = v.x() - low(segment).x();
+  double py = v.y() - low(segment).y();
+  double proj = (px * sx + py * sy) / (sx * sx + sy * sy + std::numeric_limits<double>::epsilon());
+  return distanceBetween(px, py, proj * sx, proj * sy);
+}
+
+void Voronoi::colorBorderline(Voronoi::color_type color) {
+  // curved edges between a segment and one of its own end points
+  double scale = vd->getScale();
+  for (auto it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+    if (it->is_primary() && it->is_curved()) {
+      auto pc = it->cell()->contains_point() ? it->cell() : it->twin()->cell();
+      auto sc = it->cell()->contains_point() ? it->twin()->cell() : it->cell();
+      point_type point = vd->retrievePoint(pc);
+      segment_type segment = vd->retrieveSegment(sc);
+      if (distanceBetween(point.x(), point.y(), low(segment).x(), low(segment).y()) / scale < 1e-6
+          || distanceBetween(point.x(), point.y(), high(segment).x(), high(segment).y()) / scale < 1e-6) {
+        it->color(color);
+      }
+    }
+  }
+}
+
+Voronoi::MedialAxis Voronoi::medialAxis(Voronoi::color_type color) const {
+  MedialAxis axis;
+  const auto &edges = vd->edges();
+  if (vd->vertices().empty()) {
+    // without vertices there are no finite edges
+    axis.wires.push_back(0);
+    return axis;
+  }
+  const diagram_type::edge_type *edge0 = &edges.front();
+  const vertex_type *vertex0 = &vd->vertices().front();
+
+  // the edges at each vertex, in the order they are found
+  std::vector<std::vector<long>> incident(vd->num_vertices());
+  std::vector<long> found;
+  for (size_t i = 0; i < edges.size(); ++i) {
+    const auto &edge = edges[i];
+    if ((edge.color() & ColorMask) != color || !edge.vertex0() || !edge.vertex1()) {
+      continue;
+    }
+    for (const vertex_type *v : {edge.vertex0(), edge.vertex1()}) {
+      long iv = v - vertex0;
+      if (incident[iv].empty()) {
+        found.push_back(iv);
+      }
+      incident[iv].push_back(i);
+    }
+  }
+
+  // knots are the start and end points of a wire
+  std::vector<long> knots;
+  for (long iv : found) {
+    if (incident[iv].size() == 1) {
+      knots.push_back(iv);
+    }
+  }
+  for (long iv : found) {
+    if (incident[iv].size() > 2) {
+      knots.push_back(iv);
+    }
+  }
+  if (knots.empty() && !found.empty()) {
+    knots.push_back(found.front());
+  }
+
+  auto consume = [&](long iv, long ie) {
+    auto &list = incident[iv];
+    list.erase(std::remove(list.begin(), list.end(), ie), list.end());
+    return list.empty();
+  };
+  auto traverse = [&](long vStart, long ie) -> long {
+    const auto &edge = edges[ie];
+    long vEnd;
+    if (vStart == edge.vertex0() - vertex0) {
+      vEnd = edge.vertex1() - vertex0;
+      axis.edges.push_back(ie);
+    } else {
+      vEnd = edge.vertex0() - vertex0;
+      axis.edges.push_back(edge.twin() - edge0);
+    }
+    consume(vStart, ie);
+    if (consume(vEnd, ie)) {
+      return -1;
+    }
+    return vEnd;
+  };
+
+  while (!knots.empty()) {
+    long vFirst = knots.front();
+    long vStart = vFirst;
+    long vLast = vFirst;
+    if (!incident[vStart].empty()) {
+      axis.wires.push_back(axis.edges.size());
+      while (vStart >= 0) {
+        vLast = vStart;
+        if (!incident[vStart].empty()) {
+          vStart = traverse(vStart, incident[vStart].front());
+        } else {
+          vStart = -1;
+        }
+      }
+    }
+    if (incident[vFirst].empty()) {
+      knots.erase(std::remove(knots.begin(), knots.end(), vFirst), knots.end());
+    }
+    if (incident[vLast].empty()) {
+      knots.erase(std::remove(knots.begin(), knots.end(), vLast), knots.end());
+    }
+  }
+  axis.wires.push_back(axis.edges.size());
+
+  // end points and their distances to the inputs, which are the same for both cells of an edge
+  double scale = vd->getScale();
+  axis.points.reserve(axis.edges.size() * 4);
+  axis.distances.reserve(axis.edges.size() * 2);
+  for (long ie : axis.edges) {
+    const auto &edge = edges[ie];
+    const diagram_type::cell_type *cell = edge.cell();
+    if (!cell->contains_point() && edge.twin()->cell()->contains_point()) {
+      cell = edge.twin()->cell();
+    }
+    for (const vertex_type *v : {edge.vertex0(), edge.vertex1()}) {
+      axis.points.push_back(v->x() / scale);
+      axis.points.push_back(v->y() / scale);
+      if (cell->contains_point()) {
+        point_type p = vd->retrievePoint(cell);
+        axis.distances.push_back(distanceBetween(v->x(), v->y(), p.x(), p.y()) / scale);
+      } else {
+        axis.distances.push_back(distanceToLine(*v, vd->retrieveSegment(cell)) / scale);
+      }
+    }
+  }
+  return axis;
+}
+
 void Voronoi::resetColor(Voronoi::color_type color) {
   for (auto it = vd->cells().begin(); it != vd->cells().end(); ++it) {
     if (color == 0 || it->color() == color) {
@@ -109,6 +109,9 @@ namespace Path
     long numSegments() const;
 
     void construct();
+    /// construct several diagrams at once, using threads (0 means one per CPU core),
+    /// a diagram listed more than once is constructed once
+    static void construct(const std::vector<Voronoi*> &diagrams, int threads);
     long numCells() const;
     long numEdges() const;
     long numVertices() const;
@@ -117,6 +120,21 @@ namespace Path
     void colorExterior(color_type color);
     void colorTwins(color_type color);
     void colorColinear(color_type color, double degree);
+    void colorSecondary(color_type color);
+    void colorBorderline(color_type color);
+
+    /** Finite edges of one color chained into wires, each edge pair is used once.
+     *  edges holds the indices of the edges in the direction they are traversed,
+     *  wires the offset of each wire into edges followed by the number of edges.
+     *  For each edge points holds x0, y0, x1, y1 and distances the distance of
+     *  both end points to the closest input, all of them scaled back. */
+    struct MedialAxis {
+      std::vector<long>   edges;
+      std::vector<long>   wires;
+      std::vector<double> points;
+      std::vector<double> distances;
+    };
+    MedialAxis medialAxis(color_type color) const;
 
     template<typename T>
     T* create(int index) {
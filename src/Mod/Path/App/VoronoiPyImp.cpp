@@ -265,6 +265,62 @@ PyObject* VoronoiPy::colorColinear(PyObject *args) {
   return Py_None;
 }
 
+PyObject* VoronoiPy::colorSecondary(PyObject *args) {
+  Voronoi::color_type color = 0;
+  if (!PyArg_ParseTuple(args, "k", &color)) {
+    throw  Py::RuntimeError("colorSecondary requires an integer (color) argument");
+  }
+  getVoronoiPtr()->colorSecondary(color);
+
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+PyObject* VoronoiPy::colorBorderline(PyObject *args) {
+  Voronoi::color_type color = 0;
+  if (!PyArg_ParseTuple(args, "k", &color)) {
+    throw  Py::RuntimeError("colorBorderline requires an integer (color) argument");
+  }
+  getVoronoiPtr()->colorBorderline(color);
+
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+template<typename T>
+static Py::Object toArray(const char *typecode, const std::vector<T> &values) {
+  Py::Module module(PyImport_ImportModule("array"), true);
+  Py::Object array = module.callMemberFunction("array", Py::TupleN(Py::String(typecode)));
+  Py::Bytes data(reinterpret_cast<const char*>(values.data()), Py_ssize_t(values.size() * sizeof(T)));
+  array.callMemberFunction("frombytes", Py::TupleN(data));
+  return array;
+}
+
+PyObject* VoronoiPy::getMedialAxis(PyObject *args) {
+  Voronoi::color_type color = 0;
+  if (!PyArg_ParseTuple(args, "|k", &color)) {
+    throw  Py::RuntimeError("getMedialAxis accepts an optional integer (color) argument");
+  }
+  Voronoi::MedialAxis axis = getVoronoiPtr()->medialAxis(color);
+  Py::Tuple tuple(4);
+  tuple.setItem(0, toArray("l", axis.edges));
+  tuple.setItem(1, toArray("l", axis.wires));
+  tuple.setItem(2, toArray("d", axis.points));
+  tuple.setItem(3, toArray("d", axis.distances));
+  return Py::new_reference_to(tuple);
+}
+
+PyObject* VoronoiPy::getEdge(PyObject *args) {
+  long index = 0;
+  if (!PyArg_ParseTuple(args, "l", &index)) {
+    throw  Py::RuntimeError("getEdge requires an integer (index) argument");
+  }
+  if (index < 0 || index >= getVoronoiPtr()->numEdges()) {
+    throw Py::IndexError("edge index out of range");
+  }
+  return new VoronoiEdgePy(getVoronoiPtr()->create<VoronoiEdge>(index));
+}
+
 PyObject* VoronoiPy::resetColor(PyObject *args) {
   Voronoi::color_type color = 0;
   if (!PyArg_ParseTuple(args, "k", &color)) {
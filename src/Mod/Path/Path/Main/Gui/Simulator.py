@@ -323,6 +323,37 @@ class PathSimulation:
             return
         self.busy = True
 
+        if self.disableAnim:
+            self.PerformCutVoxelFast()
+        else:
+            self.PerformCutVoxelCommand()
+        self.UpdateProgress()
+        if self.icmd >= len(self.opCommands):
+            self.ioperation += 1
+            if self.ioperation >= len(self.activeOps):
+                self.EndSimulation()
+                return
+            else:
+                self.SetupOperation(self.ioperation)
+        self.busy = False
+
+    def PerformCutVoxelFast(self):
+        # simulate the rest of the operation at once, the stock is cut by several threads
+        commands = self.opCommands[self.icmd :]
+        ncollisions = len(self.voxSim.Collisions)
+        self.curpos = self.voxSim.ApplyPath(
+            self.curpos, Path.Path(commands), Path.Preferences.simulationThreads()
+        )
+        for icmd, kind, pos in self.voxSim.Collisions[ncollisions:]:
+            Path.Log.warning(
+                "{} collision in {} at cmd #{} ({:.2f}, {:.2f}, {:.2f})".format(
+                    kind, self.operation.Label, self.icmd + icmd, pos.x, pos.y, pos.z
+                )
+            )
+        self.icmd += len(commands)
+        self.iprogress += len(commands)
+
+    def PerformCutVoxelCommand(self):
         cmd = self.opCommands[self.icmd]
         # for cmd in job.Path.Commands:
         if cmd.Name in ["G0", "G1", "G2", "G3"]:
@@ -382,15 +413,6 @@ class PathSimulation:
                     ) = self.voxSim.GetResultMesh()
         self.icmd += 1
         self.iprogress += 1
-        self.UpdateProgress()
-        if self.icmd >= len(self.opCommands):
-            self.ioperation += 1
-            if self.ioperation >= len(self.activeOps):
-                self.EndSimulation()
-                return
-            else:
-                self.SetupOperation(self.ioperation)
-        self.busy = False
 
     def PerformCut(self):
         if self.isVoxel:
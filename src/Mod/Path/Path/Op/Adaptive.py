@@ -776,6 +776,7 @@ def Execute(op, obj):
             a2d.forceInsideOut = obj.ForceInsideOut
             a2d.finishingProfile = obj.FinishingProfile
             a2d.opType = opType
+            a2d.threads = Path.Preferences.adaptiveThreads()
 
             # EXECUTE
             results = a2d.Execute(stockPath2d, path2d, progressFn)
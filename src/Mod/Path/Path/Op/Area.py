@@ -224,6 +224,7 @@ class ObjectOp(PathOp.ObjectOp):
 
         areaParams = self.areaOpAreaParams(obj, isHole)
         areaParams["SectionTolerance"] = 1e-07
+        areaParams["SectionThreads"] = Path.Preferences.sectionThreads()
 
         heights = [i for i in self.depthparams]
         Path.Log.debug("depths: {}".format(heights))
@@ -54,62 +54,11 @@ _sorting = "global"
 
 
 def _collectVoronoiWires(vd):
-    edges = [e for e in vd.Edges if e.Color == PRIMARY]
-    vertex = {}
-    for e in edges:
-        for v in e.Vertices:
-            i = v.Index
-            j = vertex.get(i, [])
-            j.append(e)
-            vertex[i] = j
-
-    # knots are the start and end points of a wire
-    knots = [i for i in vertex if len(vertex[i]) == 1]
-    knots.extend([i for i in vertex if len(vertex[i]) > 2])
-    if len(knots) == 0:
-        for i in vertex:
-            if len(vertex[i]) > 0:
-                knots.append(i)
-                break
-
-    def consume(v, edge):
-        vertex[v] = [e for e in vertex[v] if e.Index != edge.Index]
-        return len(vertex[v]) == 0
-
-    def traverse(vStart, edge, edges):
-        if vStart == edge.Vertices[0].Index:
-            vEnd = edge.Vertices[1].Index
-            edges.append(edge)
-        else:
-            vEnd = edge.Vertices[0].Index
-            edges.append(edge.Twin)
-
-        consume(vStart, edge)
-        if consume(vEnd, edge):
-            return None
-        return vEnd
-
-    wires = []
-    while knots:
-        we = []
-        vFirst = knots[0]
-        vStart = vFirst
-        vLast = vFirst
-        if len(vertex[vStart]):
-            while vStart is not None:
-                vLast = vStart
-                edges = vertex[vStart]
-                if len(edges) > 0:
-                    edge = edges[0]
-                    vStart = traverse(vStart, edge, we)
-                else:
-                    vStart = None
-            wires.append(we)
-        if len(vertex[vFirst]) == 0:
-            knots = [v for v in knots if v != vFirst]
-        if len(vertex[vLast]) == 0:
-            knots = [v for v in knots if v != vLast]
-    return wires
+    edges, wires, _, _ = vd.getMedialAxis(PRIMARY)
+    return [
+        [vd.getEdge(i) for i in edges[wires[w] : wires[w + 1]]]
+        for w in range(len(wires) - 1)
+    ]
 
 
 def _sortVoronoiWires(wires, start=FreeCAD.Vector(0, 0, 0)):
@@ -287,21 +236,17 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
 
             return path
 
-        voronoiWires = []
+        diagrams = []
         for f in faces:
             vd = Path.Voronoi.Diagram()
             insert_many_wires(vd, f.Wires)
+            diagrams.append(vd)
+        Path.Voronoi.constructDiagrams(diagrams, Path.Preferences.voronoiThreads())
 
-            vd.construct()
-
-            for e in vd.Edges:
-                if e.isPrimary():
-                    if e.isBorderline():
-                        e.Color = BORDERLINE
-                    else:
-                        e.Color = PRIMARY
-                else:
-                    e.Color = SECONDARY
+        voronoiWires = []
+        for f, vd in zip(faces, diagrams):
+            vd.colorSecondary(SECONDARY)
+            vd.colorBorderline(BORDERLINE)
             vd.colorExterior(EXTERIOR1)
             vd.colorExterior(
                 EXTERIOR2,
@@ -68,6 +68,13 @@ WarningSuppressVelocity = "WarningSuppressVelocity"
 EnableExperimentalFeatures = "EnableExperimentalFeatures"
 EnableAdvancedOCLFeatures = "EnableAdvancedOCLFeatures"
 
+# Number of threads clearing separate regions of an adaptive operation, 0 = one per CPU core
+AdaptiveThreads = "AdaptiveThreads"
+SectionThreads = "SectionThreads"
+VoronoiThreads = "VoronoiThreads"
+# Number of threads cutting the stock when fast forwarding the simulator, 0 = one per CPU core
+SimulationThreads = "SimulationThreads"
+
 
 def preferences():
     return FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Path")
@@ -257,6 +264,22 @@ def experimentalFeaturesEnabled():
     return preferences().GetBool(EnableExperimentalFeatures, False)
 
 
+def adaptiveThreads():
+    return preferences().GetInt(AdaptiveThreads, 1)
+
+
+def sectionThreads():
+    return preferences().GetInt(SectionThreads, 1)
+
+
+def voronoiThreads():
+    return preferences().GetInt(VoronoiThreads, 1)
+
+
+def simulationThreads():
+    return preferences().GetInt(SimulationThreads, 0)
+
+
 def suppressAllSpeedsWarning():
     return preferences().GetBool(WarningSuppressAllSpeeds, True)
 
@@ -22,6 +22,8 @@
 
 #include "PreCompiled.h"
 
+#include <Mod/Path/App/PathSegmentWalker.h>
+
 #include "PathSim.h"
 
 
@@ -30,6 +32,76 @@ using namespace PathSimulator;
 
 TYPESYSTEM_SOURCE(PathSimulator::PathSim , Base::BaseClass);
 
+namespace {
+
+/* collects the straight segments of a path as moves for cStock::ApplyMoves */
+class MoveCollector : public PathSegmentVisitor
+{
+public:
+	void setup(const Base::Vector3d & last) override
+	{
+		end = last;
+	}
+
+	void g0(int id, const Base::Vector3d & last, const Base::Vector3d & next, const std::deque<Base::Vector3d> & pts) override
+	{
+		addMoves(id, last, pts, next, true);
+	}
+
+	void g1(int id, const Base::Vector3d & last, const Base::Vector3d & next, const std::deque<Base::Vector3d> & pts) override
+	{
+		addMoves(id, last, pts, next, false);
+	}
+
+	void g23(int id, const Base::Vector3d & last, const Base::Vector3d & next, const std::deque<Base::Vector3d> & pts,
+			 const Base::Vector3d & /*center*/) override
+	{
+		addMoves(id, last, pts, next, false);
+	}
+
+	void g8x(int id, const Base::Vector3d & last, const Base::Vector3d & next, const std::deque<Base::Vector3d> & pts,
+			 const std::deque<Base::Vector3d> & p, const std::deque<Base::Vector3d> & /*q*/) override
+	{
+		// rapid to the hole and down to the retract plane, drill and retract,
+		// pecking does not change the removed material
+		addMoves(id, last, pts, p[0], true);
+		addMove(id, p[0], p[1], true);
+		addMove(id, p[1], next, false);
+		addMove(id, next, p[2], true);
+		end = p[2];
+	}
+
+	void g38(int /*id*/, const Base::Vector3d & /*last*/, const Base::Vector3d & next) override
+	{
+		// probing stops at the stock, it does not cut it
+		end = next;
+	}
+
+	std::vector<cSimMove> moves;
+	Base::Vector3d end;
+
+private:
+	void addMove(int id, const Base::Vector3d & from, const Base::Vector3d & to, bool rapid)
+	{
+		moves.push_back({ Point3D(from.x, from.y, from.z), Point3D(to.x, to.y, to.z), id, rapid });
+	}
+
+	void addMoves(int id, const Base::Vector3d & last, const std::deque<Base::Vector3d> & pts,
+				  const Base::Vector3d & next, bool rapid)
+	{
+		Base::Vector3d from = last;
+		for (auto & pt : pts)
+		{
+			addMove(id, from, pt, rapid);
+			from = pt;
+		}
+		addMove(id, from, next, rapid);
+		end = next;
+	}
+};
+
+}
+
 PathSim::PathSim()
 {
 }
@@ -42,6 +114,7 @@ void PathSim::BeginSimulation(Part::TopoShape * stock, float resolution)
 {
 	Base::BoundBox3d bbox = stock->getBoundBox();
 	m_stock = std::make_unique<cStock>(bbox.MinX, bbox.MinY, bbox.MinZ, bbox.LengthX(), bbox.LengthY(), bbox.LengthZ(), resolution);
+	m_events.clear();
 }
 
 void PathSim::SetToolShape(const TopoDS_Shape& toolShape, float resolution)
@@ -80,8 +153,21 @@ Base::Placement * PathSim::ApplyCommand(Base::Placement * pos, Command * cmd)
 	return plc;
 }
 
+Base::Placement * PathSim::ApplyToolpath(Base::Placement * pos, const Toolpath & path, int threads)
+{
+	// the walker takes care of arcs, drill cycles, relative moves and units
+	MoveCollector collector;
+	PathSegmentWalker walker(path);
+	walker.walk(collector, pos->getPosition());
+	if (m_tool && m_stock)
+		m_stock->ApplyMoves(collector.moves, *m_tool, threads, m_events);
 
+	Base::Placement *plc = new Base::Placement();
+	plc->setPosition(collector.end);
+	return plc;
+}
 
-
-
-
+double PathSim::GetRemovedVolume() const
+{
+	return m_stock ? m_stock->GetRemovedVolume() : 0.0;
+}
@@ -27,6 +27,7 @@
 #include <TopoDS_Shape.hxx>
 
 #include <Mod/Path/App/Command.h>
+#include <Mod/Path/App/Path.h>
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Path/PathGlobal.h>
 
@@ -51,10 +52,14 @@ namespace PathSimulator
 			void BeginSimulation(Part::TopoShape * stock, float resolution);
 			void SetToolShape(const TopoDS_Shape& toolShape, float resolution);
 			Base::Placement * ApplyCommand(Base::Placement * pos, Command * cmd);
+			/// apply all commands of a path at once, using threads to cut the stock (0: one per core)
+			Base::Placement * ApplyToolpath(Base::Placement * pos, const Toolpath & path, int threads);
+			double GetRemovedVolume() const;
 
 		public:
 			std::unique_ptr<cStock> m_stock;
 			std::unique_ptr<cSimTool> m_tool;
+			std::vector<cSimEvent> m_events;
 	};
 
 } //namespace Path
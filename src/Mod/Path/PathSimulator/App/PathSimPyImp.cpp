@@ -23,10 +23,12 @@
 #include "PreCompiled.h"
 
 #include <Base/PlacementPy.h>
+#include <Base/GeometryPyCXX.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/Path/App/CommandPy.h>
+#include <Mod/Path/App/PathPy.h>
 #include <Mod/Part/App/TopoShapePy.h>
 
 #include "PathSim.h"
@@ -125,12 +127,48 @@ PyObject* PathSimPy::ApplyCommand(PyObject * args, PyObject * kwds)
 	return newposPy;
 }
 
+PyObject* PathSimPy::ApplyPath(PyObject * args, PyObject * kwds)
+{
+	static const std::array<const char *, 4> kwlist { "position", "path", "threads", nullptr };
+	PyObject *pObjPlace;
+	PyObject *pObjPath;
+	int threads = 1;
+	if (!Base::Wrapped_ParseTupleAndKeywords(args, kwds, "O!O!|i", kwlist, &(Base::PlacementPy::Type), &pObjPlace,
+											 &(Path::PathPy::Type), &pObjPath, &threads)) {
+		return nullptr;
+	}
+	PathSim *sim = getPathSimPtr();
+	Base::Placement *pos = static_cast<Base::PlacementPy*>(pObjPlace)->getPlacementPtr();
+	Path::Toolpath *path = static_cast<Path::PathPy*>(pObjPath)->getToolpathPtr();
+	Base::Placement *newpos = sim->ApplyToolpath(pos, *path, threads);
+	return new Base::PlacementPy(newpos);
+}
+
 Py::Object PathSimPy::getTool() const
 {
     //return Py::Object();
     throw Py::AttributeError("Not yet implemented");
 }
 
+Py::Float PathSimPy::getRemovedVolume() const
+{
+	return Py::Float(getPathSimPtr()->GetRemovedVolume());
+}
+
+Py::List PathSimPy::getCollisions() const
+{
+	Py::List list;
+	for (const cSimEvent & event : getPathSimPtr()->m_events)
+	{
+		Py::Tuple tuple(3);
+		tuple.setItem(0, Py::Long(event.command));
+		tuple.setItem(1, Py::String(event.type == cSimEvent::RapidCut ? "Rapid" : "Holder"));
+		tuple.setItem(2, Py::Vector(Base::Vector3d(event.pos.x, event.pos.y, event.pos.z)));
+		list.append(tuple);
+	}
+	return list;
+}
+
 PyObject *PathSimPy::getCustomAttributes(const char* /*attr*/) const
 {
     return nullptr;
@@ -42,6 +42,7 @@
 #include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Boost
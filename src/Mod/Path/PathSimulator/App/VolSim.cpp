@@ -23,6 +23,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cmath>
+#include <set>
+#include <thread>
 #endif
 
 #include <BRepBndLib.hxx>
@@ -37,7 +40,7 @@
 // stock
 //************************************************************************************************************
 cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float res)
-	: m_px(px), m_py(py), m_pz(pz), m_lx(lx), m_ly(ly), m_lz(lz), m_res(res)
+	: m_px(px), m_py(py), m_pz(pz), m_lx(lx), m_ly(ly), m_lz(lz), m_res(res), m_removed(0)
 {
 	m_x = (int)(m_lx / res) + 1;
 	m_y = (int)(m_ly / res) + 1;
@@ -510,6 +513,84 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
 }
 
 void cStock::ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool & tool)
+{
+	cSimCut cut(0, m_y, tool.length);
+	ApplyLinearTool(p1, p2, tool, cut);
+	m_removed += cut.removed;
+}
+
+void cStock::ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool & tool, bool isCCW)
+{
+	cSimCut cut(0, m_y, tool.length);
+	ApplyCircularTool(p1, p2, cent, tool, isCCW, cut);
+	m_removed += cut.removed;
+}
+
+void cStock::ApplyMoves(const std::vector<cSimMove> & moves, cSimTool & tool, int threads, std::vector<cSimEvent> & events)
+{
+	if (threads <= 0)
+		threads = std::max(1, (int)std::thread::hardware_concurrency());
+	threads = std::max(1, std::min(threads, m_y));
+
+	// stock rows touched by each move
+	float rad = tool.radius / m_res + 1;
+	std::vector<std::pair<int, int>> rows(moves.size());
+	for (size_t i = 0; i < moves.size(); i++)
+	{
+		float y1 = (moves[i].start.y - m_py) / m_res;
+		float y2 = (moves[i].end.y - m_py) / m_res;
+		rows[i].first = (int)floor(std::min(y1, y2) - rad);
+		rows[i].second = (int)ceil(std::max(y1, y2) + rad);
+	}
+
+	// every thread owns a band of rows and applies all moves in order to it, so the
+	// result is the same as applying the moves one by one
+	std::vector<cSimCut> cuts;
+	std::vector<std::vector<std::pair<size_t, int>>> hits(threads);
+	for (int t = 0; t < threads; t++)
+		cuts.emplace_back(m_y * t / threads, m_y * (t + 1) / threads, tool.length);
+	auto work = [&](int t) {
+		cSimCut & cut = cuts[t];
+		for (size_t i = 0; i < moves.size(); i++)
+		{
+			if (rows[i].second < cut.yMin || rows[i].first >= cut.yMax)
+				continue;
+			cut.cut = false;
+			cut.buried = false;
+			Point3D p1 = moves[i].start;
+			Point3D p2 = moves[i].end;
+			ApplyLinearTool(p1, p2, tool, cut);
+			if (cut.cut && moves[i].rapid)
+				hits[t].emplace_back(i, cSimEvent::RapidCut);
+			if (cut.buried)
+				hits[t].emplace_back(i, cSimEvent::ToolBuried);
+		}
+	};
+	std::vector<std::thread> workers;
+	for (int t = 1; t < threads; t++)
+		workers.emplace_back(work, t);
+	work(0);
+	for (auto & worker : workers)
+		worker.join();
+
+	// report every kind of event once per command, independent of the number of threads
+	std::vector<std::pair<size_t, int>> all;
+	for (int t = 0; t < threads; t++)
+	{
+		m_removed += cuts[t].removed;
+		all.insert(all.end(), hits[t].begin(), hits[t].end());
+	}
+	std::sort(all.begin(), all.end());
+	std::set<std::pair<int, int>> reported;
+	for (auto & hit : all)
+	{
+		const cSimMove & move = moves[hit.first];
+		if (reported.insert(std::make_pair(move.command, hit.second)).second)
+			events.push_back({ move.command, (cSimEvent::Type)hit.second, move.end });
+	}
+}
+
+void cStock::ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool & tool, cSimCut & cut)
 {
 	// translate coordinates
 	Point3D pi1 = ToInner(p1);
@@ -536,19 +617,24 @@ void cStock::ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool & tool)
 		float t = -1;
 		for (int j = 0; j < radSteps; j++)
 		{
+			// only walk the part of the line inside the rows of the cut
+			int iStart = 0;
+			int iEnd = lenSteps;
+			if (fabs(mainWay.y) > SIM_EPSILON)
+			{
+				float i1 = (cut.yMin - 1 - start.y) / mainWay.y;
+				float i2 = (cut.yMax + 1 - start.y) / mainWay.y;
+				iStart = std::max(iStart, (int)floor(std::min(i1, i2)));
+				iEnd = std::min(iEnd, (int)ceil(std::max(i1, i2)) + 1);
+			}
+			else if (start.y < cut.yMin - 1 || start.y > cut.yMax + 1)
+				iEnd = 0;
 			float z = pi1.z + tool.GetToolProfileAt(t);
-			Point3D p = start;
-			for (int i = 0; i < lenSteps; i++)
+			for (int i = iStart; i < iEnd; i++)
 			{
-				int x = (int)p.x;
-				int y = (int)p.y;
-				if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-				{
-					if (m_stock[x][y] > z)
-						m_stock[x][y] = z;
-				}
-				p.Add(mainWay);
-				z += zstep;
+				int x = (int)(start.x + mainWay.x * i);
+				int y = (int)(start.y + mainWay.y * i);
+				CutCell(x, y, z + zstep * i, cut);
 			}
 			t += tstep;
 			start.Add(sideWay);
@@ -560,6 +646,8 @@ void cStock::ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool & tool)
 	// end cup
 	for (float r = 0.5f; r <= rad; r += (float)SIM_WALK_RES)
 	{
+		if (pi2.y + r < cut.yMin - 1 || pi2.y - r > cut.yMax + 1)
+			continue;
 		Point3D cupCirc(perpDirX * r, perpDirY * r, pi2.z);
 		float rotang = 180 * SIM_WALK_RES / (3.1415926535 * r);
 		cupCirc.SetRotationAngle(-rotang);
@@ -568,17 +656,13 @@ void cStock::ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool & tool)
 		{
 			int x = (int)(pi2.x + cupCirc.x);
 			int y = (int)(pi2.y + cupCirc.y);
-			if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-			{
-				if (m_stock[x][y] > z)
-					m_stock[x][y] = z;
-			}
+			CutCell(x, y, z, cut);
 			cupCirc.Rotate();
 		}
 	}
 }
 
-void cStock::ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool & tool, bool isCCW)
+void cStock::ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool & tool, bool isCCW, cSimCut & cut)
 {
 	// translate coordinates
 	Point3D pi1 = ToInner(p1);
@@ -629,11 +713,7 @@ void cStock::ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimT
 		{
 			int x = (int)(cpx + cupCirc.x);
 			int y = (int)(cpy + cupCirc.y);
-			if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-			{
-				if (m_stock[x][y] > z)
-					m_stock[x][y] = z;
-			}
+			CutCell(x, y, z, cut);
 			z += zstep;
 			cupCirc.Rotate();
 		}
@@ -656,11 +736,7 @@ void cStock::ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimT
 		{
 			int x = (int)(pi2.x + cupCirc.x);
 			int y = (int)(pi2.y + cupCirc.y);
-			if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-			{
-				if (m_stock[x][y] > z)
-					m_stock[x][y] = z;
-			}
+			CutCell(x, y, z, cut);
 			cupCirc.Rotate();
 		}
 	}
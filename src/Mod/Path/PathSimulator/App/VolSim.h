@@ -25,16 +25,19 @@
 #ifndef PATHSIMULATOR_VolSim_H
 #define PATHSIMULATOR_VolSim_H
 
+#include <algorithm>
 #include <vector>
 
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Path/App/Command.h>
+#include <Mod/Path/PathGlobal.h>
 
 
 #define SIM_EPSILON 0.00001
 #define SIM_TESSEL_TOP		1
 #define SIM_TESSEL_BOT		2
 #define SIM_WALK_RES		0.6   // step size in pixel units (to make sure all pixels in the path are visited)
+#define SIM_CUT_TOLERANCE	0.001 // depth below which a cell does not count as cut when checking for collisions
 
 struct toolShapePoint {
   float radiusPos;
@@ -98,6 +101,35 @@ struct cLineSegment
 	float lenXY;
 };
 
+/* a straight tool move in stock coordinates, the unit of work of cStock::ApplyMoves */
+struct cSimMove
+{
+	Point3D start;
+	Point3D end;
+	int command;	// index of the path command the move belongs to
+	bool rapid;
+};
+
+/* a move that removed material it should not have */
+struct cSimEvent
+{
+	enum Type { RapidCut = 0, ToolBuried = 1 };
+	int command;
+	Type type;
+	Point3D pos;	// end position of the offending move
+};
+
+/* the stock rows a tool move may change and what the move did in them */
+struct cSimCut
+{
+	cSimCut(int ymin, int ymax, float toolLength) : yMin(ymin), yMax(ymax), toolLength(toolLength) {}
+	int yMin, yMax;
+	float toolLength;
+	double removed = 0;		// removed volume in cell units (height * cells)
+	bool cut = false;		// material was removed
+	bool buried = false;	// material was removed above the tool length
+};
+
 class cSimTool
 {
 public:
@@ -139,7 +171,7 @@ private:
 	int height;
 };
 
-class cStock
+class PathSimulatorExport cStock
 {
 public:
 	cStock(float px, float py, float pz, float lx, float ly, float lz, float res);
@@ -148,6 +180,10 @@ public:
     void CreatePocket(float x, float y, float rad, float height);
     void ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool &tool);
     void ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool &tool, bool isCCW);
+    void ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool &tool, cSimCut & cut);
+    void ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool &tool, bool isCCW, cSimCut & cut);
+    void ApplyMoves(const std::vector<cSimMove> & moves, cSimTool &tool, int threads, std::vector<cSimEvent> & events);
+    double GetRemovedVolume() const { return m_removed * m_res * m_res; }
     inline Point3D ToInner(Point3D & p) {
 		return Point3D((p.x - m_px) / m_res, (p.y - m_py) / m_res, p.z);
 	}
@@ -161,6 +197,25 @@ private:
 	int TesselBot(int x, int y);
 	int TesselSidesX(int yp);
 	int TesselSidesY(int xp);
+	inline void CutCell(int x, int y, float z, cSimCut & cut)
+	{
+		if (x < 0 || y < cut.yMin || x >= m_x || y >= cut.yMax)
+			return;
+		float & height = m_stock[x][y];
+		if (height <= z)
+			return;
+		if (height > m_pz)
+		{
+			cut.removed += height - std::max(z, m_pz);
+			if (height > z + SIM_CUT_TOLERANCE)
+			{
+				cut.cut = true;
+				if (height > z + cut.toolLength)
+					cut.buried = true;
+			}
+		}
+		height = z;
+	}
 	Array2D<float>  m_stock;
 	Array2D<char> m_attr;
 	float m_px, m_py, m_pz;  // stock zero position
@@ -168,6 +223,7 @@ private:
 	float m_res;        // resoulution
 	float m_plane;		// stock plane height
 	int m_x, m_y;            // stock array size
+	double m_removed;	// removed volume in cell units
 	std::vector<MeshCore::MeshGeomFacet> facetsOuter;
 	std::vector<MeshCore::MeshGeomFacet> facetsInner;
 };
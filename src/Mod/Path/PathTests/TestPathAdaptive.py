@@ -414,6 +414,68 @@ class TestPathAdaptive(PathTestBase):
                 break
         self.assertTrue(isInBox, "No paths originating within the inner hole.")
 
+    def test08(self):
+        """test08() Verify separate regions cleared by multiple threads give the same paths."""
+        import area
+
+        pockets = []
+        for i in range(3):
+            for j in range(3):
+                x = i * 12.0
+                y = j * 12.0
+                pockets.append(
+                    [(x, y), (x + 8.0 + i, y), (x + 8.0 + i, y + 8.0 + j), (x, y + 8.0 + j)]
+                )
+        stock = [[(-5.0, -5.0), (40.0, -5.0), (40.0, 40.0), (-5.0, 40.0)]]
+
+        def execute(threads):
+            a2d = area.Adaptive2d()
+            a2d.toolDiameter = 2.0
+            a2d.stepOverFactor = 0.3
+            a2d.threads = threads
+            progress = []
+
+            def progressFn(tpaths):
+                progress.append(tpaths)
+                return False
+
+            results = a2d.Execute(stock, pockets, progressFn)
+            return results, progress
+
+        sequential, _ = execute(1)
+        parallel, progress = execute(4)
+
+        self.assertEqual(len(sequential), len(pockets))
+        self.assertEqual(len(parallel), len(sequential))
+        for seq, par in zip(sequential, parallel):
+            self.assertEqual(seq.StartPoint, par.StartPoint)
+            self.assertEqual(seq.AdaptivePaths, par.AdaptivePaths)
+            self.assertEqual(seq.ReturnMotionType, par.ReturnMotionType)
+        self.assertTrue(len(progress) > 0, "Progress not reported.")
+
+    def test09(self):
+        """test09() Verify the performance counters of the adaptive algorithm."""
+        import area
+
+        a2d = area.Adaptive2d()
+        a2d.toolDiameter = 2.0
+        pocket = [[(0.0, 0.0), (20.0, 0.0), (20.0, 20.0), (0.0, 20.0)]]
+
+        area.ResetAdaptivePerfCounters()
+        area.SetAdaptivePerfCountersEnabled(True)
+        try:
+            a2d.Execute(pocket, pocket, lambda tpaths: False)
+            counters = area.GetAdaptivePerfCounters()
+        finally:
+            area.SetAdaptivePerfCountersEnabled(False)
+            area.ResetAdaptivePerfCounters()
+
+        for name in ["ProcessPolyNode", "ExpandCleared"]:
+            totalTime, callCount = counters[name]
+            self.assertTrue(callCount > 0, "{} not counted.".format(name))
+            self.assertTrue(totalTime > 0.0, "{} not timed.".format(name))
+        self.assertEqual(area.GetAdaptivePerfCounters()["ExpandCleared"], (0.0, 0))
+
 
 # Eclass
 
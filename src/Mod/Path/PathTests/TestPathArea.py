@@ -0,0 +1,36 @@
+# -*- coding: utf-8 -*-
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+import FreeCAD
+import Part
+import Path
+from PathTests.PathTestUtils import PathTestBase
+
+
+class TestPathArea(PathTestBase):
+    """Unit tests for Path.Area."""
+
+    def makeArea(self, threads):
+        box = Part.makeBox(20, 20, 10)
+        hole = Part.makeCylinder(5, 10, FreeCAD.Vector(10, 10, 0))
+        cone = Part.makeCone(8, 2, 10, FreeCAD.Vector(40, 10, 0))
+        area = Path.Area()
+        area.setPlane(Part.makeCircle(1))
+        area.add(box.cut(hole).fuse(cone))
+        area.setParams(SectionThreads=threads)
+        return area
+
+    def test00(self):
+        """Verify parallel slicing returns the same sections in height order."""
+        heights = [9.5 - i for i in range(10)]
+        serial = self.makeArea(1).makeSections(mode=0, heights=heights)
+        parallel = self.makeArea(4).makeSections(mode=0, heights=heights)
+
+        self.assertEqual(len(serial), len(heights))
+        self.assertEqual(len(parallel), len(serial))
+        for expected, section in zip(serial, parallel):
+            expectedShape = expected.getShape()
+            shape = section.getShape()
+            self.assertRoughly(shape.BoundBox.ZMin, expectedShape.BoundBox.ZMin)
+            self.assertRoughly(shape.Length, expectedShape.Length)
+            self.assertEqual(len(shape.Wires), len(expectedShape.Wires))
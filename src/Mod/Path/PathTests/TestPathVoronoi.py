@@ -206,3 +206,54 @@ class TestPathVoronoi(PathTestUtils.PathTestBase):
         )
         self.assertRoughly(e.valueAt(e.FirstParameter).z, 2.37)
         self.assertRoughly(e.valueAt(e.LastParameter).z, 5.14)
+
+    def test70(self):
+        """Check medial axis wires are chained and match the edges"""
+
+        edges, wires, points, distances = vd.getMedialAxis(0)
+        self.assertNotEqual(len(wires), 0)
+        self.assertEqual(wires[0], 0)
+        self.assertEqual(wires[-1], len(edges))
+        self.assertEqual(len(points), 4 * len(edges))
+        self.assertEqual(len(distances), 2 * len(edges))
+
+        for w in range(len(wires) - 1):
+            for i in range(wires[w] + 1, wires[w + 1]):
+                self.assertRoughly(points[4 * i], points[4 * i - 2])
+                self.assertRoughly(points[4 * i + 1], points[4 * i - 1])
+
+        for i, index in enumerate(edges):
+            e = vd.getEdge(index)
+            self.assertEqual(e.Color, 0)
+            p0, p1 = e.Vertices
+            self.assertRoughly(points[4 * i], p0.X)
+            self.assertRoughly(points[4 * i + 3], p1.Y)
+            d0, d1 = e.getDistances()
+            self.assertRoughly(distances[2 * i], d0)
+            self.assertRoughly(distances[2 * i + 1], d1)
+
+    def test71(self):
+        """Check parallel construction of several diagrams"""
+
+        diagrams = []
+        for i in range(4):
+            d = Path.Voronoi.Diagram()
+            for p0, p1 in vd.getSegments():
+                d.addSegment(p0 + FreeCAD.Vector(i, 0), p1 + FreeCAD.Vector(i, 0))
+            diagrams.append(d)
+        Path.Voronoi.constructDiagrams(diagrams, 4)
+
+        for d in diagrams:
+            self.assertEqual(d.numEdges(), vd.numEdges())
+            self.assertEqual(d.numVertices(), vd.numVertices())
+
+    def test72(self):
+        """Check parallel construction of a diagram listed several times"""
+
+        d = Path.Voronoi.Diagram()
+        for p0, p1 in vd.getSegments():
+            d.addSegment(p0, p1)
+        Path.Voronoi.constructDiagrams([d, d, d, d], 4)
+
+        self.assertEqual(d.numEdges(), vd.numEdges())
+        self.assertEqual(d.numVertices(), vd.numVertices())
@@ -25,6 +25,7 @@ import TestApp
 from PathTests.TestPathProfile import TestPathProfile
 
 from PathTests.TestPathAdaptive import TestPathAdaptive
+from PathTests.TestPathArea import TestPathArea
 from PathTests.TestPathCore import TestPathCore
 from PathTests.TestPathDepthParams import depthTestCases
 from PathTests.TestPathDressupDogbone import TestDressupDogbone
@@ -86,6 +87,7 @@ False if TestHoldingTags.__name__ else True
 False if TestPathLanguage.__name__ else True
 False if TestOutputNameSubstitution.__name__ else True
 False if TestPathAdaptive.__name__ else True
+False if TestPathArea.__name__ else True
 False if TestPathCore.__name__ else True
 False if TestPathOpDeburr.__name__ else True
 False if TestPathDrillable.__name__ else True
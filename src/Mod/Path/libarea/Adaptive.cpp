@@ -26,6 +26,10 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <thread>
 
 namespace ClipperLib
 {
@@ -846,56 +850,81 @@ void ConnectPaths(Paths input, Paths &output)
 }
 
 // helper class for measuring performance
+// the counters are shared by the threads processing separate regions, so the start time is kept
+// per thread
+#ifdef DEV_MODE
+std::atomic<bool> perfCountersEnabled(true);
+#else
+std::atomic<bool> perfCountersEnabled(false);
+#endif
+
 class PerfCounter
 {
   public:
+	typedef std::chrono::steady_clock Clock;
+	static const size_t MAX_COUNTERS = 16;
+
 	PerfCounter(string p_name)
 	{
 		name = p_name;
-		count = 0;
-		running = false;
-		start_ticks = 0;
-		total_ticks = 0;
+		index = Counters().size();
+		Counters().push_back(this);
 	}
 	inline void Start()
 	{
-#ifdef DEV_MODE
-		start_ticks = clock();
-		if (running)
-		{
-			cerr << "PerfCounter already running:" << name << endl;
-		}
-		running = true;
-#endif
+		if (perfCountersEnabled)
+			StartTimes()[index] = Clock::now();
 	}
 	inline void Stop()
 	{
-#ifdef DEV_MODE
-		if (!running)
-		{
-			cerr << "PerfCounter not running:" << name << endl;
-		}
-		total_ticks += clock() - start_ticks;
-		start_ticks = clock();
+		Clock::time_point &start = StartTimes()[index];
+		if (start == Clock::time_point())
+			return; // not running, or counting was enabled while running
+		total_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
 		count++;
-		running = false;
-#endif
+		start = Clock::time_point();
+	}
+	double GetTotalTime() const
+	{
+		return double(total_ns) * 1e-9;
+	}
+	size_t GetCount() const
+	{
+		return count;
+	}
+	const string &GetName() const
+	{
+		return name;
+	}
+	void Reset()
+	{
+		total_ns = 0;
+		count = 0;
 	}
 	void DumpResults()
 	{
-		double total_time = double(total_ticks) / CLOCKS_PER_SEC;
+		double total_time = GetTotalTime();
 		cout << "Perf: " << name.c_str() << " total_time: " << total_time << " sec, call_count:" << count << " per_call:" << double(total_time / count) << endl;
-		start_ticks = clock();
-		total_ticks = 0;
-		count = 0;
+		Reset();
+	}
+
+	static std::vector<PerfCounter *> &Counters()
+	{
+		static std::vector<PerfCounter *> counters;
+		return counters;
 	}
 
   private:
+	static Clock::time_point *StartTimes()
+	{
+		static thread_local Clock::time_point startTimes[MAX_COUNTERS];
+		return startTimes;
+	}
+
 	string name;
-	clock_t start_ticks;
-	clock_t total_ticks;
-	size_t count;
-	bool running = false;
+	size_t index;
+	std::atomic<long long> total_ns{0};
+	std::atomic<size_t> count{0};
 };
 
 PerfCounter Perf_ProcessPolyNode("ProcessPolyNode");
@@ -909,23 +938,65 @@ PerfCounter Perf_AppendToolPath("AppendToolPath");
 PerfCounter Perf_IsAllowedToCutTrough("IsAllowedToCutTrough");
 PerfCounter Perf_IsClearPath("IsClearPath");
 
+void SetPerfCountersEnabled(bool enabled)
+{
+	perfCountersEnabled = enabled;
+}
+
+std::map<std::string, std::pair<double, size_t>> GetPerfCounters()
+{
+	std::map<std::string, std::pair<double, size_t>> result;
+	for (const PerfCounter *counter : PerfCounter::Counters())
+		result[counter->GetName()] = std::make_pair(counter->GetTotalTime(), counter->GetCount());
+	return result;
+}
+
+void ResetPerfCounters()
+{
+	for (PerfCounter *counter : PerfCounter::Counters())
+		counter->Reset();
+}
+
 //***********************************
 // Cleared area bounding support
 //***********************************
+// The cleared area is kept in square tiles, so that expanding and querying it only involves
+// polygons near the tool instead of the whole cleared area. Each tile holds the cleared area
+// clipped to the tile expanded by a margin larger than the focus BB, so the cleared area around
+// any tool position can be taken from a single tile. The area set by SetClearedPaths() is only
+// clipped into a tile once the tile is needed. Tiles are replaced but never modified, which makes
+// copying the whole cleared area cheap.
 class ClearedArea
 {
   public:
 	ClearedArea(ClipperLib::cInt p_toolRadiusScaled)
 	{
 		toolRadiusScaled = p_toolRadiusScaled;
+		tileMargin = std::max<ClipperLib::cInt>((focusBBFactor2 + 1) * toolRadiusScaled, 1);
+		tileSize = 2 * tileMargin;
+		basePaths = std::make_shared<Paths>();
+		clearedPaths = basePaths;
 	};
 
 	void SetClearedPaths(const Paths &paths)
 	{
-		clearedPaths = paths;
+		tiles.clear();
+		basePaths = std::make_shared<Paths>(paths);
+		clearedPaths = basePaths;
 		bboxPathsInvalid = true;
 		bboxClippedInvalid = true;
 	}
+
+	// takes over the cleared area of another instance, e.g. to remember the state before a pass
+	void SetCleared(const ClearedArea &other)
+	{
+		tiles = other.tiles;
+		basePaths = other.basePaths;
+		clearedPaths = other.clearedPaths;
+		bboxPathsInvalid = true;
+		bboxClippedInvalid = true;
+	}
+
 	void ExpandCleared(const Path toClearToolPath)
 	{
 		if (toClearToolPath.empty())
@@ -935,11 +1006,8 @@ class ClearedArea
 		clipof.AddPath(toClearToolPath, JoinType::jtRound, EndType::etOpenRound);
 		Paths toolCoverPoly;
 		clipof.Execute(toolCoverPoly, toolRadiusScaled + 1);
-		clip.Clear();
-		clip.AddPaths(clearedPaths, PolyType::ptSubject, true);
-		clip.AddPaths(toolCoverPoly, PolyType::ptClip, true);
-		clip.Execute(ClipType::ctUnion, clearedPaths);
-		CleanPolygons(clearedPaths);
+		UniteWithTiles(toolCoverPoly);
+		clearedPaths.reset();
 		bboxPathsInvalid = true;
 		bboxClippedInvalid = true;
 		Perf_ExpandCleared.Stop();
@@ -959,7 +1027,7 @@ class ClearedArea
 
 		BoundBox bb(toolPos, focusBBFactor2 * toolRadiusScaled);
 		clearedBoundedPaths.clear();
-		for (const auto &pth : clearedPaths)
+		for (const auto &pth : GetTile(GetTileKey(toolPos)))
 		{
 			if (pth.size() < 2)
 				continue;
@@ -1014,28 +1082,162 @@ class ClearedArea
 		bbPath.push_back(IntPoint(toolPos.X + delta2, toolPos.Y - delta2));
 		bbPath.push_back(IntPoint(toolPos.X + delta2, toolPos.Y + delta2));
 		bbPath.push_back(IntPoint(toolPos.X - delta2, toolPos.Y + delta2));
+		const Paths &tile = GetTile(GetTileKey(toolPos));
 		clip.Clear();
 		clip.AddPath(bbPath, PolyType::ptSubject, true);
-		clip.AddPaths(clearedPaths, PolyType::ptClip, true);
+		clip.AddPaths(tile, PolyType::ptClip, true);
 		clip.Execute(ClipType::ctIntersection, clearedBoundedClipped);
 		bboxClippedInvalid = false;
 		return clearedBoundedClipped;
 	}
 
+	// get cleared area, only exact inside the given bounding box
+	const Paths &GetClearedInBox(const BoundBox &bb)
+	{
+		TileKey key = GetTileKey(IntPoint((bb.minX + bb.maxX) / 2, (bb.minY + bb.maxY) / 2));
+		if (GetTileBounds(key).Contains(bb))
+			return GetTile(key);
+		return GetCleared();
+	}
+
 	// get full cleared area
-	Paths &GetCleared()
+	const Paths &GetCleared()
 	{
-		return clearedPaths;
+		if (!clearedPaths)
+		{
+			// the overlapping parts of the tiles cover their borders
+			clip.Clear();
+			clip.AddPaths(*basePaths, PolyType::ptSubject, true);
+			for (const auto &tile : tiles)
+				clip.AddPaths(*tile.second, PolyType::ptSubject, true);
+			auto paths = std::make_shared<Paths>();
+			clip.Execute(ClipType::ctUnion, *paths, PolyFillType::pftNonZero);
+			clearedPaths = paths;
+		}
+		return *clearedPaths;
 	}
 
   private:
+	typedef std::pair<ClipperLib::cInt, ClipperLib::cInt> TileKey;
+
+	ClipperLib::cInt TileIndex(ClipperLib::cInt coord) const
+	{
+		// rounds down also for negative coordinates
+		return coord >= 0 ? coord / tileSize : -((-coord + tileSize - 1) / tileSize);
+	}
+
+	TileKey GetTileKey(const IntPoint &pt) const
+	{
+		return TileKey(TileIndex(pt.X), TileIndex(pt.Y));
+	}
+
+	BoundBox GetTileBounds(const TileKey &key) const
+	{
+		BoundBox bb(IntPoint(key.first * tileSize - tileMargin, key.second * tileSize - tileMargin));
+		bb.AddPoint(IntPoint((key.first + 1) * tileSize + tileMargin, (key.second + 1) * tileSize + tileMargin));
+		return bb;
+	}
+
+	void ClipToTile(const TileKey &key, Paths &paths)
+	{
+		BoundBox tileBB = GetTileBounds(key);
+		Path tilePath;
+		tilePath.push_back(IntPoint(tileBB.minX, tileBB.minY));
+		tilePath.push_back(IntPoint(tileBB.maxX, tileBB.minY));
+		tilePath.push_back(IntPoint(tileBB.maxX, tileBB.maxY));
+		tilePath.push_back(IntPoint(tileBB.minX, tileBB.maxY));
+		clip.AddPath(tilePath, PolyType::ptClip, true);
+		clip.Execute(ClipType::ctIntersection, paths, PolyFillType::pftNonZero, PolyFillType::pftNonZero);
+	}
+
+	// the tile containing a point covers the focus BB around it
+	const Paths &GetTile(const TileKey &key)
+	{
+		static const Paths empty;
+		auto it = tiles.find(key);
+		if (it != tiles.end())
+			return *it->second;
+		if (basePaths->empty())
+			return empty;
+		auto tile = std::make_shared<Paths>();
+		clip.Clear();
+		clip.AddPaths(*basePaths, PolyType::ptSubject, true);
+		ClipToTile(key, *tile);
+		tiles.emplace(key, tile);
+		return *tile;
+	}
+
+	// unites the paths with all tiles they overlap
+	void UniteWithTiles(const Paths &paths)
+	{
+		std::vector<BoundBox> pathBBs;
+		BoundBox total;
+		for (const auto &pth : paths)
+		{
+			if (pth.empty())
+				continue;
+			BoundBox pathBB(pth.front());
+			for (const auto &pt : pth)
+				pathBB.AddPoint(pt);
+			if (pathBBs.empty())
+				total = pathBB;
+			total.AddPoint(IntPoint(pathBB.minX, pathBB.minY));
+			total.AddPoint(IntPoint(pathBB.maxX, pathBB.maxY));
+			pathBBs.push_back(pathBB);
+		}
+		if (pathBBs.empty())
+			return;
+
+		TileKey first = GetTileKey(IntPoint(total.minX - tileMargin, total.minY - tileMargin));
+		TileKey last = GetTileKey(IntPoint(total.maxX + tileMargin, total.maxY + tileMargin));
+		for (ClipperLib::cInt x = first.first; x <= last.first; x++)
+		{
+			for (ClipperLib::cInt y = first.second; y <= last.second; y++)
+			{
+				TileKey key(x, y);
+				BoundBox tileBB = GetTileBounds(key);
+				bool overlaps = false;
+				for (auto &pathBB : pathBBs)
+				{
+					if (pathBB.CollidesWith(tileBB))
+					{
+						overlaps = true;
+						break;
+					}
+				}
+				if (!overlaps)
+					continue;
+
+				const Paths &current = GetTile(key);
+				clip.Clear();
+				clip.AddPaths(current, PolyType::ptSubject, true);
+				size_t bbIndex = 0;
+				for (const auto &pth : paths)
+				{
+					if (!pth.empty() && pathBBs[bbIndex++].CollidesWith(tileBB))
+						clip.AddPath(pth, PolyType::ptSubject, true);
+				}
+				auto tile = std::make_shared<Paths>();
+				ClipToTile(key, *tile);
+				CleanPolygons(*tile);
+				if (tile->empty() && current.empty())
+					continue; // the paths only touch the tile
+				tiles[key] = tile;
+			}
+		}
+	}
+
 	Clipper clip;
 	ClipperOffset clipof;
-	Paths clearedPaths;
+	std::map<TileKey, std::shared_ptr<const Paths>> tiles;
+	std::shared_ptr<const Paths> basePaths; // set by SetClearedPaths(), included in tiles on demand
+	std::shared_ptr<const Paths> clearedPaths; // union of all, null if not yet created
 	Paths clearedBoundedClipped;
 	Paths clearedBoundedPaths;
 
 	ClipperLib::cInt toolRadiusScaled;
+	ClipperLib::cInt tileMargin;
+	ClipperLib::cInt tileSize;
 	BoundBox clearedBBClippedInFocus;
 	BoundBox clearedBBPathsInFocus;
 
@@ -1806,6 +2008,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 		clipof.AddPaths(inputPaths, JoinType::jtRound, EndType::etClosedPolygon);
 		Paths paths;
 		clipof.Execute(paths, -toolRadiusScaled - finishPassOffsetScaled - cornerRoundingOffset);
+		std::vector<std::pair<Paths, Paths>> regions;
 		for (const auto &current : paths)
 		{
 			int nesting = getPathNestingLevel(current, paths);
@@ -1830,14 +2033,16 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 				clipof.Clear();
 				clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
 				clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
-				ProcessPolyNode(boundPaths, toolBoundPaths);
+				regions.emplace_back(boundPaths, toolBoundPaths);
 			}
 		}
+		ProcessRegions(regions);
 	}
 
 	if (opType == OperationType::otProfilingInside || opType == OperationType::otProfilingOutside)
 	{
 		double offset = opType == OperationType::otProfilingInside ? -2 * (helixRampRadiusScaled + toolRadiusScaled) - RESOLUTION_FACTOR : 2 * (helixRampRadiusScaled + toolRadiusScaled) + RESOLUTION_FACTOR;
+		std::vector<std::pair<Paths, Paths>> regions;
 		for (const auto &current : inputPaths)
 		{
 			int nesting = getPathNestingLevel(current, inputPaths);
@@ -1889,14 +2094,98 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 					clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
 					clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
 
-					ProcessPolyNode(boundPaths, toolBoundPaths);
+					regions.emplace_back(boundPaths, toolBoundPaths);
 				}
 			}
 		}
+		ProcessRegions(regions);
 	}
 	return results;
 }
 
+void Adaptive2d::ProcessRegions(const std::vector<std::pair<Paths, Paths>> &regions)
+{
+	size_t threadCount = threads > 0 ? size_t(threads) : size_t(std::thread::hardware_concurrency());
+#ifdef DEV_MODE
+	threadCount = 1; // drawing and perf counters are not thread safe
+#endif
+	threadCount = std::min(threadCount, regions.size());
+	if (threadCount <= 1)
+	{
+		for (const auto &region : regions)
+			ProcessPolyNode(region.first, region.second, results);
+		return;
+	}
+
+	// the regions are cleared independently of each other, their results are merged in the
+	// order of the regions to get the same output as with sequential processing
+	std::vector<std::list<AdaptiveOutput>> regionResults(regions.size());
+	std::atomic<size_t> nextRegion(0);
+	size_t finishedThreads = 0;
+	std::exception_ptr error;
+
+	auto worker = [&]() {
+		try
+		{
+			for (size_t i = nextRegion++; i < regions.size() && !stopProcessing; i = nextRegion++)
+				ProcessPolyNode(regions[i].first, regions[i].second, regionResults[i]);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(progressMutex);
+			if (!error)
+				error = std::current_exception();
+			stopProcessing = true;
+		}
+		{
+			std::lock_guard<std::mutex> lock(progressMutex);
+			finishedThreads++;
+		}
+		progressCondition.notify_one();
+	};
+
+	collectProgress = true;
+	std::vector<std::thread> workers;
+	for (size_t i = 0; i < threadCount; i++)
+		workers.emplace_back(worker);
+
+	// the progress callback may call into python, so it's only invoked by this thread
+	auto interval = std::chrono::milliseconds(1000 * PROGRESS_TICKS / CLOCKS_PER_SEC);
+	try
+	{
+		std::unique_lock<std::mutex> lock(progressMutex);
+		for (bool done = false; !done;)
+		{
+			progressCondition.wait_for(lock, interval, [&]() { return finishedThreads == threadCount; });
+			done = finishedThreads == threadCount;
+			TPaths progressPaths;
+			progressPaths.swap(pendingProgress);
+			lock.unlock();
+			if (progressCallback && !progressPaths.empty())
+				if ((*progressCallback)(progressPaths))
+					stopProcessing = true; // call python function, if returns true signal stop processing
+			lock.lock();
+		}
+	}
+	catch (...)
+	{
+		stopProcessing = true;
+		for (auto &thread : workers)
+			thread.join();
+		collectProgress = false;
+		pendingProgress.clear();
+		throw;
+	}
+
+	for (auto &thread : workers)
+		thread.join();
+	collectProgress = false;
+	if (error)
+		std::rethrow_exception(error);
+	for (auto &regionResult : regionResults)
+		results.splice(results.end(), regionResult);
+}
+
 bool Adaptive2d::FindEntryPoint(TPaths &progressPaths, const Paths &toolBoundPaths, const Paths &boundPaths,
 								ClearedArea &clearedArea /*output-initial cleared area by helix*/,
 								IntPoint &entryPoint /*output*/,
@@ -2065,8 +2354,18 @@ bool Adaptive2d::IsClearPath(const Path &tp, ClearedArea &cleared, double safety
 	clipof.AddPath(tp, JoinType::jtRound, EndType::etOpenRound);
 	Paths toolShape;
 	clipof.Execute(toolShape, toolRadiusScaled + safetyClearance);
+	if (toolShape.empty() || toolShape.front().empty())
+	{
+		Perf_IsClearPath.Stop();
+		return true;
+	}
+	// only the cleared area around the path matters
+	BoundBox shapeBB(toolShape.front().front());
+	for (const auto &pth : toolShape)
+		for (const auto &pt : pth)
+			shapeBB.AddPoint(pt);
 	clip.AddPaths(toolShape, PolyType::ptSubject, true);
-	clip.AddPaths(cleared.GetCleared(), PolyType::ptClip, true);
+	clip.AddPaths(cleared.GetClearedInBox(shapeBB), PolyType::ptClip, true);
 	Paths crossing;
 	clip.Execute(ClipType::ctDifference, crossing);
 	double collisionArea = 0;
@@ -2557,8 +2856,16 @@ void Adaptive2d::CheckReportProgress(TPaths &progressPaths, bool force)
 	if (progressPaths.empty())
 		return;
 	if (progressCallback)
-		if ((*progressCallback)(progressPaths))
+	{
+		if (collectProgress)
+		{
+			// reported by the thread calling Execute(), see ProcessRegions()
+			std::lock_guard<std::mutex> lock(progressMutex);
+			pendingProgress.insert(pendingProgress.end(), progressPaths.begin(), progressPaths.end());
+		}
+		else if ((*progressCallback)(progressPaths))
 			stopProcessing = true; // call python function, if returns true signal stop processing
+	}
 	// clean the paths - keep the last point
 	if (progressPaths.back().second.empty())
 		return;
@@ -2599,11 +2906,11 @@ void Adaptive2d::AddPathToProgress(TPaths &progressPaths, const Path pth, Motion
 	}
 }
 
-void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
+void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths, std::list<AdaptiveOutput> &regionResults)
 {
 	Perf_ProcessPolyNode.Start();
-	current_region++;
-	cout << "** Processing region: " << current_region << endl;
+	int region = ++current_region;
+	cout << "** Processing region: " << region << endl;
 
 	// node paths are already constrained to tool boundary path for adaptive path before finishing pass
 	Clipper clip;
@@ -2704,7 +3011,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
 	clock_t start_clock = clock();
 #endif
 	ClearedArea clearedBeforePass(toolRadiusScaled);
-	clearedBeforePass.SetClearedPaths(cleared.GetCleared());
+	clearedBeforePass.SetCleared(cleared);
 
 	//*******************************
 	// LOOP - PASSES
@@ -2743,7 +3050,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
 		double clpParameter;
 		double passLength = 0;
 		double noCutDistance=0;
-		clearedBeforePass.SetClearedPaths(cleared.GetCleared());
+		clearedBeforePass.SetCleared(cleared);
 		//*******************************
 		// LOOP - POINTS
 		//*******************************
@@ -3099,9 +3406,10 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
 		returnPath << entryPoint;
 		output.ReturnMotionType = IsClearPath(returnPath, cleared) ? MotionType::mtLinkClear : MotionType::mtLinkNotClear;
 
+		Perf_ProcessPolyNode.Stop();
+
 		// dump performance results
 #ifdef DEV_MODE
-		Perf_ProcessPolyNode.Stop();
 		Perf_ProcessPolyNode.DumpResults();
 		Perf_PointIterations.DumpResults();
 		Perf_CalcCutAreaCirc.DumpResults();
@@ -3138,7 +3446,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
 				<< "Hint: try to modify accuracy and/or step-over." << endl;
 		}
 	}
-	results.push_back(output);
+	regionResults.push_back(output);
 }
 
 } // namespace AdaptivePath
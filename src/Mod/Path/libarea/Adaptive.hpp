@@ -21,6 +21,12 @@
 ***************************************************************************/
 
 #include "clipper.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
 #include <vector>
 #include <list>
 #include <time.h>
@@ -71,6 +77,11 @@ typedef std::pair<int, DPath> TPath; // first parameter is MotionType, must use
 
 class ClearedArea;
 
+// performance counters of the algorithm, e.g. for benchmarking; counting is disabled by default
+void SetPerfCountersEnabled(bool enabled);
+std::map<std::string, std::pair<double, size_t>> GetPerfCounters(); // name -> total seconds, call count
+void ResetPerfCounters();
+
 typedef std::vector<TPath> TPaths;
 
 struct AdaptiveOutput
@@ -81,7 +92,7 @@ struct AdaptiveOutput
 	int ReturnMotionType; // MotionType enum, problem with serialization if enum is used
 };
 
-// used to isolate state -> enable potential adding of multi-threaded processing of separate regions
+// used to isolate state -> separate regions may be processed by multiple threads, see threads
 
 class Adaptive2d
 {
@@ -95,6 +106,7 @@ class Adaptive2d
 	bool forceInsideOut = true;
 	bool finishingProfile = true;
 	double keepToolDownDistRatio = 3.0; // keep tool down distance ratio
+	int threads = 1; // number of threads clearing separate regions concurrently, 0 = one per CPU core
 	OperationType opType = OperationType::otClearingInside;
 
 	std::list<AdaptiveOutput> Execute(const DPaths &stockPaths, const DPaths &paths, std::function<bool(TPaths)> progressCallbackFn);
@@ -118,14 +130,21 @@ class Adaptive2d
 	long helixRampRadiusScaled = 0;
 	double referenceCutArea = 0;
 	double optimalCutAreaPD = 0;
-	bool stopProcessing = false;
-	int current_region=0;
-	clock_t lastProgressTime = 0;
+	std::atomic<bool> stopProcessing{false};
+	std::atomic<int> current_region{0};
+	std::atomic<clock_t> lastProgressTime{0};
 
 	std::function<bool(TPaths)> *progressCallback = NULL;
 	Path toolGeometry; // tool geometry at coord 0,0, should not be modified
 
-	void ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths);
+	// progress of the worker threads, reported by the thread calling Execute()
+	bool collectProgress = false;
+	std::mutex progressMutex;
+	std::condition_variable progressCondition;
+	TPaths pendingProgress;
+
+	void ProcessRegions(const std::vector<std::pair<Paths, Paths>> &regions);
+	void ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths, std::list<AdaptiveOutput> &regionResults);
 	bool FindEntryPoint(TPaths &progressPaths, const Paths &toolBoundPaths, const Paths &bound, ClearedArea &cleared /*output*/,
 						IntPoint &entryPoint /*output*/, IntPoint &toolPos, DoublePoint &toolDir);
 	bool FindEntryPointOutside(TPaths &progressPaths, const Paths &toolBoundPaths, const Paths &bound, ClearedArea &cleared /*output*/,
@@ -397,7 +397,13 @@ void init_pyarea(py::module &m){
 		//.def_readwrite("polyTreeNestingLimit", &Adaptive2d::polyTreeNestingLimit)
 		.def_readwrite("tolerance", &Adaptive2d::tolerance)
         .def_readwrite("keepToolDownDistRatio", &Adaptive2d::keepToolDownDistRatio)
+        .def_readwrite("threads", &Adaptive2d::threads)
 		.def_readwrite("opType", &Adaptive2d::opType);
+
+	// performance counters of Adaptive2d: name -> (total time in seconds, call count)
+	m.def("SetAdaptivePerfCountersEnabled", &SetPerfCountersEnabled);
+	m.def("GetAdaptivePerfCounters", &GetPerfCounters);
+	m.def("ResetAdaptivePerfCounters", &ResetPerfCounters);
 }
 
 PYBIND11_MODULE(area, m){
@@ -103,8 +103,8 @@ Base::BoundBox3d PointKernel::getBoundBox() const
     Concurrency::combinable<Base::BoundBox3d> bbs;
     // Cannot use a const_point_iterator here as it is *not* a proper iterator (fails the for_each
     // template)
-    Concurrency::parallel_for_each(_Points.begin(),
-                                   _Points.end(),
+    Concurrency::parallel_for_each(points().begin(),
+                                   points().end(),
                                    [this, &bbs](const value_type& value) {
                                        Base::Vector3d vertd(value.x, value.y, value.z);
                                        bbs.local().Add(this->_Mtrx * vertd);
@@ -124,7 +124,7 @@ Base::BoundBox3d PointKernel::getBoundBox() const
 void PointKernel::operator=(const PointKernel& Kernel)
 {
     if (this != &Kernel) {
-        // copy the mesh structure
+        // share the points until one of the kernels is modified
         setTransform(Kernel._Mtrx);
         this->_Points = Kernel._Points;
     }
@@ -132,7 +132,7 @@ void PointKernel::operator=(const PointKernel& Kernel)
 
 unsigned int PointKernel::getMemSize() const
 {
-    return _Points.size() * sizeof(value_type);
+    return points().size() * sizeof(value_type);
 }
 
 PointKernel::size_type PointKernel::countValid() const
@@ -175,9 +175,8 @@ void PointKernel::SaveDocFile(Base::Writer& writer) const
     uint32_t uCt = (uint32_t)size();
     str << uCt;
     // store the data without transforming it
-    for (const auto& pnt : _Points) {
-        str << pnt.x << pnt.y << pnt.z;
-    }
+    static_assert(sizeof(value_type) == 3 * sizeof(float), "Vector3f must not be padded");
+    str.writeArray(reinterpret_cast<const float*>(points().data()), 3 * points().size());
 }
 
 void PointKernel::Restore(Base::XMLReader& reader)
@@ -202,14 +201,11 @@ void PointKernel::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
-    _Points.resize(uCt);
-    for (unsigned long i = 0; i < uCt; i++) {
-        float x;
-        float y;
-        float z;
-        str >> x >> y >> z;
-        _Points[i].Set(x, y, z);
-    }
+    // no need to copy the points if shared, they get overwritten
+    clear();
+    auto& pts = points();
+    pts.resize(uCt);
+    str.readArray(reinterpret_cast<float*>(pts.data()), 3 * pts.size());
 }
 
 void PointKernel::save(const char* file) const
@@ -226,7 +222,7 @@ void PointKernel::load(const char* file)
 void PointKernel::save(std::ostream& out) const
 {
     out << "# ASCII" << std::endl;
-    for (const auto& pnt : _Points) {
+    for (const auto& pnt : points()) {
         out << pnt.x << " " << pnt.y << " " << pnt.z << std::endl;
     }
 }
@@ -236,7 +232,7 @@ void PointKernel::getPoints(std::vector<Base::Vector3d>& Points,
                             double /*Accuracy*/,
                             uint16_t /*flags*/) const
 {
-    unsigned long ctpoints = _Points.size();
+    unsigned long ctpoints = points().size();
     Points.reserve(ctpoints);
     for (unsigned long i = 0; i < ctpoints; i++) {
         Points.push_back(this->getPoint(i));
@@ -251,7 +247,7 @@ PointKernel::const_point_iterator::const_point_iterator(
     : _kernel(kernel)
     , _p_it(index)
 {
-    if (_p_it != kernel->_Points.end()) {
+    if (_p_it != kernel->points().end()) {
         value_type vertd(_p_it->x, _p_it->y, _p_it->z);
         this->_point = _kernel->_Mtrx * vertd;
     }
@@ -25,6 +25,7 @@
 #define POINTS_POINT_H
 
 #include <iterator>
+#include <memory>
 #include <vector>
 
 #include <App/ComplexGeoData.h>
@@ -84,19 +85,24 @@ public:
     }
     std::vector<value_type>& getBasicPoints()
     {
-        return this->_Points;
+        return points();
     }
     const std::vector<value_type>& getBasicPoints() const
     {
-        return this->_Points;
+        return points();
     }
     void setBasicPoints(const std::vector<value_type>& pts)
     {
-        this->_Points = pts;
+        if (_Points.use_count() > 1) {
+            _Points = std::make_shared<std::vector<value_type>>(pts);
+        }
+        else {
+            *_Points = pts;
+        }
     }
     void swap(std::vector<value_type>& pts)
     {
-        this->_Points.swap(pts);
+        points().swap(pts);
     }
 
     void getPoints(std::vector<Base::Vector3d>& Points,
@@ -110,6 +116,11 @@ public:
     //@{
     // Implemented from Persistence
     unsigned int getMemSize() const override;
+    /// Returns true if the points are shared with a copy of this kernel
+    bool isShared() const
+    {
+        return _Points.use_count() > 1;
+    }
     void Save(Base::Writer& writer) const override;
     void SaveDocFile(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
@@ -121,50 +132,72 @@ public:
     //@}
 
 private:
+    /// Returns the points for writing, they get copied first if shared with another kernel
+    std::vector<value_type>& points()
+    {
+        if (_Points.use_count() > 1) {
+            _Points = std::make_shared<std::vector<value_type>>(*_Points);
+        }
+        return *_Points;
+    }
+    const std::vector<value_type>& points() const
+    {
+        return *_Points;
+    }
+
     Base::Matrix4D _Mtrx;
-    std::vector<value_type> _Points;
+    // Copies of a kernel share the points until one of them is modified, so that e.g. the undo
+    // snapshot of a points property doesn't duplicate all the points
+    std::shared_ptr<std::vector<value_type>> _Points {
+        std::make_shared<std::vector<value_type>>()};
 
 public:
     /// number of points stored
     size_type size() const
     {
-        return this->_Points.size();
+        return points().size();
     }
     size_type countValid() const;
     std::vector<value_type> getValidPoints() const;
     void resize(size_type n)
     {
-        _Points.resize(n);
+        points().resize(n);
     }
     void reserve(size_type n)
     {
-        _Points.reserve(n);
+        points().reserve(n);
     }
     inline void erase(size_type first, size_type last)
     {
-        _Points.erase(_Points.begin() + first, _Points.begin() + last);
+        auto& pts = points();
+        pts.erase(pts.begin() + first, pts.begin() + last);
     }
 
     void clear()
     {
-        _Points.clear();
+        if (_Points.use_count() > 1) {
+            _Points = std::make_shared<std::vector<value_type>>();
+        }
+        else {
+            _Points->clear();
+        }
     }
 
 
     /// get the points
     inline const Base::Vector3d getPoint(const int idx) const
     {
-        return transformPointToOutside(_Points[idx]);
+        return transformPointToOutside(points()[idx]);
     }
     /// set the points
     inline void setPoint(const int idx, const Base::Vector3d& point)
     {
-        _Points[idx] = transformPointToInside(point);
+        points()[idx] = transformPointToInside(point);
     }
     /// insert the points
     inline void push_back(const Base::Vector3d& point)
     {
-        _Points.push_back(transformPointToInside(point));
+        points().push_back(transformPointToInside(point));
     }
 
     class PointsExport const_point_iterator
@@ -211,11 +244,11 @@ public:
     //@{
     const_point_iterator begin() const
     {
-        return {this, _Points.begin()};
+        return {this, points().begin()};
     }
     const_point_iterator end() const
     {
-        return {this, _Points.end()};
+        return {this, points().end()};
     }
     const_reverse_iterator rbegin() const
     {
@@ -135,6 +135,7 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 
 App::Property* PropertyPointKernel::Copy() const
 {
+    // the points are shared until one of the two kernels is modified
     PropertyPointKernel* prop = new PropertyPointKernel();
     (*prop->_cPoints) = (*this->_cPoints);
     return prop;
@@ -153,6 +154,11 @@ unsigned int PropertyPointKernel::getMemSize() const
     return sizeof(Base::Vector3f) * this->_cPoints->size();
 }
 
+unsigned int PropertyPointKernel::getUnsharedMemSize() const
+{
+    return this->_cPoints->isShared() ? 0 : getMemSize();
+}
+
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
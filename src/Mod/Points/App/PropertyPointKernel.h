@@ -68,6 +68,7 @@ public:
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property& from) override;
     unsigned int getMemSize() const override;
+    unsigned int getUnsharedMemSize() const override;
     //@}
 
     /** @name Save/restore */
@@ -70,6 +70,7 @@ TYPESYSTEM_SOURCE(Sketcher::Sketch, Base::Persistence)
 Sketch::Sketch()
     : SolveTime(0)
     , RecalculateInitialSolutionWhileMovingPoint(false)
+    , IncrementalSetUp(false)
     , resolveAfterGeometryUpdated(false)
     , GCSsys()
     , ConstraintsCounter(0)
@@ -137,6 +138,7 @@ void Sketch::clear()
     Constrs.clear();
 
     GCSsys.clear();
+    TopologySignature.clear();
     isInitMove = false;
     ConstraintsCounter = 0;
     Conflicting.clear();
@@ -199,6 +201,118 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
 {
     Base::TimeInfo start_time;
 
+    std::vector<double> signature;
+    if (IncrementalSetUp) {
+        signature = calculateTopologySignature(GeoList, ConstraintList, extGeoCount);
+
+        if (!signature.empty() && signature == TopologySignature
+            && updateParameters(GeoList, ConstraintList, extGeoCount)) {
+            if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
+                Base::TimeInfo end_time;
+
+                Base::Console().Log("Sketcher::setUpSketch()-Incremental-T:%s\n",
+                                    Base::TimeInfo::diffTime(start_time, end_time).c_str());
+            }
+
+            return GCSsys.dofsNumber();
+        }
+    }
+
+    std::vector<int> blockedGeoIds;
+    bool doesBlockAffectOtherConstraints =
+        buildSketch(GeoList, ConstraintList, extGeoCount, blockedGeoIds);
+
+    GCSsys.declareUnknowns(Parameters);
+    GCSsys.declareDrivenParams(DrivenParameters);
+    GCSsys.initSolution(defaultSolverRedundant);
+
+    // Post-analysis
+    // Now that we have all the parameters information, we deal properly with the block constraints
+    // if necessary
+    if (doesBlockAffectOtherConstraints) {
+
+        std::vector<double*> params_to_block;
+
+        bool unsatisfied_groups =
+            analyseBlockedConstraintDependentParameters(blockedGeoIds, params_to_block);
+
+        // I am unsure if more than one QR iterations are needed with the current implementation.
+        //
+        // With previous implementations mostly one QR iteration was enough, but if block constraint
+        // is abused, more iterations were needed.
+        int index = 0;
+        while (unsatisfied_groups) {
+            // We tried hard not to arrive to an unsatisfied group, so we try harder
+            // This loop has the advantage that the user will notice increased effort to solve,
+            // so they may understand that they are abusing the block constraint, while guaranteeing
+            // that wrong behaviour of the block constraint is not undetected.
+
+            // Another QR iteration
+            fixParametersAndDiagnose(params_to_block);
+
+            unsatisfied_groups =
+                analyseBlockedConstraintDependentParameters(blockedGeoIds, params_to_block);
+
+            if (debugMode == GCS::IterationLevel) {
+                Base::Console().Log("Sketcher::setUpSketch()-BlockConstraint-PostAnalysis:%d\n",
+                                    index);
+            }
+            index++;
+        }
+
+        // 2. If something needs blocking, block-it
+        fixParametersAndDiagnose(params_to_block);
+
+#ifdef DEBUG_BLOCK_CONSTRAINT
+        if (params_to_block.size() > 0) {
+            std::vector<std::vector<double*>> groups;
+            GCSsys.getDependentParamsGroups(groups);
+
+            // Debug code block
+            for (size_t i = 0; i < groups.size(); i++) {
+                Base::Console().Log("\nDepParams: Group %d:", i);
+                for (size_t j = 0; j < groups[i].size(); j++) {
+                    Base::Console().Log(
+                        "\n  Param=%x ,GeoId=%d, GeoPos=%d",
+                        param2geoelement.find(*std::next(groups[i].begin(), j))->first,
+                        param2geoelement.find(*std::next(groups[i].begin(), j))->second.first,
+                        param2geoelement.find(*std::next(groups[i].begin(), j))->second.second);
+                }
+            }
+        }
+#endif  // DEBUG_BLOCK_CONSTRAINT
+    }
+
+    // Now we set the Sketch status with the latest solver information
+    GCSsys.getConflicting(Conflicting);
+    GCSsys.getRedundant(Redundant);
+    GCSsys.getPartiallyRedundant(PartiallyRedundant);
+    GCSsys.getDependentParams(pDependentParametersList);
+
+    calculateDependentParametersElements();
+
+    // Only a healthy system is reused. Blocked geometry needing a post-analysis moves parameters
+    // between the free and fixed lists, so it is excluded as well.
+    if (IncrementalSetUp && !doesBlockAffectOtherConstraints && Conflicting.empty()
+        && Redundant.empty() && PartiallyRedundant.empty() && MalformedConstraints.empty()) {
+        TopologySignature = std::move(signature);
+    }
+
+    if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
+        Base::TimeInfo end_time;
+
+        Base::Console().Log("Sketcher::setUpSketch()-T:%s\n",
+                            Base::TimeInfo::diffTime(start_time, end_time).c_str());
+    }
+
+    return GCSsys.dofsNumber();
+}
+
+bool Sketch::buildSketch(const std::vector<Part::Geometry*>& GeoList,
+                         const std::vector<Constraint*>& ConstraintList,
+                         int extGeoCount,
+                         std::vector<int>& blockedGeoIds)
+{
     clear();
 
     std::vector<Part::Geometry*> intGeoList, extGeoList;
@@ -221,7 +335,6 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
 
     // Pre-analysis of blocked geometry (new block constraint) to fix geometry only affected by a
     // block constraint (see comment in Sketch.h)
-    std::vector<int> blockedGeoIds;
     bool doesBlockAffectOtherConstraints =
         analyseBlockedGeometry(intGeoList, ConstraintList, onlyBlockedGeometry, blockedGeoIds);
 
@@ -269,83 +382,157 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
         addConstraints(ConstraintList, unenforceableConstraints);
     }
     clearTemporaryConstraints();
-    GCSsys.declareUnknowns(Parameters);
-    GCSsys.declareDrivenParams(DrivenParameters);
-    GCSsys.initSolution(defaultSolverRedundant);
 
-    // Post-analysis
-    // Now that we have all the parameters information, we deal properly with the block constraints
-    // if necessary
-    if (doesBlockAffectOtherConstraints) {
+    return doesBlockAffectOtherConstraints;
+}
 
-        std::vector<double*> params_to_block;
+std::vector<double>
+Sketch::calculateTopologySignature(const std::vector<Part::Geometry*>& GeoList,
+                                   const std::vector<Constraint*>& ConstraintList,
+                                   int extGeoCount) const
+{
+    std::vector<double> signature;
 
-        bool unsatisfied_groups =
-            analyseBlockedConstraintDependentParameters(blockedGeoIds, params_to_block);
+    if (GeoList.empty()) {
+        return signature;
+    }
 
-        // I am unsure if more than one QR iterations are needed with the current implementation.
-        //
-        // With previous implementations mostly one QR iteration was enough, but if block constraint
-        // is abused, more iterations were needed.
-        int index = 0;
-        while (unsatisfied_groups) {
-            // We tried hard not to arrive to an unsatisfied group, so we try harder
-            // This loop has the advantage that the user will notice increased effort to solve,
-            // so they may understand that they are abusing the block constraint, while guaranteeing
-            // that wrong behaviour of the block constraint is not undetected.
+    signature.reserve(2 * GeoList.size() + 11 * ConstraintList.size() + 2);
+    signature.push_back(extGeoCount);
 
-            // Another QR iteration
-            fixParametersAndDiagnose(params_to_block);
+    for (auto geo : GeoList) {
+        // B-Spline constraints select their spans from the parameter values at creation time, so
+        // these can not be reused with different values
+        if (geo->is<GeomBSplineCurve>()) {
+            return {};
+        }
 
-            unsatisfied_groups =
-                analyseBlockedConstraintDependentParameters(blockedGeoIds, params_to_block);
+        signature.push_back(geo->getTypeId().getKey());
+        signature.push_back(GeometryFacade::getBlocked(geo) ? 1 : 0);
+    }
 
-            if (debugMode == GCS::IterationLevel) {
-                Base::Console().Log("Sketcher::setUpSketch()-BlockConstraint-PostAnalysis:%d\n",
-                                    index);
-            }
-            index++;
+    signature.push_back(ConstraintList.size());
+
+    for (auto constr : ConstraintList) {
+        signature.push_back(static_cast<int>(constr->Type));
+        signature.push_back(static_cast<int>(constr->AlignmentType));
+        signature.push_back(constr->First);
+        signature.push_back(static_cast<int>(constr->FirstPos));
+        signature.push_back(constr->Second);
+        signature.push_back(static_cast<int>(constr->SecondPos));
+        signature.push_back(constr->Third);
+        signature.push_back(static_cast<int>(constr->ThirdPos));
+        signature.push_back(constr->InternalAlignmentIndex);
+        signature.push_back((constr->isDriving ? 1 : 0) | (constr->isActive ? 2 : 0));
+
+        // the value of non-dimensional constraints selects the kind of solver constraint (e.g.
+        // internal or external tangency), so it is part of the topology
+        if (!constr->isDimensional()) {
+            signature.push_back(constr->getValue());
         }
 
-        // 2. If something needs blocking, block-it
-        fixParametersAndDiagnose(params_to_block);
+        // the solver decides between internal and external tangency of two circles or arcs from
+        // the geometry at creation time, so that decision is part of the topology as well
+        if (constr->Type == Tangent && constr->FirstPos == PointPos::none
+            && constr->SecondPos == PointPos::none && constr->Third == GeoEnum::GeoUndef) {
+            signature.push_back(isInternalTangency(GeoList, constr->First, constr->Second) ? 1 : 0);
+        }
+    }
 
-#ifdef DEBUG_BLOCK_CONSTRAINT
-        if (params_to_block.size() > 0) {
-            std::vector<std::vector<double*>> groups;
-            GCSsys.getDependentParamsGroups(groups);
+    return signature;
+}
 
-            // Debug code block
-            for (size_t i = 0; i < groups.size(); i++) {
-                Base::Console().Log("\nDepParams: Group %d:", i);
-                for (size_t j = 0; j < groups[i].size(); j++) {
-                    Base::Console().Log(
-                        "\n  Param=%x ,GeoId=%d, GeoPos=%d",
-                        param2geoelement.find(*std::next(groups[i].begin(), j))->first,
-                        param2geoelement.find(*std::next(groups[i].begin(), j))->second.first,
-                        param2geoelement.find(*std::next(groups[i].begin(), j))->second.second);
-                }
-            }
+bool Sketch::isInternalTangency(const std::vector<Part::Geometry*>& GeoList,
+                                int geoId1,
+                                int geoId2)
+{
+    auto getCircle = [&GeoList](int geoId, Base::Vector3d& center, double& radius) {
+        if (geoId < 0) {
+            geoId += GeoList.size();
         }
-#endif  // DEBUG_BLOCK_CONSTRAINT
+        if (geoId < 0 || geoId >= int(GeoList.size())) {
+            return false;
+        }
+
+        const Part::Geometry* geo = GeoList[geoId];
+        if (geo->is<GeomCircle>()) {
+            auto circle = static_cast<const GeomCircle*>(geo);
+            center = circle->getCenter();
+            radius = circle->getRadius();
+            return true;
+        }
+        if (geo->is<GeomArcOfCircle>()) {
+            auto arc = static_cast<const GeomArcOfCircle*>(geo);
+            center = arc->getCenter();
+            radius = arc->getRadius();
+            return true;
+        }
+        return false;
+    };
+
+    Base::Vector3d center1, center2;
+    double radius1, radius2;
+    if (!getCircle(geoId1, center1, radius1) || !getCircle(geoId2, center2, radius2)) {
+        return false;
     }
 
-    // Now we set the Sketch status with the latest solver information
-    GCSsys.getConflicting(Conflicting);
-    GCSsys.getRedundant(Redundant);
-    GCSsys.getPartiallyRedundant(PartiallyRedundant);
-    GCSsys.getDependentParams(pDependentParametersList);
+    // same criterion as GCS::System::addConstraintTangent() for circles and arcs
+    double dx = center2.x - center1.x;
+    double dy = center2.y - center1.y;
+    double d = std::sqrt(dx * dx + dy * dy);
+    return d < radius1 || d < radius2;
+}
 
-    calculateDependentParametersElements();
+bool Sketch::updateParameters(const std::vector<Part::Geometry*>& GeoList,
+                              const std::vector<Constraint*>& ConstraintList,
+                              int extGeoCount)
+{
+    // The same topology leads to the same parameters being allocated in the same order. So the
+    // sketch is built on a scratch object without any diagnosis, and the values are transferred
+    // index by index to the parameters referenced by the existing solver system.
+    Sketch scratch;
+    std::vector<int> blockedGeoIds;
+    scratch.buildSketch(GeoList, ConstraintList, extGeoCount, blockedGeoIds);
 
-    if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
-        Base::TimeInfo end_time;
+    if (scratch.Parameters.size() != Parameters.size()
+        || scratch.FixParameters.size() != FixParameters.size()
+        || scratch.DrivenParameters.size() != DrivenParameters.size()
+        || scratch.Geoms.size() != Geoms.size() || scratch.Constrs.size() != Constrs.size()
+        || !scratch.MalformedConstraints.empty()) {
+        return false;
+    }
 
-        Base::Console().Log("Sketcher::setUpSketch()-T:%s\n",
-                            Base::TimeInfo::diffTime(start_time, end_time).c_str());
+    clearTemporaryConstraints();
+    isInitMove = false;
+
+    auto transferValues = [](const std::vector<double*>& from, std::vector<double*>& to) {
+        for (std::size_t i = 0; i < from.size(); i++) {
+            if (*to[i] != *from[i]) {
+                *to[i] = *from[i];
+            }
+        }
+    };
+
+    // driven parameters are a subset of the parameters
+    transferValues(scratch.Parameters, Parameters);
+    transferValues(scratch.FixParameters, FixParameters);
+
+    // take over the new geometry copies (with their extensions) and constraint pointers, the
+    // scratch sketch deletes the previous geometry copies
+    for (std::size_t i = 0; i < Geoms.size(); i++) {
+        std::swap(Geoms[i].geo, scratch.Geoms[i].geo);
+    }
+    for (std::size_t i = 0; i < Constrs.size(); i++) {
+        Constrs[i].constr = scratch.Constrs[i].constr;
     }
 
-    return GCSsys.dofsNumber();
+    // As the diagnosis is still valid, this only updates the reference and the subsystems.
+    GCSsys.initSolution(defaultSolverRedundant);
+
+    pDependencyGroups.clear();
+    calculateDependentParametersElements();
+
+    return true;
 }
 
 void Sketch::buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList)
@@ -201,6 +201,25 @@ public:
         RecalculateInitialSolutionWhileMovingPoint = recalculateInitialSolutionWhileMovingPoint;
     }
 
+    /**
+     * Sets whether setUpSketch() may reuse the solver system of the previous set up when the
+     * topology of the sketch (geometry types, block status and constraint definitions) did not
+     * change. In that case only the parameter values are updated and the diagnosis is kept, which
+     * avoids the QR decomposition for example between successive drag steps.
+     */
+    bool getIncrementalSetUp() const
+    {
+        return IncrementalSetUp;
+    }
+
+    void setIncrementalSetUp(bool incrementalSetUp)
+    {
+        IncrementalSetUp = incrementalSetUp;
+        if (!IncrementalSetUp) {
+            TopologySignature.clear();
+        }
+    }
+
     /// add dedicated geometry
     //@{
     /// add a point
@@ -522,6 +541,10 @@ public:
 protected:
     float SolveTime;
     bool RecalculateInitialSolutionWhileMovingPoint;
+    bool IncrementalSetUp;
+
+    // signature of the topology of the last full set up, empty if it can not be reused
+    std::vector<double> TopologySignature;
 
     // regulates a second solve for cases where there result of having update the geometry (e.g. via
     // OCCT) needs to be taken into account by the solver (for example to provide the right value of
@@ -641,6 +664,10 @@ public:
     {
         GCSsys.sketchSizeMultiplierRedundant = mult;
     }
+    inline void setParallelClusterSolving(bool parallel)
+    {
+        GCSsys.parallelClusterSolving = parallel;
+    }
     inline void setConvergence(double conv)
     {
         GCSsys.convergence = conv;
@@ -723,6 +750,37 @@ private:
 
     void buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList);
 
+    /** Clears the sketch and adds the provided geometry and constraints, without initialising the
+     * solver. Returns whether the block constraints need a post-analysis, providing in that case
+     * the affected geometries in blockedGeoIds.
+     */
+    bool buildSketch(const std::vector<Part::Geometry*>& GeoList,
+                     const std::vector<Constraint*>& ConstraintList,
+                     int extGeoCount,
+                     std::vector<int>& blockedGeoIds);
+
+    /** Calculates a signature of everything that determines the structure of the solver system.
+     * Returns an empty signature if the sketch can not be set up incrementally.
+     */
+    std::vector<double>
+    calculateTopologySignature(const std::vector<Part::Geometry*>& GeoList,
+                               const std::vector<Constraint*>& ConstraintList,
+                               int extGeoCount) const;
+
+    /** Returns whether the solver would set up the tangency of the two circles or arcs as internal
+     * tangency for the provided geometry. Returns false if either one is not a circle or an arc.
+     */
+    static bool
+    isInternalTangency(const std::vector<Part::Geometry*>& GeoList, int geoId1, int geoId2);
+
+    /** Transfers the parameter values of the provided geometry and constraints to the existing
+     * solver system, keeping the current diagnosis. Returns false if the system could not be
+     * reused, in which case a full set up is necessary.
+     */
+    bool updateParameters(const std::vector<Part::Geometry*>& GeoList,
+                          const std::vector<Constraint*>& ConstraintList,
+                          int extGeoCount);
+
     int internalSolve(std::string& solvername, int level = 0);
 
     /// checks if the index bounds and converts negative indices to positive
@@ -573,6 +573,12 @@ public: /* Solver exposed interface */
         solvedSketch.setRecalculateInitialSolutionWhileMovingPoint(
             recalculateInitialSolutionWhileMovingPoint);
     }
+    /// enables/disables the reuse of the solver system between set ups of an unchanged sketch
+    /// topology (useful for dragging)
+    inline void setIncrementalSolverSetUp(bool incrementalSetUp)
+    {
+        solvedSketch.setIncrementalSetUp(incrementalSetUp);
+    }
     /// Forwards a request for a temporary initMove to the solver using the current sketch state as
     /// a reference (enables dragging)
     inline int initTemporaryMove(int geoId, PointPos pos, bool fine = true);
@@ -91,6 +91,15 @@ double Constraint::grad(double* /*param*/)
     return 0.0;
 }
 
+void Constraint::gradRow(double* gradout)
+{
+    for (std::size_t i = 0; i < pvec.size(); i++) {
+        // a parameter referenced several times is accounted for in its first entry
+        bool isRepeated = std::find(pvec.begin(), pvec.begin() + i, pvec[i]) != pvec.begin() + i;
+        gradout[i] = isRepeated ? 0.0 : grad(pvec[i]);
+    }
+}
+
 double Constraint::maxStep(MAP_pD_D& /*dir*/, double lim)
 {
     return lim;
@@ -147,6 +156,12 @@ double ConstraintEqual::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintEqual::gradRow(double* gradout)
+{
+    gradout[0] = scale;
+    gradout[1] = -scale;
+}
+
 
 // --------------------------------------------------------
 // Weighted Linear Combination
@@ -689,6 +704,13 @@ double ConstraintDifference::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintDifference::gradRow(double* gradout)
+{
+    gradout[0] = -scale;
+    gradout[1] = scale;
+    gradout[2] = -scale;
+}
+
 
 // --------------------------------------------------------
 // P2PDistance
@@ -749,6 +771,18 @@ double ConstraintP2PDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PDistance::gradRow(double* gradout)
+{
+    double dx = (*p1x() - *p2x());
+    double dy = (*p1y() - *p2y());
+    double d = sqrt(dx * dx + dy * dy);
+    gradout[0] = scale * dx / d;
+    gradout[1] = scale * dy / d;
+    gradout[2] = -scale * dx / d;
+    gradout[3] = -scale * dy / d;
+    gradout[4] = -scale;
+}
+
 double ConstraintP2PDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -860,6 +894,25 @@ double ConstraintP2PAngle::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PAngle::gradRow(double* gradout)
+{
+    double dx = (*p2x() - *p1x());
+    double dy = (*p2y() - *p1y());
+    double a = *angle() + da;
+    double ca = cos(a);
+    double sa = sin(a);
+    double x = dx * ca + dy * sa;
+    double y = -dx * sa + dy * ca;
+    double r2 = dx * dx + dy * dy;
+    dx = -y / r2;
+    dy = x / r2;
+    gradout[0] = scale * (-ca * dx + sa * dy);
+    gradout[1] = scale * (-sa * dx - ca * dy);
+    gradout[2] = scale * (ca * dx - sa * dy);
+    gradout[3] = scale * (sa * dx + ca * dy);
+    gradout[4] = -scale;
+}
+
 double ConstraintP2PAngle::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it = dir.find(angle());
@@ -952,6 +1005,25 @@ double ConstraintP2LDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2LDistance::gradRow(double* gradout)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    double sign = area < 0 ? -scale : scale;
+    gradout[0] = sign * (y1 - y2) / d;
+    gradout[1] = sign * (x2 - x1) / d;
+    gradout[2] = sign * ((y2 - y0) * d + (dx / d) * area) / d2;
+    gradout[3] = sign * ((x0 - x2) * d + (dy / d) * area) / d2;
+    gradout[4] = sign * ((y0 - y1) * d - (dx / d) * area) / d2;
+    gradout[5] = sign * ((x1 - x0) * d - (dy / d) * area) / d2;
+    gradout[6] = -scale;
+}
+
 double ConstraintP2LDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -1087,6 +1159,23 @@ double ConstraintPointOnLine::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPointOnLine::gradRow(double* gradout)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    gradout[0] = scale * (y1 - y2) / d;
+    gradout[1] = scale * (x2 - x1) / d;
+    gradout[2] = scale * ((y2 - y0) * d + (dx / d) * area) / d2;
+    gradout[3] = scale * ((x0 - x2) * d + (dy / d) * area) / d2;
+    gradout[4] = scale * ((y0 - y1) * d - (dx / d) * area) / d2;
+    gradout[5] = scale * ((x1 - x0) * d - (dy / d) * area) / d2;
+}
+
 
 // --------------------------------------------------------
 // PointOnPerpBisector
@@ -1240,6 +1329,22 @@ double ConstraintParallel::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintParallel::gradRow(double* gradout)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    gradout[0] = scale * dy2;
+    gradout[1] = -scale * dx2;
+    gradout[2] = -scale * dy2;
+    gradout[3] = scale * dx2;
+    gradout[4] = -scale * dy1;
+    gradout[5] = scale * dx1;
+    gradout[6] = scale * dy1;
+    gradout[7] = -scale * dx1;
+}
+
 
 // --------------------------------------------------------
 // Perpendicular
@@ -1326,6 +1431,22 @@ double ConstraintPerpendicular::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPerpendicular::gradRow(double* gradout)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    gradout[0] = scale * dx2;
+    gradout[1] = scale * dy2;
+    gradout[2] = -scale * dx2;
+    gradout[3] = -scale * dy2;
+    gradout[4] = scale * dx1;
+    gradout[5] = scale * dy1;
+    gradout[6] = -scale * dx1;
+    gradout[7] = -scale * dy1;
+}
+
 
 // --------------------------------------------------------
 // L2LAngle
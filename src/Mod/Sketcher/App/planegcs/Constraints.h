@@ -167,7 +167,11 @@ public:
     virtual void rescale(double coef = 1.);
     virtual double error();
     virtual double grad(double*);
-    // virtual void grad(MAP_pD_D &deriv);  --> TODO: vectorized grad version
+    // Calculates the partial derivatives of the error with respect to every entry of pvec in a
+    // single call, storing them in gradout (pvec.size() values). The derivative with respect to a
+    // parameter is the sum over the entries of pvec pointing to it. The default implementation
+    // calls grad() once per distinct parameter.
+    virtual void gradRow(double* gradout);
     virtual double maxStep(MAP_pD_D& dir, double lim = 1.);
     // Finds first occurrence of param in pvec. This is useful to test if a constraint depends
     // on the parameter (it may not actually depend on it, e.g. angle-via-point doesn't depend
@@ -196,6 +200,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
 };
 
 // Center of Gravity
@@ -376,6 +381,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
 };
 
 // P2PDistance
@@ -413,6 +419,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
@@ -452,6 +459,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
@@ -498,6 +506,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
     double abs(double darea);
 };
@@ -542,6 +551,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
 };
 
 // PointOnPerpBisector
@@ -634,6 +644,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
 };
 
 // Perpendicular
@@ -684,6 +695,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradRow(double* gradout) override;
 };
 
 // L2LAngle
@@ -47,10 +47,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cfloat>
 #include <future>
 #include <iostream>
 #include <limits>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -96,6 +98,7 @@
 #endif
 
 #include <Base/Console.h>
+#include <Base/TimeInfo.h>
 #include <FCConfig.h>
 
 #include <boost/graph/connected_components.hpp>
@@ -481,6 +484,7 @@ System::System()
     , dogLegGaussStep(FullPivLU)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
+    , parallelClusterSolving(false)
     , LM_eps(1E-10)
     , LM_eps1(1E-80)
     , LM_tau(1E-3)
@@ -1918,26 +1922,85 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    std::vector<int> clusters;  // clusters having something to solve
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            clusters.push_back(cid);
         }
-        if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res,
-                           solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+    }
+
+    if (!clusters.empty()) {
+        resetToReference();
+    }
+
+    std::vector<int> results(clusters.size(), Success);
+    std::vector<double> solveTimes(clusters.size(), 0.);
+
+    auto solveClusterAt = [&](std::size_t index) {
+        Base::TimeInfo start_time;
+        results[index] = solveCluster(clusters[index], isFine, alg, isRedundantsolving);
+        Base::TimeInfo end_time;
+        solveTimes[index] = Base::TimeInfo::diffTimeF(start_time, end_time);
+    };
+
+    // The clusters do not share any unknown, so they may be solved concurrently. The iteration
+    // level debug output is not thread-safe (Base::Console), so it forces sequential solving.
+    unsigned int threadsNum =
+        std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U), clusters.size());
+
+    bool parallel = parallelClusterSolving && threadsNum > 1 && debugMode != IterationLevel;
+
+    if (parallel) {
+        std::atomic<std::size_t> next(0);
+        auto worker = [&]() {
+            for (std::size_t index = next++; index < clusters.size(); index = next++) {
+                solveClusterAt(index);
+            }
+        };
+
+        std::vector<std::future<void>> futures;
+        for (unsigned int i = 1; i < threadsNum; i++) {
+            futures.push_back(std::async(std::launch::async, worker));
         }
-        else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+        worker();
+        for (auto& fut : futures) {
+            fut.get();
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+    }
+    else {
+        for (std::size_t index = 0; index < clusters.size(); index++) {
+            solveClusterAt(index);
         }
     }
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved. The results are merged in cluster order, so
+    // that the outcome does not depend on the order in which the clusters were solved.
+    int res = Success;
+    for (std::size_t index = 0; index < clusters.size(); index++) {
+        res = std::max(res, results[index]);
+    }
+
+    if (debugMode == IterationLevel) {
+        for (std::size_t index = 0; index < clusters.size(); index++) {
+            int cid = clusters[index];
+            Base::Console().Log(
+                "GCS::System::solve()-Cluster %d-Constraints: %d-Result: %d-T:%f\n",
+                cid,
+                int(clists[cid].size()),
+                results[index],
+                solveTimes[index]);
+        }
+    }
+    else if (debugMode == Minimal && clusters.size() > 1) {
+        auto slowest = std::max_element(solveTimes.begin(), solveTimes.end());
+        Base::Console().Log("GCS::System::solve()-%s-Clusters: %d-Slowest cluster %d-T:%f\n",
+                            parallel ? "Parallel" : "Sequential",
+                            int(clusters.size()),
+                            clusters[slowest - solveTimes.begin()],
+                            *slowest);
+    }
+
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
              constr != redundant.end();
@@ -1955,6 +2018,20 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
     return res;
 }
 
+int System::solveCluster(int cid, bool isFine, Algorithm alg, bool isRedundantsolving)
+{
+    if (subSystems[cid] && subSystemsAux[cid]) {
+        return solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
+    }
+    else if (subSystems[cid]) {
+        return solve(subSystems[cid], isFine, alg, isRedundantsolving);
+    }
+    else if (subSystemsAux[cid]) {
+        return solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+    }
+    return Success;
+}
+
 int System::solve(SubSystem* subsys, bool isFine, Algorithm alg, bool isRedundantsolving)
 {
     if (alg == BFGS) {
@@ -4826,16 +4903,29 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
 
     J = Eigen::MatrixXd::Zero(clist.size(), pdiagnoselist.size());
 
+    std::map<double*, int> diagnosecolumn;
+    for (int j = 0; j < int(pdiagnoselist.size()); j++) {
+        diagnosecolumn[pdiagnoselist[j]] = j;
+    }
+
     int jacobianconstraintcount = 0;
     int allcount = 0;
+    VEC_D row;
     for (std::vector<Constraint*>::iterator constr = clist.begin(); constr != clist.end();
          ++constr) {
         (*constr)->revertParams();
         ++allcount;
         if ((*constr)->getTag() >= 0 && (*constr)->isDriving()) {
             jacobianconstraintcount++;
-            for (int j = 0; j < int(pdiagnoselist.size()); j++) {
-                J(jacobianconstraintcount - 1, j) = (*constr)->grad(pdiagnoselist[j]);
+            // the whole gradient row of the constraint is obtained in a single call
+            VEC_pD constrparams = (*constr)->params();
+            row.resize(constrparams.size());
+            (*constr)->gradRow(row.data());
+            for (std::size_t k = 0; k < constrparams.size(); k++) {
+                auto column = diagnosecolumn.find(constrparams[k]);
+                if (column != diagnosecolumn.end()) {
+                    J(jacobianconstraintcount - 1, column->second) += row[k];
+                }
             }
 
             // parallel processing: create tag multiplicity map
@@ -143,6 +143,7 @@ private:
 
     bool emptyDiagnoseMatrix;  // false only if there is at least one driving constraint.
 
+    int solveCluster(int cid, bool isFine, Algorithm alg, bool isRedundantsolving);
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
@@ -226,6 +227,7 @@ public:
     DogLegGaussStep dogLegGaussStep;
     double qrpivotThreshold;
     DebugMode debugMode;
+    bool parallelClusterSolving;  // if true the independent clusters are solved concurrently
     double LM_eps;
     double LM_eps1;
     double LM_tau;
@@ -25,6 +25,7 @@
 #endif
 
 #include <iostream>
+#include <algorithm>
 #include <iterator>
 
 #include "SubSystem.h"
@@ -137,6 +138,28 @@ void SubSystem::initialize(VEC_pD& params, MAP_pD_pD& reductionmap)
         }
         //        (*constr)->redirectParams(pmap); // redirect parameters to pvec
     }
+
+    c2pvalindex.clear();
+    c2pvalindex.reserve(csize);
+    for (Constraint* constr : clist) {
+        VEC_pD constr_params = constr->params();  // the constraints point to the original ones
+        std::vector<int> indices(constr_params.size(), -1);
+        for (std::size_t k = 0; k < constr_params.size(); k++) {
+            MAP_pD_pD::const_iterator pmapfind = pmap.find(constr_params[k]);
+            if (pmapfind != pmap.end()) {
+                indices[k] = static_cast<int>(pmapfind->second - pvals.data());
+            }
+        }
+        c2pvalindex.push_back(std::move(indices));
+    }
+
+    gradorder.resize(csize);
+    for (int i = 0; i < csize; i++) {
+        gradorder[i] = i;
+    }
+    std::stable_sort(gradorder.begin(), gradorder.end(), [this](int a, int b) {
+        return clist[a]->getTypeId() < clist[b]->getTypeId();
+    });
 }
 
 void SubSystem::redirectParams()
@@ -261,11 +284,28 @@ void SubSystem::calcResidual(Eigen::VectorXd& r, double& err)
 void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 {
     jacobi.setZero(csize, params.size());
+
+    // jacobian columns of each variable (several parameters may be reduced to the same variable)
+    std::vector<std::vector<int>> columns(psize);
     for (int j = 0; j < int(params.size()); j++) {
         MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
         if (pmapfind != pmap.end()) {
-            for (int i = 0; i < csize; i++) {
-                jacobi(i, j) = clist[i]->grad(pmapfind->second);
+            columns[pmapfind->second - pvals.data()].push_back(j);
+        }
+    }
+
+    // Each constraint provides its complete gradient row in one call. Constraints of the same
+    // type are evaluated one after the other.
+    VEC_D row;
+    for (int i : gradorder) {
+        const std::vector<int>& indices = c2pvalindex[i];
+        row.resize(indices.size());
+        clist[i]->gradRow(row.data());
+        for (std::size_t k = 0; k < indices.size(); k++) {
+            if (indices[k] >= 0) {
+                for (int j : columns[indices[k]]) {
+                    jacobi(i, j) += row[k];
+                }
             }
         }
     }
@@ -280,16 +320,26 @@ void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
 
+    // gradient with respect to each variable
+    VEC_D pvalgrad(psize, 0.);
+    VEC_D row;
+    for (int i : gradorder) {
+        const std::vector<int>& indices = c2pvalindex[i];
+        row.resize(indices.size());
+        clist[i]->gradRow(row.data());
+        double err = clist[i]->error();
+        for (std::size_t k = 0; k < indices.size(); k++) {
+            if (indices[k] >= 0) {
+                pvalgrad[indices[k]] += err * row[k];
+            }
+        }
+    }
+
     grad.setZero();
     for (int j = 0; j < int(params.size()); j++) {
         MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
         if (pmapfind != pmap.end()) {
-            std::vector<Constraint*> constrs = p2c[pmapfind->second];
-            for (std::vector<Constraint*>::const_iterator constr = constrs.begin();
-                 constr != constrs.end();
-                 ++constr) {
-                grad[j] += (*constr)->error() * (*constr)->grad(pmapfind->second);
-            }
+            grad[j] = pvalgrad[pmapfind->second - pvals.data()];
         }
     }
 }
@@ -45,6 +45,10 @@ private:
                      //        JacobianMatrix jacobi;  // jacobi matrix of the residuals
     std::map<Constraint*, VEC_pD> c2p;                // constraint to parameter adjacency list
     std::map<double*, std::vector<Constraint*>> p2c;  // parameter to constraint adjacency list
+    // for each constraint, index in pvals of each entry of its pvec (-1 if not a variable)
+    std::vector<std::vector<int>> c2pvalindex;
+    // constraint indices grouped by constraint type, the evaluation order of gradients
+    std::vector<int> gradorder;
     void initialize(VEC_pD& params, MAP_pD_pD& reductionmap);  // called by the constructors
 public:
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params);
@@ -48,6 +48,7 @@
 #define QR_PIVOT_THRESHOLD 1E-13  // under this value a Jacobian value is regarded as zero
 #define DEFAULT_SOLVER_DEBUG 1    // None=0, Minimal=1, IterationLevel=2
 #define MAX_ITER_MULTIPLIER false
+#define PARALLEL_CLUSTER_SOLVING false
 #define DEFAULT_DOGLEG_GAUSS_STEP 0  // FullPivLU = 0, LeastNormFullPivLU = 1, LeastNormLdlt = 2
 
 using namespace SketcherGui;
@@ -72,6 +73,7 @@ TaskSketcherSolverAdvanced::TaskSketcherSolverAdvanced(ViewProviderSketch* sketc
     ui->comboBoxDogLegGaussStep->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
+    ui->checkBoxParallelClusterSolving->onRestore();
     ui->lineEditConvergence->onRestore();
     ui->comboBoxQRMethod->onRestore();
     ui->lineEditQRPivotThreshold->onRestore();
@@ -105,6 +107,10 @@ void TaskSketcherSolverAdvanced::setupConnections()
             &QCheckBox::stateChanged,
             this,
             &TaskSketcherSolverAdvanced::onCheckBoxSketchSizeMultiplierStateChanged);
+    connect(ui->checkBoxParallelClusterSolving,
+            &QCheckBox::stateChanged,
+            this,
+            &TaskSketcherSolverAdvanced::onCheckBoxParallelClusterSolvingStateChanged);
     connect(ui->lineEditConvergence,
             &QLineEdit::editingFinished,
             this,
@@ -580,6 +586,20 @@ void TaskSketcherSolverAdvanced::onCheckBoxSketchSizeMultiplierStateChanged(int
     }
 }
 
+void TaskSketcherSolverAdvanced::onCheckBoxParallelClusterSolvingStateChanged(int state)
+{
+    if (state == Qt::Checked) {
+        ui->checkBoxParallelClusterSolving->onSave();
+        const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+            .setParallelClusterSolving(true);
+    }
+    else if (state == Qt::Unchecked) {
+        ui->checkBoxParallelClusterSolving->onSave();
+        const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+            .setParallelClusterSolving(false);
+    }
+}
+
 void TaskSketcherSolverAdvanced::onLineEditQRPivotThresholdEditingFinished()
 {
     QString text = ui->lineEditQRPivotThreshold->text();
@@ -701,6 +721,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
     hGrp->SetInt("RedundantSolverMaxIterations", MAX_ITER);
     hGrp->SetBool("SketchSizeMultiplier", MAX_ITER_MULTIPLIER);
     hGrp->SetBool("RedundantSketchSizeMultiplier", MAX_ITER_MULTIPLIER);
+    hGrp->SetBool("ParallelClusterSolving", PARALLEL_CLUSTER_SOLVING);
     hGrp->SetASCII("Convergence", QString::number(CONVERGENCE).toUtf8());
     hGrp->SetASCII("RedundantConvergence", QString::number(CONVERGENCE).toUtf8());
     hGrp->SetInt("QRMethod", DEFAULT_QRSOLVER);
@@ -711,6 +732,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
     ui->comboBoxDogLegGaussStep->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
+    ui->checkBoxParallelClusterSolving->onRestore();
     ui->lineEditConvergence->onRestore();
     ui->comboBoxQRMethod->onRestore();
     ui->lineEditQRPivotThreshold->onRestore();
@@ -744,6 +766,8 @@ void TaskSketcherSolverAdvanced::updateSketchObject()
         .setConvergence(ui->lineEditConvergence->text().toDouble());
     const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
         .setSketchSizeMultiplier(ui->checkBoxSketchSizeMultiplier->isChecked());
+    const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+        .setParallelClusterSolving(ui->checkBoxParallelClusterSolving->isChecked());
     const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
         .setMaxIter(ui->spinBoxMaxIter->value());
     const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch()).defaultSolver =
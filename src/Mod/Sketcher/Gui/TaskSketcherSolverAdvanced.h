@@ -52,6 +52,7 @@ private:
     void onComboBoxDogLegGaussStepCurrentIndexChanged(int index);
     void onSpinBoxMaxIterValueChanged(int i);
     void onCheckBoxSketchSizeMultiplierStateChanged(int state);
+    void onCheckBoxParallelClusterSolvingStateChanged(int state);
     void onLineEditConvergenceEditingFinished();
     void onComboBoxQRMethodCurrentIndexChanged(int index);
     void onLineEditQRPivotThresholdEditingFinished();
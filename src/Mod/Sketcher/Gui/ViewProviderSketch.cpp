@@ -198,6 +198,19 @@ void ViewProviderSketch::ParameterObserver::updateRecalculateInitialSolutionWhil
         hGrp2->GetBool("RecalculateInitialSolutionWhileDragging", true);
 }
 
+void ViewProviderSketch::ParameterObserver::updateIncrementalSolverSetUp(const std::string& string,
+                                                                         App::Property* property)
+{
+    (void)property;
+    (void)string;
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Sketcher");
+
+    Client.viewProviderParameters.incrementalSolverSetUp =
+        hGrp->GetBool("IncrementalSolverSetUp", true);
+}
+
 void ViewProviderSketch::ParameterObserver::subscribeToParameters()
 {
     try {
@@ -305,6 +318,11 @@ void ViewProviderSketch::ParameterObserver::initParameters()
               updateRecalculateInitialSolutionWhileDragging(string, property);
           },
           nullptr}},
+        {"IncrementalSolverSetUp",
+         {[this](const std::string& string, App::Property* property) {
+              updateIncrementalSolverSetUp(string, property);
+          },
+          nullptr}},
         {"GridSizePixelThreshold",
          {[this](const std::string& string, [[maybe_unused]] App::Property* property) {
               auto v = getSketcherGeneralParameter(string, 15);
@@ -2991,6 +3009,9 @@ bool ViewProviderSketch::setEdit(int ModNum)
     getSketchObject()->setRecalculateInitialSolutionWhileMovingPoint(
         viewProviderParameters.recalculateInitialSolutionWhileDragging);
 
+    // Reuse the solver system between set ups of an unchanged sketch topology while editing.
+    getSketchObject()->setIncrementalSolverSetUp(viewProviderParameters.incrementalSolverSetUp);
+
     // intercept del key press from main app
     listener = new ShortcutListener(this);
 
@@ -3141,6 +3162,9 @@ void ViewProviderSketch::unsetEdit(int ModNum)
 
     Workbench::leaveEditMode();
 
+    // Outside of edit mode every set up of the solver performs a full diagnosis.
+    getSketchObject()->setIncrementalSolverSetUp(false);
+
     if (listener) {
         Gui::getMainWindow()->removeEventFilter(listener);
         delete listener;
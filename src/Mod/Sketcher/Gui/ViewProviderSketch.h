@@ -194,6 +194,8 @@ private:
         void updateRecalculateInitialSolutionWhileDragging(const std::string& string,
                                                            App::Property* property);
 
+        void updateIncrementalSolverSetUp(const std::string& string, App::Property* property);
+
     private:
         ViewProviderSketch& Client;
         std::map<std::string,
@@ -456,6 +458,7 @@ private:
         bool handleEscapeButton = false;
         bool autoRecompute = false;
         bool recalculateInitialSolutionWhileDragging = false;
+        bool incrementalSolverSetUp = false;
 
         bool isShownVirtualSpace =
             false;  // indicates whether the present virtual space view is the
@@ -191,10 +191,11 @@ def getInfo(filename):
                 return None
             files = zfile.namelist()
             # check for meta-file if it's really a FreeCAD document
-            if files[0] == "Document.xml":
+            if files[0] in ("Document.xml", "Document.bxml"):
                 try:
-                    doc = zfile.read(files[0]).decode("utf-8")
-                except OSError as e:
+                    # the metadata of a binary encoded document cannot be searched as text
+                    doc = zfile.read(files[0]).decode("utf-8") if files[0] == "Document.xml" else ""
+                except (OSError, UnicodeDecodeError) as e:
                     print(
                         "Fail to load corrupted FCStd file: '{0}' with this error: {1}".format(
                             filename, str(e)
@@ -23,10 +23,16 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <exception>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <QtConcurrentMap>
 # include <BRep_Builder.hxx>
 # include <BRepBuilderAPI_Transform.hxx>
 # include <gp_Trsf.hxx>
 # include <gp_Vec.hxx>
+# include <Standard_Failure.hxx>
 # include <TopoDS.hxx>
 # include <TopoDS_Compound.hxx>
 # include <TopoDS_Edge.hxx>
@@ -36,8 +42,10 @@
 
 #include <boost_regex.hpp>
 
+#include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectPy.h>
+#include <App/DocumentPy.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
@@ -145,6 +153,10 @@ public:
         add_varargs_method("writeDXFPage", &Module::writeDXFPage,
             "writeDXFPage(page, filename): Exports a DrawPage to a DXF file."
         );
+        add_varargs_method("writeDXFPages", &Module::writeDXFPages,
+            "[filenames] = writeDXFPages(document or [pages], directory): Exports each DrawPage to directory/PageName.dxf.\n"
+            "The files are written in parallel."
+        );
         add_varargs_method("findCentroid", &Module::findCentroid,
             "vector = findCentroid(shape, direction): finds geometric centroid of shape looking in direction."
         );
@@ -414,41 +426,10 @@ private:
         try {
             App::DocumentObject* obj = nullptr;
             TechDraw::DrawViewPart* dvp = nullptr;
-            TechDraw::DXFOutput dxfOut;
-            std::string dxfText;
-            std::stringstream ss;
             if (PyObject_TypeCheck(viewObj, &(TechDraw::DrawViewPartPy::Type))) {
                 obj = static_cast<App::DocumentObjectPy*>(viewObj)->getDocumentObjectPtr();
                 dvp = static_cast<TechDraw::DrawViewPart*>(obj);
-                TechDraw::GeometryObjectPtr gObj = dvp->getGeometryObject();
-                TopoDS_Shape shape = ShapeUtils::mirrorShape(gObj->getVisHard());
-                ss << dxfOut.exportEdges(shape);
-                shape = ShapeUtils::mirrorShape(gObj->getVisOutline());
-                ss << dxfOut.exportEdges(shape);
-                if (dvp->SmoothVisible.getValue()) {
-                    shape = ShapeUtils::mirrorShape(gObj->getVisSmooth());
-                    ss << dxfOut.exportEdges(shape);
-                }
-                if (dvp->SeamVisible.getValue()) {
-                    shape = ShapeUtils::mirrorShape(gObj->getVisSeam());
-                    ss << dxfOut.exportEdges(shape);
-                }
-                if (dvp->HardHidden.getValue()) {
-                    shape = ShapeUtils::mirrorShape(gObj->getHidHard());
-                    ss << dxfOut.exportEdges(shape);
-                    shape = ShapeUtils::mirrorShape(gObj->getHidOutline());
-                    ss << dxfOut.exportEdges(shape);
-                }
-                if (dvp->SmoothHidden.getValue()) {
-                    shape = ShapeUtils::mirrorShape(gObj->getHidSmooth());
-                    ss << dxfOut.exportEdges(shape);
-                }
-                if (dvp->SeamHidden.getValue()) {
-                    shape = ShapeUtils::mirrorShape(gObj->getHidSeam());
-                    ss << dxfOut.exportEdges(shape);
-                }
-                // ss now contains all edges as Dxf
-                dxfReturn = Py::String(ss.str());
+                dxfReturn = Py::String(ViewExportCache::viewPartAsDxf(dvp));
            }
         }
         catch (Base::Exception &e) {
@@ -466,68 +447,13 @@ private:
             throw Py::TypeError("expected (DrawViewPart)");
         }
         Py::String svgReturn;
-        std::string grpHead1 = "<g fill=\"none\" stroke=\"#000000\" stroke-opacity=\"1\" stroke-width=\"";
-        std::string grpHead2 = "\" stroke-linecap=\"butt\" stroke-linejoin=\"miter\" stroke-miterlimit=\"4\">\n";
-        std::string grpTail  = "</g>\n";
         try {
             App::DocumentObject* obj = nullptr;
             TechDraw::DrawViewPart* dvp = nullptr;
-            TechDraw::SVGOutput svgOut;
-            std::string svgText;
-            std::stringstream ss;
             if (PyObject_TypeCheck(viewObj, &(TechDraw::DrawViewPartPy::Type))) {
                 obj = static_cast<App::DocumentObjectPy*>(viewObj)->getDocumentObjectPtr();
                 dvp = static_cast<TechDraw::DrawViewPart*>(obj);
-                TechDraw::GeometryObjectPtr gObj = dvp->getGeometryObject();
-                //visible group begin "<g ... >"
-                ss << grpHead1;
-//                double thick = dvp->LineWidth.getValue();
-                double thick = DrawUtil::getDefaultLineWeight("Thick");
-                ss << thick;
-                ss << grpHead2;
-                TopoDS_Shape shape = gObj->getVisHard();
-                ss << svgOut.exportEdges(shape);
-                shape = gObj->getVisOutline();
-                ss << svgOut.exportEdges(shape);
-                if (dvp->SmoothVisible.getValue()) {
-                    shape = gObj->getVisSmooth();
-                    ss << svgOut.exportEdges(shape);
-                }
-                if (dvp->SeamVisible.getValue()) {
-                    shape = gObj->getVisSeam();
-                    ss << svgOut.exportEdges(shape);
-                }
-                //visible group end "</g>"
-                ss << grpTail;
-
-                if ( dvp->HardHidden.getValue()  ||
-                     dvp->SmoothHidden.getValue() ||
-                     dvp->SeamHidden.getValue() ) {
-                    //hidden group begin
-                    ss << grpHead1;
-//                    thick = dvp->HiddenWidth.getValue();
-                    thick = DrawUtil::getDefaultLineWeight("Thin");
-                    ss << thick;
-                    ss << grpHead2;
-                    if (dvp->HardHidden.getValue()) {
-                        shape = gObj->getHidHard();
-                        ss << svgOut.exportEdges(shape);
-                        shape = gObj->getHidOutline();
-                        ss << svgOut.exportEdges(shape);
-                    }
-                    if (dvp->SmoothHidden.getValue()) {
-                        shape = gObj->getHidSmooth();
-                        ss << svgOut.exportEdges(shape);
-                    }
-                    if (dvp->SeamHidden.getValue()) {
-                        shape = gObj->getHidSeam();
-                        ss << svgOut.exportEdges(shape);
-                    }
-                    ss << grpTail;
-                    //hidden group end
-                }
-                // ss now contains all edges as Svg
-                svgReturn = Py::String(ss.str());
+                svgReturn = Py::String(ViewExportCache::viewPartAsSvg(dvp));
            }
         }
         catch (Base::Exception &e) {
@@ -538,83 +464,9 @@ private:
         return svgReturn;
     }
 
-    void write1ViewDxf( ImpExpDxfWrite& writer, TechDraw::DrawViewPart* dvp, bool alignPage)
+    static void write1ViewDxf( ImpExpDxfWrite& writer, TechDraw::DrawViewPart* dvp, bool alignPage)
     {
-        if(!dvp->hasGeometry())
-            return;
-        TechDraw::GeometryObjectPtr gObj = dvp->getGeometryObject();
-        TopoDS_Shape shape = ShapeUtils::mirrorShape(gObj->getVisHard());
-        double offX = 0.0;
-        double offY = 0.0;
-        if (dvp->isDerivedFrom(TechDraw::DrawProjGroupItem::getClassTypeId())) {
-            TechDraw::DrawProjGroupItem* dpgi = static_cast<TechDraw::DrawProjGroupItem*>(dvp);
-            TechDraw::DrawProjGroup*      dpg = dpgi->getPGroup();
-            if (dpg) {
-                offX = dpg->X.getValue();
-                offY = dpg->Y.getValue();
-            }
-        }
-        double dvpX(0.0);
-        double dvpY(0.0);
-        if (alignPage) {
-            dvpX = dvp->X.getValue() + offX;
-            dvpY = dvp->Y.getValue() + offY;
-        }
-        gp_Trsf xLate;
-        xLate.SetTranslation(gp_Vec(dvpX, dvpY, 0.0));
-        BRepBuilderAPI_Transform mkTrf(shape, xLate);
-        shape = mkTrf.Shape();
-        writer.exportShape(shape);
-        shape = ShapeUtils::mirrorShape(gObj->getVisOutline());
-        mkTrf.Perform(shape);
-        shape = mkTrf.Shape();
-        writer.exportShape(shape);
-        if (dvp->SmoothVisible.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getVisSmooth());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->SeamVisible.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getVisSeam());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->HardHidden.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getHidHard());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-            shape = ShapeUtils::mirrorShape(gObj->getHidOutline());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->SmoothHidden.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getHidSmooth());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->SeamHidden.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getHidSeam());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        //add the cosmetic edges also
-        std::vector<TechDraw::BaseGeomPtr> geoms = dvp->getEdgeGeometry();
-        std::vector<TopoDS_Edge> cosmeticEdges;
-        for (auto& g : geoms) {
-            if (g->getHlrVisible() && g->getCosmetic()) {
-                cosmeticEdges.push_back(g->getOCCEdge());
-            }
-        }
-        if (!cosmeticEdges.empty()) {
-            shape = ShapeUtils::mirrorShape(DrawUtil::vectorToCompound(cosmeticEdges));
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
+        for (auto& shape : ViewExportCache::viewPartDxfShapes(dvp, alignPage)) {
             writer.exportShape(shape);
         }
     }
@@ -658,6 +510,154 @@ private:
         return Py::None();
     }
 
+    //! a call to the dxf writer that exports part of a page
+    using DxfWriteOp = std::function<void(ImpExpDxfWrite&)>;
+
+    //! collect the writer calls that export the views on a page.  everything but the edges of
+    //! the DrawViewParts is read from the document here, so the calls can be run in another
+    //! thread.  the edges come from the export cache when the call runs.
+    static std::vector<DxfWriteOp> collectDXFPage(TechDraw::DrawPage* dPage)
+    {
+        std::vector<DxfWriteOp> ops;
+        auto views = dPage->getAllViews();
+        for (auto& view : views) {
+            if (view->isDerivedFrom(TechDraw::DrawViewPart::getClassTypeId())) {
+                TechDraw::DrawViewPart* dvp = static_cast<TechDraw::DrawViewPart*>(view);
+                std::string layerName = dvp->getNameInDocument();
+                ops.push_back([dvp, layerName](ImpExpDxfWrite& writer) {
+                    writer.setLayerName(layerName);
+                    write1ViewDxf(writer, dvp, true);
+                });
+
+            } else if (view->isDerivedFrom(TechDraw::DrawViewAnnotation::getClassTypeId())) {
+                TechDraw::DrawViewAnnotation* dva = static_cast<TechDraw::DrawViewAnnotation*>(view);
+                auto lines = dva->Text.getValues();
+                if (lines.empty()) {
+                    continue;
+                }
+                std::string layerName = dva->getNameInDocument();
+                double height = dva->TextSize.getValue();  //mm
+                Base::Vector3d loc(dva->X.getValue(), dva->Y.getValue(), 0.0);
+                std::string text = lines[0];
+                ops.push_back([layerName, height, loc, text](ImpExpDxfWrite& writer) {
+                    int just = 1;                              //centered
+                    writer.setLayerName(layerName);
+                    writer.exportText(text.c_str(), loc, loc, height, just);
+                });
+
+            } else if (view->isDerivedFrom(TechDraw::DrawViewDimension::getClassTypeId())) {
+                DrawViewDimension* dvd = static_cast<TechDraw::DrawViewDimension*>(view);
+                TechDraw::DrawViewPart* dvp = dvd->getViewPart();
+                if (!dvp) {
+                    continue;
+                }
+                double grandParentX = 0.0;
+                double grandParentY = 0.0;
+                if (dvp->isDerivedFrom(TechDraw::DrawProjGroupItem::getClassTypeId())) {
+                    TechDraw::DrawProjGroupItem* dpgi = static_cast<TechDraw::DrawProjGroupItem*>(dvp);
+                    TechDraw::DrawProjGroup* dpg = dpgi->getPGroup();
+                    if (!dpg) {
+                        continue;
+                    }
+                    grandParentX = dpg->X.getValue();
+                    grandParentY = dpg->Y.getValue();
+                }
+                double parentX = dvp->X.getValue() + grandParentX;
+                double parentY = dvp->Y.getValue() + grandParentY;
+                Base::Vector3d parentPos(parentX, parentY, 0.0);
+                std::string sDimText;
+                //this is the same code as in QGIViewDimension::updateDim
+                if (dvd->isMultiValueSchema()) {
+                    sDimText = dvd->getFormattedDimensionValue(0); //don't format multis
+                } else {
+                    sDimText = dvd->getFormattedDimensionValue(1);
+                }
+                float gap = 5.0;                                //hack. don't know font size here.
+                std::string layerName = dvd->getNameInDocument();
+                int type = 0;                                   //Aligned/Distance
+                if ( dvd->Type.isValue("Distance")  ||
+                     dvd->Type.isValue("DistanceX") ||
+                     dvd->Type.isValue("DistanceY") )  {
+                    Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
+                    Base::Vector3d lineLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
+                    pointPair pts = dvd->getLinearPoints();
+                    Base::Vector3d dimLine = pts.first() - pts.second();
+                    Base::Vector3d norm(-dimLine.y, dimLine.x, 0.0);
+                    norm.Normalize();
+                    lineLocn = lineLocn + (norm * gap);
+                    Base::Vector3d extLine1Start = Base::Vector3d(pts.first().x, - pts.first().y, 0.0) +
+                                                   Base::Vector3d(parentX, parentY, 0.0);
+                    Base::Vector3d extLine2Start = Base::Vector3d(pts.second().x, - pts.second().y, 0.0) +
+                                                   Base::Vector3d(parentX, parentY, 0.0);
+                    if (dvd->Type.isValue("DistanceX") ) {
+                        type = 1;
+                    } else if (dvd->Type.isValue("DistanceY") ) {
+                        type = 2;
+                    }
+                    ops.push_back([=](ImpExpDxfWrite& writer) mutable {
+                        char* dimText = &sDimText[0u];          //hack for const-ness
+                        writer.setLayerName(layerName);
+                        writer.exportLinearDim(textLocn, lineLocn, extLine1Start, extLine2Start, dimText, type);
+                    });
+                } else if (dvd->Type.isValue("Angle")) {
+                    Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
+                    Base::Vector3d lineLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
+                    anglePoints pts = dvd->getAnglePoints();
+                    Base::Vector3d end1 = pts.first();
+                    end1.y = -end1.y;
+                    Base::Vector3d end2 = pts.second();
+                    end2.y = -end2.y;
+
+                    Base::Vector3d apex = pts.vertex();
+                    apex.y = -apex.y;
+                    apex = apex + parentPos;
+
+                    Base::Vector3d dimLine = end2 - end1;
+                    Base::Vector3d norm(-dimLine.y, dimLine.x, 0.0);
+                    norm.Normalize();
+                    lineLocn = lineLocn + (norm * gap);
+                    end1 = end1 + parentPos;
+                    end2 = end2 + parentPos;
+                    ops.push_back([=](ImpExpDxfWrite& writer) mutable {
+                        char* dimText = &sDimText[0u];          //hack for const-ness
+                        writer.setLayerName(layerName);
+                        writer.exportAngularDim(textLocn, lineLocn, end1, end2, apex, dimText);
+                    });
+                } else if (dvd->Type.isValue("Radius")) {
+                    Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
+                    arcPoints pts = dvd->getArcPoints();
+                    pointPair arrowPts = dvd->getArrowPositions();
+                    Base::Vector3d center = pts.center;
+                    center.y = -center.y;
+                    center = center + parentPos;
+                    Base::Vector3d lineDir = (arrowPts.first() - arrowPts.second()).Normalize();
+                    Base::Vector3d arcPoint = center + lineDir * pts.radius;
+                    ops.push_back([=](ImpExpDxfWrite& writer) mutable {
+                        char* dimText = &sDimText[0u];          //hack for const-ness
+                        writer.setLayerName(layerName);
+                        writer.exportRadialDim(center, textLocn, arcPoint, dimText);
+                    });
+                } else if(dvd->Type.isValue("Diameter")){
+                    Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
+                    arcPoints pts = dvd->getArcPoints();
+                    pointPair arrowPts = dvd->getArrowPositions();
+                    Base::Vector3d center = pts.center;
+                    center.y = -center.y;
+                    center = center + parentPos;
+                    Base::Vector3d lineDir = (arrowPts.first() - arrowPts.second()).Normalize();
+                    Base::Vector3d end1 = center + lineDir * pts.radius;
+                    Base::Vector3d end2 = center - lineDir * pts.radius;
+                    ops.push_back([=](ImpExpDxfWrite& writer) mutable {
+                        char* dimText = &sDimText[0u];          //hack for const-ness
+                        writer.setLayerName(layerName);
+                        writer.exportDiametricDim(textLocn, end1, end2, dimText);
+                    });
+                }
+            }
+        }
+        return ops;
+    }
+
     Py::Object writeDXFPage(const Py::Tuple& args)
     {
         PyObject *pageObj(nullptr);
@@ -667,7 +667,6 @@ private:
         }
 
         std::string filePath = std::string(name);
-        std::string layerName = "none";
         PyMem_Free(name);
 
         try {
@@ -678,119 +677,8 @@ private:
             if (PyObject_TypeCheck(pageObj, &(TechDraw::DrawPagePy::Type))) {
                 obj = static_cast<App::DocumentObjectPy*>(pageObj)->getDocumentObjectPtr();
                 dPage = static_cast<TechDraw::DrawPage*>(obj);
-                auto views = dPage->getAllViews();
-                for (auto& view : views) {
-                    if (view->isDerivedFrom(TechDraw::DrawViewPart::getClassTypeId())) {
-                        TechDraw::DrawViewPart* dvp = static_cast<TechDraw::DrawViewPart*>(view);
-                        layerName = dvp->getNameInDocument();
-                        writer.setLayerName(layerName);
-                        write1ViewDxf(writer, dvp, true);
-
-                    } else if (view->isDerivedFrom(TechDraw::DrawViewAnnotation::getClassTypeId())) {
-                        TechDraw::DrawViewAnnotation* dva = static_cast<TechDraw::DrawViewAnnotation*>(view);
-                        layerName = dva->getNameInDocument();
-                        writer.setLayerName(layerName);
-                        double height = dva->TextSize.getValue();  //mm
-                        int just = 1;                              //centered
-                        Base::Vector3d loc(dva->X.getValue(), dva->Y.getValue(), 0.0);
-                        auto lines = dva->Text.getValues();
-                        writer.exportText(lines[0].c_str(), loc, loc, height, just);
-
-                    } else if (view->isDerivedFrom(TechDraw::DrawViewDimension::getClassTypeId())) {
-                        DrawViewDimension* dvd = static_cast<TechDraw::DrawViewDimension*>(view);
-                        TechDraw::DrawViewPart* dvp = dvd->getViewPart();
-                        if (!dvp) {
-                            continue;
-                        }
-                        double grandParentX = 0.0;
-                        double grandParentY = 0.0;
-                        if (dvp->isDerivedFrom(TechDraw::DrawProjGroupItem::getClassTypeId())) {
-                            TechDraw::DrawProjGroupItem* dpgi = static_cast<TechDraw::DrawProjGroupItem*>(dvp);
-                            TechDraw::DrawProjGroup* dpg = dpgi->getPGroup();
-                            if (!dpg) {
-                                continue;
-                            }
-                            grandParentX = dpg->X.getValue();
-                            grandParentY = dpg->Y.getValue();
-                        }
-                        double parentX = dvp->X.getValue() + grandParentX;
-                        double parentY = dvp->Y.getValue() + grandParentY;
-                        Base::Vector3d parentPos(parentX, parentY, 0.0);
-                        std::string sDimText;
-                        //this is the same code as in QGIViewDimension::updateDim
-                        if (dvd->isMultiValueSchema()) {
-                            sDimText = dvd->getFormattedDimensionValue(0); //don't format multis
-                        } else {
-                            sDimText = dvd->getFormattedDimensionValue(1);
-                        }
-                        char* dimText = &sDimText[0u];                  //hack for const-ness
-                        float gap = 5.0;                                //hack. don't know font size here.
-                        layerName = dvd->getNameInDocument();
-                        writer.setLayerName(layerName);
-                        int type = 0;                                   //Aligned/Distance
-                        if ( dvd->Type.isValue("Distance")  ||
-                             dvd->Type.isValue("DistanceX") ||
-                             dvd->Type.isValue("DistanceY") )  {
-                            Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
-                            Base::Vector3d lineLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
-                            pointPair pts = dvd->getLinearPoints();
-                            Base::Vector3d dimLine = pts.first() - pts.second();
-                            Base::Vector3d norm(-dimLine.y, dimLine.x, 0.0);
-                            norm.Normalize();
-                            lineLocn = lineLocn + (norm * gap);
-                            Base::Vector3d extLine1Start = Base::Vector3d(pts.first().x, - pts.first().y, 0.0) +
-                                                           Base::Vector3d(parentX, parentY, 0.0);
-                            Base::Vector3d extLine2Start = Base::Vector3d(pts.second().x, - pts.second().y, 0.0) +
-                                                           Base::Vector3d(parentX, parentY, 0.0);
-                            if (dvd->Type.isValue("DistanceX") ) {
-                                type = 1;
-                            } else if (dvd->Type.isValue("DistanceY") ) {
-                                type = 2;
-                            }
-                            writer.exportLinearDim(textLocn, lineLocn, extLine1Start, extLine2Start, dimText, type);
-                        } else if (dvd->Type.isValue("Angle")) {
-                            Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
-                            Base::Vector3d lineLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
-                            anglePoints pts = dvd->getAnglePoints();
-                            Base::Vector3d end1 = pts.first();
-                            end1.y = -end1.y;
-                            Base::Vector3d end2 = pts.second();
-                            end2.y = -end2.y;
-
-                            Base::Vector3d apex = pts.vertex();
-                            apex.y = -apex.y;
-                            apex = apex + parentPos;
-
-                            Base::Vector3d dimLine = end2 - end1;
-                            Base::Vector3d norm(-dimLine.y, dimLine.x, 0.0);
-                            norm.Normalize();
-                            lineLocn = lineLocn + (norm * gap);
-                            end1 = end1 + parentPos;
-                            end2 = end2 + parentPos;
-                            writer.exportAngularDim(textLocn, lineLocn, end1, end2, apex, dimText);
-                        } else if (dvd->Type.isValue("Radius")) {
-                            Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
-                            arcPoints pts = dvd->getArcPoints();
-                            pointPair arrowPts = dvd->getArrowPositions();
-                            Base::Vector3d center = pts.center;
-                            center.y = -center.y;
-                            center = center + parentPos;
-                            Base::Vector3d lineDir = (arrowPts.first() - arrowPts.second()).Normalize();
-                            Base::Vector3d arcPoint = center + lineDir * pts.radius;
-                            writer.exportRadialDim(center, textLocn, arcPoint, dimText);
-                        } else if(dvd->Type.isValue("Diameter")){
-                            Base::Vector3d textLocn(dvd->X.getValue() + parentX, dvd->Y.getValue() + parentY, 0.0);
-                            arcPoints pts = dvd->getArcPoints();
-                            pointPair arrowPts = dvd->getArrowPositions();
-                            Base::Vector3d center = pts.center;
-                            center.y = -center.y;
-                            center = center + parentPos;
-                            Base::Vector3d lineDir = (arrowPts.first() - arrowPts.second()).Normalize();
-                            Base::Vector3d end1 = center + lineDir * pts.radius;
-                            Base::Vector3d end2 = center - lineDir * pts.radius;
-                            writer.exportDiametricDim(textLocn, end1, end2, dimText);
-                        }
-                   }
+                for (auto& op : collectDXFPage(dPage)) {
+                    op(writer);
                 }
             }
             writer.endRun();
@@ -802,6 +690,92 @@ private:
         return Py::None();
     }
 
+    Py::Object writeDXFPages(const Py::Tuple& args)
+    {
+        PyObject *pagesObj(nullptr);
+        char* name(nullptr);
+        if (!PyArg_ParseTuple(args.ptr(), "Oet", &pagesObj, "utf-8", &name)) {
+            throw Py::TypeError("expected (document or [pages], directory");
+        }
+
+        std::string dirPath = std::string(name);
+        PyMem_Free(name);
+
+        std::vector<TechDraw::DrawPage*> pages;
+        if (PyObject_TypeCheck(pagesObj, &(App::DocumentPy::Type))) {
+            App::Document* doc = static_cast<App::DocumentPy*>(pagesObj)->getDocumentPtr();
+            for (auto& obj : doc->getObjectsOfType(TechDraw::DrawPage::getClassTypeId())) {
+                pages.push_back(static_cast<TechDraw::DrawPage*>(obj));
+            }
+        }
+        else if (PySequence_Check(pagesObj)) {
+            Py::Sequence list(pagesObj);
+            for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                if (!PyObject_TypeCheck((*it).ptr(), &(TechDraw::DrawPagePy::Type))) {
+                    throw Py::TypeError("expected a sequence of DrawPages");
+                }
+                App::DocumentObject* obj = static_cast<App::DocumentObjectPy*>((*it).ptr())->getDocumentObjectPtr();
+                pages.push_back(static_cast<TechDraw::DrawPage*>(obj));
+            }
+        }
+        else {
+            throw Py::TypeError("expected (document or [pages], directory");
+        }
+
+        struct PageJob
+        {
+            std::string filePath;
+            std::vector<DxfWriteOp> ops;
+        };
+        std::vector<PageJob> jobs;
+        Py::List fileList;
+        try {
+            //the document is only read here and by the edge exports of the views, the
+            //files are written in parallel
+            for (auto& page : pages) {
+                std::string filePath = dirPath + "/" + page->getNameInDocument() + ".dxf";
+                jobs.push_back({filePath, collectDXFPage(page)});
+                fileList.append(Py::String(filePath));
+            }
+
+            std::mutex setupMutex;
+            std::mutex errorMutex;
+            std::exception_ptr error;
+            QtConcurrent::blockingMap(jobs, [&](const PageJob& job) {
+                try {
+                    std::unique_ptr<ImpExpDxfWrite> writer;
+                    {
+                        //the writer reads the preferences and the program version as it starts
+                        std::lock_guard<std::mutex> lock(setupMutex);
+                        writer = std::make_unique<ImpExpDxfWrite>(job.filePath);
+                        writer->init();
+                    }
+                    for (auto& op : job.ops) {
+                        op(*writer);
+                    }
+                    writer->endRun();
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            });
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+        catch (const Standard_Failure& e) {
+            throw Py::RuntimeError(e.GetMessageString());
+        }
+
+        return fileList;
+    }
+
     Py::Object findCentroid(const Py::Tuple& args)
     {
         PyObject *pcObjShape(nullptr);
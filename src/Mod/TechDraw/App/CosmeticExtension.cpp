@@ -93,6 +93,7 @@ void CosmeticExtension::addCosmeticVertexesToGeom()
         int iGV = getOwner()->getGeometryObject()->addCosmeticVertex(cvPosition, cv->getTagAsString());
         cv->linkGeom = iGV;
     }
+    getOwner()->newGeometryRevision();
 }
 
 /// add a single cosmetic vertex in the property list to the view's vertex geometry list
@@ -109,6 +110,7 @@ int CosmeticExtension::add1CVToGV(const std::string& tag)
     Base::Vector3d cvPosition = cv->rotatedAndScaled(scale, rotDegrees);
     int iGV = getOwner()->getGeometryObject()->addCosmeticVertex(cvPosition, cv->getTagAsString());
     cv->linkGeom = iGV;
+    getOwner()->newGeometryRevision();
     return iGV;
 }
 
@@ -269,6 +271,7 @@ void CosmeticExtension::addCosmeticEdgesToGeom()
         //        int iGE =
         getOwner()->getGeometryObject()->addCosmeticEdge(scaledGeom, ce->getTagAsString());
     }
+    getOwner()->newGeometryRevision();
 }
 
 /// add a single cosmetic edge to the geometry edge list
@@ -284,6 +287,7 @@ int CosmeticExtension::add1CEToGE(const std::string& tag)
     double rotDegrees = getOwner()->Rotation.getValue();
     TechDraw::BaseGeomPtr scaledGeom = ce->scaledAndRotatedGeometry(scale, rotDegrees);
     int iGE = getOwner()->getGeometryObject()->addCosmeticEdge(scaledGeom, tag);
+    getOwner()->newGeometryRevision();
 
     return iGE;
 }
@@ -422,6 +426,7 @@ int CosmeticExtension::add1CLToGE(const std::string& tag)
     TechDraw::BaseGeomPtr scaledGeom = cl->scaledAndRotatedGeometry(getOwner());
 //    TechDraw::BaseGeomPtr scaledGeom = cl->scaledGeometry(getOwner());
     int iGE = getOwner()->getGeometryObject()->addCenterLine(scaledGeom, tag);
+    getOwner()->newGeometryRevision();
 
     return iGE;
 }
@@ -456,6 +461,7 @@ void CosmeticExtension::addCenterLinesToGeom()
         //        int idx =
         getOwner()->getGeometryObject()->addCenterLine(scaledGeom, cl->getTagAsString());
     }
+    getOwner()->newGeometryRevision();
 }
 
 //returns unique CL id
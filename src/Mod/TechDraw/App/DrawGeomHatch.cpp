@@ -127,6 +127,8 @@ App::DocumentObjectExecReturn *DrawGeomHatch::execute()
     //does execute even need to exist? Its all about the property value changes
     DrawViewPart* parent = getSourceView();
     if (parent) {
+        //the view may have skipped face finding before it had a hatch
+        parent->requestFaces();
         parent->requestPaint();
     }
     return App::DocumentObject::StdReturn;
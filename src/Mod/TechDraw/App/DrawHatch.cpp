@@ -75,6 +75,8 @@ App::DocumentObjectExecReturn *DrawHatch::execute(void)
 {
     DrawViewPart* parent = getSourceView();
     if (parent) {
+        //the view may have skipped face finding before it had a hatch
+        parent->requestFaces();
         parent->requestPaint();
     }
     return App::DocumentObject::StdReturn;
@@ -43,6 +43,8 @@
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #endif
 
 #include <Base/Console.h>
@@ -57,6 +59,93 @@
 
 using namespace TechDraw;
 
+namespace {
+
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+using BoxPoint = bg::model::point<double, 3, bg::cs::cartesian>;
+using EdgeBox = bg::model::box<BoxPoint>;
+using EdgeBoxItem = std::pair<EdgeBox, std::size_t>;
+
+//! r-tree over the bounding boxes of a list of edges, so each box is computed
+//! once instead of once for every pair of edges it is compared with.  The final
+//! tests use the Bnd_Box itself, so the results match testing every pair.
+class EdgeBoxIndex
+{
+public:
+    explicit EdgeBoxIndex(bool optimal) : m_optimal(optimal) {}
+
+    void add(const TopoDS_Edge& edge)
+    {
+        Bnd_Box box;
+        if (m_optimal) {
+            BRepBndLib::AddOptimal(edge, box);
+        } else {
+            BRepBndLib::Add(edge, box);
+        }
+        box.SetGap(0.1);
+        if (!box.IsVoid()) {
+            double xMin, yMin, zMin, xMax, yMax, zMax;
+            box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+            m_tree.insert(EdgeBoxItem(EdgeBox(BoxPoint(xMin, yMin, zMin),
+                                              BoxPoint(xMax, yMax, zMax)),
+                                      m_boxes.size()));
+        }
+        m_boxes.push_back(box);
+    }
+
+    const Bnd_Box& box(std::size_t i) const
+    {
+        return m_boxes[i];
+    }
+
+    //! indices of the edges whose box contains point, ascending
+    std::vector<std::size_t> containing(const gp_Pnt& point) const
+    {
+        std::vector<std::size_t> result;
+        BoxPoint query(point.X(), point.Y(), point.Z());
+        for (auto it = m_tree.qbegin(bgi::intersects(query)); it != m_tree.qend(); ++it) {
+            if (!m_boxes[it->second].IsOut(point)) {
+                result.push_back(it->second);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    //! indices from first on of the edges whose box intersects the box of edge i, ascending
+    std::vector<std::size_t> intersecting(std::size_t i, std::size_t first) const
+    {
+        std::vector<std::size_t> result;
+        if (m_boxes[i].IsVoid()) {
+            return result;
+        }
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        m_boxes[i].Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        EdgeBox query(BoxPoint(xMin, yMin, zMin), BoxPoint(xMax, yMax, zMax));
+        for (auto it = m_tree.qbegin(bgi::intersects(query)); it != m_tree.qend(); ++it) {
+            if (it->second >= first && intersects(i, it->second)) {
+                result.push_back(it->second);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    bool intersects(std::size_t i, std::size_t j) const
+    {
+        return !m_boxes[i].IsOut(m_boxes[j]);
+    }
+
+private:
+    bool m_optimal;
+    std::vector<Bnd_Box> m_boxes;
+    bgi::rtree<EdgeBoxItem, bgi::quadratic<16>> m_tree;
+};
+
+}  // namespace
+
 //===========================================================================
 // DrawProjectSplit
 //===========================================================================
@@ -142,60 +231,7 @@ std::vector<TopoDS_Edge> DrawProjectSplit::getEdges(TechDraw::GeometryObject* ge
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = origEdges.begin();
-    int iOuter = 0;
-    for (; itOuter != origEdges.end(); ++itOuter, iOuter++) {
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;  //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = faceEdges.begin();
-        for (; itInner != faceEdges.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;  //skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {      //bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        } //inner loop
-    }   //outer loop
+    std::vector<splitPoint> splits = findSplits(origEdges);
 
     std::vector<splitPoint> sorted = sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(), DrawProjectSplit::splitEqual);  //duplicates to back
@@ -226,6 +262,15 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
         }
     }
 
+    return isOnEdgeCurve(e, v, param, allowEnds);
+}
+
+//isOnEdge without the bounding box test, for callers that have already made it
+//note param gets modified here
+bool DrawProjectSplit::isOnEdgeCurve(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds)
+{
+    param = -2;
+
     double dist = DrawUtil::simpleMinDist(v, e);
     if (dist < 0.0) {
         Base::Console().Error("DPS::isOnEdge - simpleMinDist failed: %.3f\n", dist);
@@ -252,6 +297,63 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
 }
 
 
+//! find the points where a vertex of one edge touches the inside of another edge.
+//! only the edges whose bounding boxes contain the vertex are checked.
+std::vector<splitPoint> DrawProjectSplit::findSplits(const std::vector<TopoDS_Edge>& edges)
+{
+    EdgeBoxIndex index(true);
+    std::vector<bool> usable;
+    for (auto& edge : edges) {
+        index.add(edge);
+        //skip zero length edges. shouldn't happen ;)
+        usable.push_back(!index.box(usable.size()).IsVoid() && !DrawUtil::isZeroEdge(edge));
+    }
+
+    std::vector<splitPoint> splits;
+    for (std::size_t iOuter = 0; iOuter < edges.size(); iOuter++) {
+        if (!usable[iOuter]) {
+            continue;
+        }
+        TopoDS_Vertex v1 = TopExp::FirstVertex(edges[iOuter]);
+        TopoDS_Vertex v2 = TopExp::LastVertex(edges[iOuter]);
+        gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
+        gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
+        std::vector<std::size_t> near1 = index.containing(pnt1);
+        std::vector<std::size_t> near2 = index.containing(pnt2);
+        std::vector<std::size_t> candidates;
+        std::set_union(near1.begin(), near1.end(), near2.begin(), near2.end(),
+                       std::back_inserter(candidates));
+
+        for (auto iInner : candidates) {
+            if (iInner == iOuter || !usable[iInner]) {
+                continue;
+            }
+            if (!index.intersects(iOuter, iInner)) {      //bboxes of edges don't intersect, don't bother
+                continue;
+            }
+
+            double param = -1;
+            if (std::binary_search(near1.begin(), near1.end(), iInner) &&
+                isOnEdgeCurve(edges[iInner], v1, param, false)) {
+                splitPoint s1;
+                s1.i = static_cast<int>(iInner);
+                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
+                s1.param = param;
+                splits.push_back(s1);
+            }
+            if (std::binary_search(near2.begin(), near2.end(), iInner) &&
+                isOnEdgeCurve(edges[iInner], v2, param, false)) {
+                splitPoint s2;
+                s2.i = static_cast<int>(iInner);
+                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
+                s2.param = param;
+                splits.push_back(s2);
+            }
+        }
+    }
+    return splits;
+}
+
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
     std::vector<TopoDS_Edge> result;
@@ -639,14 +741,18 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> outEdges;
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
+    EdgeBoxIndex index(false);
+    for (auto& edge : inEdges) {
+        index.add(edge);
+    }
     int edgeCount = inEdges.size();
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
         if (skipThisEdge.at(ie0)) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
+        //edges whose bboxes don't intersect can't overlap
+        for (int ie1 : index.intersecting(ie0, ie0 + 1)) {
             if (skipThisEdge.at(ie1)) {
                 continue;
             }
@@ -756,102 +862,111 @@ std::vector<TopoDS_Edge> DrawProjectSplit::splitIntersectingEdges(std::vector<To
 //    Base::Console().Message("DPS::splitIntersectingEdges() - edges in: %d\n", inEdges.size());
     std::vector<TopoDS_Edge> outEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
+    EdgeBoxIndex index(false);
+    for (auto& edge : inEdges) {
+        index.add(edge);
+    }
     int edgeCount = inEdges.size();
     int iEdge0 = 0;
     for (; iEdge0 < edgeCount; iEdge0++) {  //all but last one
         if (skipThisEdge.at(iEdge0)) {
             continue;
         }
-        int iEdge1 = iEdge0 + 1;
+        //only edges whose bboxes intersect can intersect.  pieces appended to
+        //inEdges below are checked against the outer edge too.
+        std::vector<std::size_t> candidates = index.intersecting(iEdge0, iEdge0 + 1);
+        auto appendEdge = [&](const TopoDS_Edge& edge) {
+            inEdges.push_back(edge);
+            skipThisEdge.push_back(false);
+            index.add(edge);
+            if (index.intersects(iEdge0, edgeCount)) {
+                candidates.push_back(edgeCount);
+            }
+            edgeCount++;
+        };
         bool outerEdgeSplit = false;
-        for (; iEdge1 < edgeCount; iEdge1++) {
+        for (std::size_t iCandidate = 0; iCandidate < candidates.size(); iCandidate++) {
+            int iEdge1 = candidates[iCandidate];
             if (skipThisEdge.at(iEdge1)) {
                 continue;
             }
 
-            if (boxesIntersect(inEdges.at(iEdge0), inEdges.at(iEdge1))) {
-                std::vector<TopoDS_Edge> intersectEdges = fuseEdges(inEdges.at(iEdge0), inEdges.at(iEdge1));
-                if (intersectEdges.empty()) {
-                    //don't think this can happen. fusion of disjoint edges is 2 edges.
-                    //maybe an error?
-                    continue;   //next inner edge
-                }
+            std::vector<TopoDS_Edge> intersectEdges = fuseEdges(inEdges.at(iEdge0), inEdges.at(iEdge1));
+            if (intersectEdges.empty()) {
+                //don't think this can happen. fusion of disjoint edges is 2 edges.
+                //maybe an error?
+                continue;   //next inner edge
+            }
 
-                if (intersectEdges.size() == 1) {
-                    //one edge is a subset of the other.
-                    if (sameEndPoints(inEdges.at(iEdge0), intersectEdges.front())) {
-                        //we got the outer edge back so mark the inner edge
-                        skipThisEdge.at(iEdge1) = true;
-                    } else if (sameEndPoints(inEdges.at(iEdge1), intersectEdges.front())) {
-                        //we got the inner edge back so mark the outer edge and go to the next outer edge
-                        skipThisEdge.at(iEdge0) = true;
-                        break;          //next outer edge
-                    } else {
-                        //not sure what this means?  bad geometry?
-                    }
+            if (intersectEdges.size() == 1) {
+                //one edge is a subset of the other.
+                if (sameEndPoints(inEdges.at(iEdge0), intersectEdges.front())) {
+                    //we got the outer edge back so mark the inner edge
+                    skipThisEdge.at(iEdge1) = true;
+                } else if (sameEndPoints(inEdges.at(iEdge1), intersectEdges.front())) {
+                    //we got the inner edge back so mark the outer edge and go to the next outer edge
+                    skipThisEdge.at(iEdge0) = true;
+                    break;          //next outer edge
+                } else {
+                    //not sure what this means?  bad geometry?
+                }
 
-                } else if (intersectEdges.size() == 2) {
-                    //got the input edges back, so no intersection. carry on with next inner edge
-                    continue;    //next inner edge
-
-                } else if (intersectEdges.size() == 3) {
-                    //we have split 1 edge at a vertex of the other edge
-                    //check if outer edge is the one split
-                    bool innerEdgeSplit = false;
-                    for (auto& interEdge : intersectEdges) {
-                        if (!sameEndPoints(inEdges.at(iEdge0), interEdge) &&
-                            !sameEndPoints(inEdges.at(iEdge1), interEdge)) {
-                            //interEdge does not match either outer or inner edge,
-                            //so this is a piece of the split edge and we need to add it
-                            //to end of list
-                            inEdges.push_back(interEdge);
-                            skipThisEdge.push_back(false);
-                            edgeCount++;
-                         }
-                        if (sameEndPoints(inEdges.at(iEdge0), interEdge)) {
-                            //outer edge is in output, so it was not split.
-                            //therefore the inner edge was split and we should skip it in the future
-                            //the two pieces of the split edge will have been added to edgesToKeep
-                            //in the previous if
-                            innerEdgeSplit = true;
-                            skipThisEdge.at(iEdge1) = true;
-                        } else if (sameEndPoints(inEdges.at(iEdge1), interEdge)) {
-                            //inner edge is in output, so it was not split.
-                            //therefore the outer edge was split and we should skip it in the future.
-                            outerEdgeSplit = true;
-                            skipThisEdge.at(iEdge0) = true;
-                        }
-                    }
-                    if (!innerEdgeSplit && !outerEdgeSplit) {
-                        //neither edge found in output, so this was a partial overlap, so
-                        //both edges are replaced by the 3 split pieces
-                        //Q: why does this happen if we have run pruneOverlaps before this???
-                        skipThisEdge.at(iEdge0) = true;
+            } else if (intersectEdges.size() == 2) {
+                //got the input edges back, so no intersection. carry on with next inner edge
+                continue;    //next inner edge
+
+            } else if (intersectEdges.size() == 3) {
+                //we have split 1 edge at a vertex of the other edge
+                //check if outer edge is the one split
+                bool innerEdgeSplit = false;
+                for (auto& interEdge : intersectEdges) {
+                    if (!sameEndPoints(inEdges.at(iEdge0), interEdge) &&
+                        !sameEndPoints(inEdges.at(iEdge1), interEdge)) {
+                        //interEdge does not match either outer or inner edge,
+                        //so this is a piece of the split edge and we need to add it
+                        //to end of list
+                        appendEdge(interEdge);
+                     }
+                    if (sameEndPoints(inEdges.at(iEdge0), interEdge)) {
+                        //outer edge is in output, so it was not split.
+                        //therefore the inner edge was split and we should skip it in the future
+                        //the two pieces of the split edge will have been added to edgesToKeep
+                        //in the previous if
+                        innerEdgeSplit = true;
                         skipThisEdge.at(iEdge1) = true;
+                    } else if (sameEndPoints(inEdges.at(iEdge1), interEdge)) {
+                        //inner edge is in output, so it was not split.
+                        //therefore the outer edge was split and we should skip it in the future.
                         outerEdgeSplit = true;
+                        skipThisEdge.at(iEdge0) = true;
                     }
-                    if (outerEdgeSplit) {
-                        //we can't use the outer edge any more, so we should exit the inner loop
-                        break;
-                    }
-
-                } else if (intersectEdges.size() == 4) {
-                    //we have split both edges at a single intersection
+                }
+                if (!innerEdgeSplit && !outerEdgeSplit) {
+                    //neither edge found in output, so this was a partial overlap, so
+                    //both edges are replaced by the 3 split pieces
+                    //Q: why does this happen if we have run pruneOverlaps before this???
                     skipThisEdge.at(iEdge0) = true;
                     skipThisEdge.at(iEdge1) = true;
-                    inEdges.insert(inEdges.end(), intersectEdges.begin(), intersectEdges.end());
-                    skipThisEdge.insert(skipThisEdge.end(), { false, false, false, false});
-                    edgeCount += 4;
                     outerEdgeSplit = true;
+                }
+                if (outerEdgeSplit) {
+                    //we can't use the outer edge any more, so we should exit the inner loop
                     break;
+                }
 
-                } else {
-                    //this means multiple intersections of the 2 edges. we don't handle that yet.
-                    continue;  //next inner edge?
+            } else if (intersectEdges.size() == 4) {
+                //we have split both edges at a single intersection
+                skipThisEdge.at(iEdge0) = true;
+                skipThisEdge.at(iEdge1) = true;
+                for (auto& interEdge : intersectEdges) {
+                    appendEdge(interEdge);
                 }
+                outerEdgeSplit = true;
+                break;
 
             } else {
-                //bboxes of edges do not intersect, so edges do not intersect
+                //this means multiple intersections of the 2 edges. we don't handle that yet.
+                continue;  //next inner edge?
             }
         }  //inner loop boundary
 
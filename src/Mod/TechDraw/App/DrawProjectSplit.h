@@ -102,6 +102,8 @@ public:
     static TechDraw::GeometryObjectPtr  buildGeometryObject(TopoDS_Shape shape, const gp_Ax2& viewAxis);
 
     static bool isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds = false);
+    static bool isOnEdgeCurve(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds = false);
+    static std::vector<splitPoint> findSplits(const std::vector<TopoDS_Edge>& edges);
     static std::vector<TopoDS_Edge> splitEdges(std::vector<TopoDS_Edge> orig, std::vector<splitPoint> splits);
     static std::vector<TopoDS_Edge> split1Edge(TopoDS_Edge e, std::vector<splitPoint> splitPoints);
 
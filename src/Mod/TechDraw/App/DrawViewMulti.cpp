@@ -121,6 +121,7 @@ App::DocumentObjectExecReturn *DrawViewMulti::execute()
                                                           Rotation.getValue());
         }
         geometryObject = buildGeometryObject(mirroredShape, viewAxis);
+        newGeometryRevision();
 
 #if MOD_TECHDRAW_HANDLE_FACES
         extractFaces();
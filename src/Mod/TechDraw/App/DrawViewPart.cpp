@@ -58,6 +58,7 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
+#include <atomic>
 #include <gp_Ax2.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
@@ -90,6 +91,7 @@
 #include "ShapeExtractor.h"
 #include "Preferences.h"
 #include "ShapeUtils.h"
+#include "TechDrawExport.h"
 
 using namespace TechDraw;
 using DU = DrawUtil;
@@ -98,7 +100,7 @@ PROPERTY_SOURCE_WITH_EXTENSIONS(TechDraw::DrawViewPart, TechDraw::DrawView)
 
 DrawViewPart::DrawViewPart(void)
     : geometryObject(nullptr), m_tempGeometryObject(nullptr), m_waitingForFaces(false),
-      m_waitingForHlr(false)
+      m_waitingForHlr(false), m_geometryRevision(0)
 {
     static const char* group = "Projection";
     static const char* sgroup = "HLR Parameters";
@@ -148,6 +150,7 @@ DrawViewPart::DrawViewPart(void)
 
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
+    newGeometryRevision();
 }
 
 DrawViewPart::~DrawViewPart()
@@ -162,6 +165,7 @@ DrawViewPart::~DrawViewPart()
         m_faceFuture.waitForFinished();
     }
     removeAllReferencesFromGeom();
+    ViewExportCache::remove(this);
 }
 
 //! returns a compound of all the shapes from the DocumentObjects in the Source &
@@ -296,6 +300,7 @@ void DrawViewPart::onChanged(const App::Property* prop)
         Direction.setValue(Base::Vector3d(0.0, -1.0, 0.0));
     }
 
+    newGeometryRevision();
     DrawView::onChanged(prop);
 }
 
@@ -402,6 +407,7 @@ void DrawViewPart::onHlrFinished(void)
     if (m_tempGeometryObject) {
         geometryObject = m_tempGeometryObject;//replace with new
         m_tempGeometryObject = nullptr;       //superfluous?
+        newGeometryRevision();
     }
     if (!geometryObject) {
         throw Base::RuntimeError("DrawViewPart has lost its geometry");
@@ -418,29 +424,56 @@ void DrawViewPart::onHlrFinished(void)
 
     //start face finding in a separate thread.  We don't find faces when using the polygon
     //HLR method.
-    if (handleFaces() && !CoarseView.getValue()) {
-        try {
-            //note that &m_faceWatcher in the third parameter is not strictly required, but using the
-            //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
-            //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
-            connectFaceWatcher =
-                QObject::connect(&m_faceWatcher, &QFutureWatcherBase::finished, &m_faceWatcher,
-                                 [this] { this->onFacesFinished(); });
-
-            auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
-            m_faceWatcher.setFuture(m_faceFuture);
-            waitingForFaces(true);
-        }
-        catch (Standard_Failure& e) {
-            waitingForFaces(false);
-            Base::Console().Error("DVP::partExec - %s - extractFaces failed - %s **\n",
-                                  getNameInDocument(), e.GetMessageString());
-            throw Base::RuntimeError("DVP::onHlrFinished - error extracting faces");
-        }
+    if (needsFaces()) {
+        startFaceFinding();
     }
 }
 
+//! give the view a revision that no view has had before, so exports cached for an old
+//! geometry are not reused
+void DrawViewPart::newGeometryRevision()
+{
+    static std::atomic<unsigned long> lastRevision(0);
+    m_geometryRevision = ++lastRevision;
+}
+
+//! extract the faces from the current geometry in a separate thread
+void DrawViewPart::startFaceFinding()
+{
+    try {
+        //note that &m_faceWatcher in the third parameter is not strictly required, but using the
+        //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
+        //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
+        connectFaceWatcher =
+            QObject::connect(&m_faceWatcher, &QFutureWatcherBase::finished, &m_faceWatcher,
+                             [this] { this->onFacesFinished(); });
+
+        auto lambda = [this]{this->extractFaces();};
+        m_faceFuture = QtConcurrent::run(std::move(lambda));
+        m_faceWatcher.setFuture(m_faceFuture);
+        waitingForFaces(true);
+    }
+    catch (Standard_Failure& e) {
+        waitingForFaces(false);
+        Base::Console().Error("DVP::partExec - %s - extractFaces failed - %s **\n",
+                              getNameInDocument(), e.GetMessageString());
+        throw Base::RuntimeError("DVP::onHlrFinished - error extracting faces");
+    }
+}
+
+//! find faces for a view that skipped face finding because nothing used its faces.
+//! called when something starts to use them (ex a new hatch).
+void DrawViewPart::requestFaces()
+{
+    if (!geometryObject || waitingForHlr() || waitingForFaces()) {
+        return;
+    }
+    if (!geometryObject->getFaceGeometry().empty() || !needsFaces()) {
+        return;
+    }
+    startFaceFinding();
+}
+
 //! run any tasks that need to been done after geometry is available
 void DrawViewPart::postHlrTasks(void)
 {
@@ -450,6 +483,11 @@ void DrawViewPart::postHlrTasks(void)
     addCosmeticEdgesToGeom();
     addReferencesToGeom();
     addShapes2d();
+    //centerlines are normally added after face finding, as some depend on faces.  If face
+    //finding is skipped because nothing uses the faces, no centerline depends on them.
+    if (handleFaces() && !CoarseView.getValue() && !needsFaces()) {
+        addCenterLinesToGeom();
+    }
 
     //balloons need to be recomputed here because their
     //references will be invalid until the geometry exists
@@ -458,7 +496,7 @@ void DrawViewPart::postHlrTasks(void)
         b->recomputeFeature();
     }
     // Dimensions need to be recomputed now if face finding is not going to take place.
-    if (!handleFaces() || CoarseView.getValue()) {
+    if (!needsFaces()) {
         std::vector<TechDraw::DrawViewDimension*> dims = getDimensions();
         for (auto& d : dims) {
             d->recomputeFeature();
@@ -481,8 +519,9 @@ void DrawViewPart::postHlrTasks(void)
 // Run any tasks that need to be done after faces are available
 void DrawViewPart::postFaceExtractionTasks(void)
 {
-    // Some centerlines depend on faces so we could not add CL geometry before now
-    addCenterLinesToGeom();
+    // Some centerlines depend on faces so we could not add CL geometry before now.  If face
+    // finding was requested later, the centerlines are already there and must be replaced.
+    refreshCLGeoms();
 
     // Dimensions need to be recomputed because their references will be invalid
     //  until all the geometry (including centerlines dependent on faces) exists.
@@ -538,7 +577,10 @@ void DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
     EdgeWalker eWalker;
     std::vector<TopoDS_Wire> sortedWires;
     try {
-        if (!cleanEdges.empty()) {
+        if (!cleanEdges.empty() && parallelFaceFinder()) {
+            sortedWires = EdgeWalker::executeComponents(cleanEdges);//include outer wires
+        }
+        else if (!cleanEdges.empty()) {
             sortedWires = eWalker.execute(cleanEdges, true);//include outer wire
         }
     }
@@ -609,60 +651,7 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplits(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
@@ -1200,6 +1189,47 @@ bool DrawViewPart::newFaceFinder(void)
     return Preferences::getPreferenceGroup("General")->GetBool("NewFaceFinder", false);
 }
 
+bool DrawViewPart::parallelFaceFinder()
+{
+    return Preferences::getPreferenceGroup("General")->GetBool("ParallelFaceFinder", false);
+}
+
+bool DrawViewPart::skipUnusedFaces()
+{
+    return Preferences::getPreferenceGroup("General")->GetBool("SkipUnusedFaces", false);
+}
+
+//! true if faces should be found for this view.  We don't find faces when using the
+//! polygon HLR method, and optionally not for views where nothing uses the faces.
+bool DrawViewPart::needsFaces()
+{
+    if (!handleFaces() || CoarseView.getValue()) {
+        return false;
+    }
+    return !skipUnusedFaces() || usesFaces();
+}
+
+//! true if hatches, dimensions or centerlines of this view refer to its faces
+bool DrawViewPart::usesFaces() const
+{
+    if (!getHatches().empty() || !getGeomHatches().empty()) {
+        return true;
+    }
+    for (auto& dim : getDimensions()) {
+        for (auto& sub : dim->References2D.getSubValues()) {
+            if (DrawUtil::getGeomTypeFromName(sub) == "Face") {
+                return true;
+            }
+        }
+    }
+    for (auto& cl : CenterLines.getValues()) {
+        if (cl->getType() == CenterLine::CLTYPE::FACE) {
+            return true;
+        }
+    }
+    return false;
+}
+
 //! remove features that are useless without this DVP
 //! hatches, geomhatches, dimensions, ...
 void DrawViewPart::unsetupObject()
@@ -133,6 +133,10 @@ public:
 
     bool hasGeometry() const;
     TechDraw::GeometryObjectPtr getGeometryObject() const { return geometryObject; }
+    //! changes whenever the geometry or a property of the view changes
+    unsigned long getGeometryRevision() const { return m_geometryRevision; }
+    //! call after replacing the geometry object or changing its edges or vertices
+    void newGeometryRevision();
 
     TechDraw::VertexPtr getVertex(std::string vertexName) const;
     TechDraw::BaseGeomPtr getEdge(std::string edgeName) const;
@@ -178,6 +182,10 @@ public:
     // switches
     bool handleFaces();
     bool newFaceFinder();
+    bool parallelFaceFinder();
+    bool skipUnusedFaces();
+    bool needsFaces();
+    bool usesFaces() const;
     bool isUnsetting() { return nowUnsetting; }
 
     virtual TopoDS_Shape getSourceShape(bool fuse = false) const;
@@ -205,6 +213,7 @@ public:
     bool waitingForHlr() const { return m_waitingForHlr; }
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
+    void requestFaces();
     void progressValueChanged(int v);
 
 public Q_SLOTS:
@@ -228,6 +237,7 @@ protected:
     virtual void addShapes2d(void);
 
     void extractFaces();
+    void startFaceFinding();
     void findFacesNew(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
     void findFacesOld(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
 
@@ -244,6 +254,7 @@ private:
     bool nowUnsetting;
     bool m_waitingForFaces;
     bool m_waitingForHlr;
+    unsigned long m_geometryRevision;
 
     QMetaObject::Connection connectHlrWatcher;
     QFutureWatcher<void> m_hlrWatcher;
@@ -28,8 +28,12 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <cmath>
+# include <exception>
+# include <mutex>
 # include <sstream>
+# include <QtConcurrentMap>
 # include <BRep_Tool.hxx>
 # include <BRepBuilderAPI_MakeWire.hxx>
 # include <ShapeAnalysis.hxx>
@@ -180,6 +184,48 @@ std::vector<TopoDS_Wire> EdgeWalker::execute(std::vector<TopoDS_Edge> edgeList,
     return std::vector<TopoDS_Wire>();
 }
 
+//! find the wires like execute(edgeList, true), but walk each connected group of
+//! edges on its own, in parallel.  Faces of equal size may come out in a
+//! different order than from execute.
+/*static*/ std::vector<TopoDS_Wire> EdgeWalker::executeComponents(const std::vector<TopoDS_Edge>& edgeList)
+{
+    EdgeWalker splitter;
+    std::vector<std::vector<TopoDS_Edge>> components = splitter.makeComponents(edgeList);
+    if (components.size() < 2) {
+        EdgeWalker walker;
+        return walker.execute(edgeList, true);
+    }
+
+    std::vector<std::vector<TopoDS_Wire>> results(components.size());
+    std::vector<std::size_t> indices(components.size());
+    for (std::size_t i = 0; i < indices.size(); i++) {
+        indices[i] = i;
+    }
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    QtConcurrent::blockingMap(indices, [&](const std::size_t& i) {
+        try {
+            EdgeWalker walker;
+            results[i] = walker.execute(components[i], true);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    std::vector<TopoDS_Wire> wires;
+    for (auto& result : results) {
+        wires.insert(wires.end(), result.begin(), result.end());
+    }
+    return splitter.sortWiresBySize(wires);
+}
+
 ewWireList EdgeWalker::getResult()
 {
     //Base::Console().Message("TRACE - EW::getResult()\n");
@@ -270,25 +316,30 @@ std::vector<TopoDS_Vertex> EdgeWalker:: makeUniqueVList(std::vector<TopoDS_Edge>
 {
 //    Base::Console().Message("TRACE - EW::makeUniqueVList() - edgesIn: %d\n", edges.size());
     std::vector<TopoDS_Vertex> uniqueVert;
+    std::vector<Base::Vector3d> uniquePoints;
+    VertexGrid grid(EWTOLERANCE);
+    auto isKnown = [&](const Base::Vector3d& point) {
+        for (auto i : grid.near(point)) {
+            if (uniquePoints[i].IsEqual(point, EWTOLERANCE)) {
+                return true;
+            }
+        }
+        return false;
+    };
     for(auto& e:edges) {
         Base::Vector3d v1 = DrawUtil::vertex2Vector(TopExp::FirstVertex(e));
         Base::Vector3d v2 = DrawUtil::vertex2Vector(TopExp::LastVertex(e));
-        bool addv1 = true;
-        bool addv2 = true;
         //check if we've already added this vertex
-        for (const auto& v: uniqueVert) {
-            Base::Vector3d v3d = DrawUtil::vertex2Vector(v);
-            if (v3d.IsEqual(v1, EWTOLERANCE)) {
-                addv1 = false;
-            }
-            if (v3d.IsEqual(v2, EWTOLERANCE)) {
-                addv2 = false;
-            }
-        }
+        bool addv1 = !isKnown(v1);
+        bool addv2 = !isKnown(v2);
         if (addv1) {
+            grid.add(v1, uniqueVert.size());
+            uniquePoints.push_back(v1);
             uniqueVert.push_back(TopExp::FirstVertex(e));
         }
         if (addv2) {
+            grid.add(v2, uniqueVert.size());
+            uniquePoints.push_back(v2);
             uniqueVert.push_back(TopExp::LastVertex(e));
         }
     }
@@ -302,15 +353,34 @@ std::vector<WalkerEdge> EdgeWalker::makeWalkerEdges(std::vector<TopoDS_Edge> edg
 {
 //    Base::Console().Message("TRACE - EW::makeWalkerEdges() - edges: %d  verts: %d\n", edges.size(), verts.size());
     m_saveInEdges = edges;
+
+    //same result as findUniqueVert, without scanning all the vertices for each edge
+    std::vector<Base::Vector3d> points;
+    points.reserve(verts.size());
+    VertexGrid grid(EWTOLERANCE);
+    for (auto& v : verts) {
+        grid.add(DrawUtil::vertex2Vector(v), points.size());
+        points.push_back(DrawUtil::vertex2Vector(v));
+    }
+    auto findVert = [&](const TopoDS_Vertex& vx) {
+        Base::Vector3d vx3d = DrawUtil::vertex2Vector(vx);
+        for (auto i : grid.near(vx3d)) {
+            if (vx3d.IsEqual(points[i], EWTOLERANCE)) {
+                return i;
+            }
+        }
+        return std::size_t(SIZE_MAX);
+    };
+
     std::vector<WalkerEdge> walkerEdges;
     for (const auto& e:edges) {
         TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
         TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-        std::size_t vertex1Index = findUniqueVert(edgeVertex1, verts);
+        std::size_t vertex1Index = findVert(edgeVertex1);
         if (vertex1Index == SIZE_MAX) {
             continue;
         }
-        std::size_t vertex2Index = findUniqueVert(edgeVertex2, verts);
+        std::size_t vertex2Index = findVert(edgeVertex2);
         if (vertex2Index == SIZE_MAX) {
             continue;
         }
@@ -341,6 +411,45 @@ size_t EdgeWalker::findUniqueVert(TopoDS_Vertex vx, std::vector<TopoDS_Vertex> &
     return SIZE_MAX;
 }
 
+//! split edges into groups that are connected through their (unique) vertices.
+//! the groups are in the order of their first edge.
+std::vector<std::vector<TopoDS_Edge>> EdgeWalker::makeComponents(std::vector<TopoDS_Edge> edges)
+{
+    std::vector<TopoDS_Vertex> verts = makeUniqueVList(edges);
+    std::vector<WalkerEdge> walkerEdges = makeWalkerEdges(edges, verts);
+    if (walkerEdges.size() != edges.size()) {
+        //some edge has lost its vertices, keep everything together
+        return {edges};
+    }
+
+    std::vector<std::size_t> parent(verts.size());
+    for (std::size_t i = 0; i < parent.size(); i++) {
+        parent[i] = i;
+    }
+    auto findRoot = [&parent](std::size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (auto& we : walkerEdges) {
+        parent[findRoot(we.v1)] = findRoot(we.v2);
+    }
+
+    std::vector<std::vector<TopoDS_Edge>> components;
+    std::vector<std::size_t> componentOfRoot(verts.size(), SIZE_MAX);
+    for (std::size_t iEdge = 0; iEdge < edges.size(); iEdge++) {
+        std::size_t root = findRoot(walkerEdges[iEdge].v1);
+        if (componentOfRoot[root] == SIZE_MAX) {
+            componentOfRoot[root] = components.size();
+            components.emplace_back();
+        }
+        components[componentOfRoot[root]].push_back(edges[iEdge]);
+    }
+    return components;
+}
+
 std::vector<TopoDS_Wire> EdgeWalker::sortStrip(std::vector<TopoDS_Wire> fw, bool includeBiggest)
 {
     std::vector<TopoDS_Wire> closedWires;                  //all the wires should be closed, but anomalies happen
@@ -366,8 +475,21 @@ std::vector<TopoDS_Wire> EdgeWalker::sortStrip(std::vector<TopoDS_Wire> fw, bool
 std::vector<TopoDS_Wire> EdgeWalker::sortWiresBySize(std::vector<TopoDS_Wire>& w, bool ascend)
 {
     //Base::Console().Message("TRACE - EW::sortWiresBySize()\n");
-    std::vector<TopoDS_Wire> wires = w;
-    std::sort(wires.begin(), wires.end(), EdgeWalker::wireCompare);
+    //the area is computed once per wire, not once per comparison
+    std::vector<std::pair<double, std::size_t>> areas;
+    areas.reserve(w.size());
+    for (auto& wire : w) {
+        areas.emplace_back(ShapeAnalysis::ContourArea(wire), areas.size());
+    }
+    std::sort(areas.begin(), areas.end(),
+              [](const std::pair<double, std::size_t>& a1, const std::pair<double, std::size_t>& a2) {
+                  return a1.first > a2.first;
+              });
+    std::vector<TopoDS_Wire> wires;
+    wires.reserve(w.size());
+    for (auto& area : areas) {
+        wires.push_back(w[area.second]);
+    }
     if (ascend) {
         std::reverse(wires.begin(), wires.end());
     }
@@ -389,15 +511,25 @@ std::vector<embedItem> EdgeWalker::makeEmbedding(const std::vector<TopoDS_Edge>
 //                            edges.size(), uniqueVList.size());
     std::vector<embedItem> result;
 
+    //vertexEqual accepts points up to 2 * EWTOLERANCE apart in x and y, so
+    //a grid of that size finds all the edge ends a vertex can match
+    VertexGrid grid(2.0 * EWTOLERANCE);
+    std::size_t iEdge = 0;
+    for (auto& e: edges) {
+        grid.add(DrawUtil::vertex2Vector(TopExp::FirstVertex(e)), iEdge);
+        grid.add(DrawUtil::vertex2Vector(TopExp::LastVertex(e)), iEdge);
+        iEdge++;
+    }
+
     std::size_t iVert = 0;
     //make an embedItem for each vertex in uniqueVList
     //for each vertex v
     //  find all the edges that have v as first or last vertex
     for (auto& v: uniqueVList) {
         TopoDS_Vertex cv = v;               //v is const but we need non-const for vertexEqual
-        std::size_t iEdge = 0;
         std::vector<incidenceItem> iiList;
-        for (auto& e: edges) {
+        for (auto iEdge: grid.near(DrawUtil::vertex2Vector(v))) {
+            const TopoDS_Edge& e = edges[iEdge];
             double angle = 0;
             TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
             TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
@@ -410,7 +542,6 @@ std::vector<embedItem> EdgeWalker::makeEmbedding(const std::vector<TopoDS_Edge>
                 incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
                 iiList.push_back(ii);
             }
-            iEdge++;
        }
        //sort incidenceList by angle
        iiList = embedItem::sortIncidenceList(iiList,  false);
@@ -447,6 +578,54 @@ std::vector<edge_t> EdgeWalker::getEmbeddingRow(int v)
 
 
 
+//*******************************************
+// VertexGrid Methods
+//*******************************************
+VertexGrid::VertexGrid(double cellSize) :
+    m_cellSize(cellSize)
+{
+}
+
+void VertexGrid::add(const Base::Vector3d& point, std::size_t index)
+{
+    m_cells[cellOf(point)].push_back(index);
+}
+
+std::vector<std::size_t> VertexGrid::near(const Base::Vector3d& point) const
+{
+    std::vector<std::size_t> result;
+    Cell center = cellOf(point);
+    for (long long dx = -1; dx <= 1; dx++) {
+        for (long long dy = -1; dy <= 1; dy++) {
+            for (long long dz = -1; dz <= 1; dz++) {
+                auto it = m_cells.find({center[0] + dx, center[1] + dy, center[2] + dz});
+                if (it != m_cells.end()) {
+                    result.insert(result.end(), it->second.begin(), it->second.end());
+                }
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+VertexGrid::Cell VertexGrid::cellOf(const Base::Vector3d& point) const
+{
+    return {static_cast<long long>(std::floor(point.x / m_cellSize)),
+            static_cast<long long>(std::floor(point.y / m_cellSize)),
+            static_cast<long long>(std::floor(point.z / m_cellSize))};
+}
+
+std::size_t VertexGrid::CellHash::operator()(const Cell& cell) const
+{
+    std::size_t seed = 0;
+    for (auto value : cell) {
+        seed ^= std::hash<long long>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
 //*******************************************
 // WalkerEdge Methods
 //*******************************************
@@ -28,6 +28,8 @@
 #ifndef TECHDRAW_EDGEWALKER_H
 #define TECHDRAW_EDGEWALKER_H
 
+#include <array>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/graph/adjacency_list.hpp>
@@ -39,6 +41,7 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 
+#include <Base/Vector3D.h>
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 
@@ -148,6 +151,29 @@ public:
 };
 
 
+//! hashed grid of points for finding the points near a given position
+//! without scanning them all.  Every point closer than cellSize to the
+//! position in each direction is in one of the 27 cells around it.
+class TechDrawExport VertexGrid
+{
+public:
+    explicit VertexGrid(double cellSize);
+
+    void add(const Base::Vector3d& point, std::size_t index);
+    //! indices of the points that may be within cellSize of point, ascending
+    std::vector<std::size_t> near(const Base::Vector3d& point) const;
+
+private:
+    using Cell = std::array<long long, 3>;
+    struct CellHash {
+        std::size_t operator()(const Cell& cell) const;
+    };
+    Cell cellOf(const Base::Vector3d& point) const;
+
+    double m_cellSize;
+    std::unordered_map<Cell, std::vector<std::size_t>, CellHash> m_cells;
+};
+
 class TechDrawExport EdgeWalker
 {
 public:
@@ -158,6 +184,7 @@ public:
     bool loadEdges(std::vector<TopoDS_Edge> edges);
     bool setSize(std::size_t size);
     std::vector<TopoDS_Wire> execute(std::vector<TopoDS_Edge> edgeList, bool biggie = true);
+    static std::vector<TopoDS_Wire> executeComponents(const std::vector<TopoDS_Edge>& edgeList);
 
     ewWireList getResult();
     std::vector<TopoDS_Wire> getResultWires();
@@ -168,6 +195,7 @@ public:
                                                std::vector<TopoDS_Vertex> verts);
 
     size_t findUniqueVert(TopoDS_Vertex vx, std::vector<TopoDS_Vertex> &uniqueVert);
+    std::vector<std::vector<TopoDS_Edge>> makeComponents(std::vector<TopoDS_Edge> edges);
     std::vector<TopoDS_Wire> sortStrip(std::vector<TopoDS_Wire> fw, bool includeBiggest);
     std::vector<TopoDS_Wire> sortWiresBySize(std::vector<TopoDS_Wire>& w, bool reverse = false);
     static TopoDS_Wire makeCleanWire(std::vector<TopoDS_Edge> edges, double tol = 0.10);
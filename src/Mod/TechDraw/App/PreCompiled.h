@@ -33,18 +33,25 @@
 
 // standard
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <chrono>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
 
 // boost
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/graph/boyer_myrvold_planar_test.hpp>
 #include <boost/graph/is_kuratowski_subgraph.hpp>
 #include <boost_regex.hpp>
@@ -59,6 +66,7 @@
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QtConcurrentMap>
 #include <QtConcurrentRun>
 #include <QXmlQuery>
 #include <QXmlResultItems>
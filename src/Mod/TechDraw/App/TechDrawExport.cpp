@@ -26,11 +26,15 @@
 
 #ifndef _PreComp_
 # include <cmath>
+# include <iomanip>
+# include <map>
+# include <mutex>
 # include <sstream>
 # include <Approx_Curve3d.hxx>
 # include <BRep_Tool.hxx>
 # include <BRepAdaptor_Curve.hxx>
 # include <BRepBuilderAPI_MakeEdge.hxx>
+# include <BRepBuilderAPI_Transform.hxx>
 # include <BRepLProp_CLProps.hxx>
 # include <Geom_BezierCurve.hxx>
 # include <Geom_BSplineCurve.hxx>
@@ -41,6 +45,7 @@
 # include <gp_Circ.hxx>
 # include <gp_Elips.hxx>
 # include <gp_Pnt.hxx>
+# include <gp_Trsf.hxx>
 # include <gp_Vec.hxx>
 # include <Poly_Polygon3D.hxx>
 # include <Standard_Failure.hxx>
@@ -57,6 +62,13 @@
 
 #include <Base/Tools.h>
 
+#include "DrawProjGroup.h"
+#include "DrawProjGroupItem.h"
+#include "DrawUtil.h"
+#include "DrawViewPart.h"
+#include "Geometry.h"
+#include "GeometryObject.h"
+#include "ShapeUtils.h"
 #include "TechDrawExport.h"
 
 
@@ -742,3 +754,193 @@ void DXFOutput::printGeneric(const BRepAdaptor_Curve& c, int /*id*/, std::ostrea
     out << "31"			<< endl;
     out << "0"		<< endl;	// Z in WCS coordinates
 }
+
+/* cached view exports */
+namespace {
+
+//! an export and what it was made from
+template<typename T>
+struct ExportEntry
+{
+    unsigned long revision;
+    std::string options;
+    T value;
+};
+
+std::mutex exportCacheMutex;
+std::map<const DrawViewPart*, ExportEntry<std::string>> svgCache;
+std::map<const DrawViewPart*, ExportEntry<std::string>> dxfCache;
+std::map<const DrawViewPart*, ExportEntry<std::vector<TopoDS_Shape>>> dxfShapeCache;
+
+//! return the cached export of the view or make a new one.  the export is made outside of the
+//! lock, so different views can be exported at the same time.
+template<typename T, typename Make>
+T cachedExport(std::map<const DrawViewPart*, ExportEntry<T>>& cache, const DrawViewPart* dvp,
+               const std::string& options, Make make)
+{
+    unsigned long revision = dvp->getGeometryRevision();
+    {
+        std::lock_guard<std::mutex> lock(exportCacheMutex);
+        auto it = cache.find(dvp);
+        if (it != cache.end() && it->second.revision == revision
+            && it->second.options == options) {
+            return it->second.value;
+        }
+    }
+    T value = make();
+    std::lock_guard<std::mutex> lock(exportCacheMutex);
+    cache[dvp] = ExportEntry<T>{revision, options, value};
+    return value;
+}
+
+std::vector<TopoDS_Shape> visibleEdges(const DrawViewPart* dvp)
+{
+    GeometryObjectPtr gObj = dvp->getGeometryObject();
+    std::vector<TopoDS_Shape> edges{gObj->getVisHard(), gObj->getVisOutline()};
+    if (dvp->SmoothVisible.getValue()) {
+        edges.push_back(gObj->getVisSmooth());
+    }
+    if (dvp->SeamVisible.getValue()) {
+        edges.push_back(gObj->getVisSeam());
+    }
+    return edges;
+}
+
+std::vector<TopoDS_Shape> hiddenEdges(const DrawViewPart* dvp)
+{
+    GeometryObjectPtr gObj = dvp->getGeometryObject();
+    std::vector<TopoDS_Shape> edges;
+    if (dvp->HardHidden.getValue()) {
+        edges.push_back(gObj->getHidHard());
+        edges.push_back(gObj->getHidOutline());
+    }
+    if (dvp->SmoothHidden.getValue()) {
+        edges.push_back(gObj->getHidSmooth());
+    }
+    if (dvp->SeamHidden.getValue()) {
+        edges.push_back(gObj->getHidSeam());
+    }
+    return edges;
+}
+
+}  // namespace
+
+std::string ViewExportCache::viewPartAsSvg(const DrawViewPart* dvp)
+{
+    if (!dvp->hasGeometry()) {
+        return std::string();
+    }
+    double thick = DrawUtil::getDefaultLineWeight("Thick");
+    double thin = DrawUtil::getDefaultLineWeight("Thin");
+    std::stringstream options;
+    options << std::setprecision(17) << thick << " " << thin;
+
+    return cachedExport(svgCache, dvp, options.str(), [dvp, thick, thin] {
+        const char* grpHead1 = "<g fill=\"none\" stroke=\"#000000\" stroke-opacity=\"1\" stroke-width=\"";
+        const char* grpHead2 = "\" stroke-linecap=\"butt\" stroke-linejoin=\"miter\" stroke-miterlimit=\"4\">\n";
+        const char* grpTail  = "</g>\n";
+        SVGOutput svgOut;
+        std::stringstream ss;
+        ss << grpHead1 << thick << grpHead2;
+        for (auto& edges : visibleEdges(dvp)) {
+            ss << svgOut.exportEdges(edges);
+        }
+        ss << grpTail;
+
+        std::vector<TopoDS_Shape> hidden = hiddenEdges(dvp);
+        if (!hidden.empty()) {
+            ss << grpHead1 << thin << grpHead2;
+            for (auto& edges : hidden) {
+                ss << svgOut.exportEdges(edges);
+            }
+            ss << grpTail;
+        }
+        return ss.str();
+    });
+}
+
+std::string ViewExportCache::viewPartAsDxf(const DrawViewPart* dvp)
+{
+    if (!dvp->hasGeometry()) {
+        return std::string();
+    }
+
+    return cachedExport(dxfCache, dvp, std::string(), [dvp] {
+        std::vector<TopoDS_Shape> edges = visibleEdges(dvp);
+        std::vector<TopoDS_Shape> hidden = hiddenEdges(dvp);
+        edges.insert(edges.end(), hidden.begin(), hidden.end());
+        DXFOutput dxfOut;
+        std::stringstream ss;
+        for (auto& shape : edges) {
+            ss << dxfOut.exportEdges(ShapeUtils::mirrorShape(shape));
+        }
+        return ss.str();
+    });
+}
+
+std::vector<TopoDS_Shape> ViewExportCache::viewPartDxfShapes(const DrawViewPart* dvp, bool alignPage)
+{
+    if (!dvp->hasGeometry()) {
+        return std::vector<TopoDS_Shape>();
+    }
+    double dvpX(0.0);
+    double dvpY(0.0);
+    if (alignPage) {
+        dvpX = dvp->X.getValue();
+        dvpY = dvp->Y.getValue();
+        //the position of a projection group item is relative to its group
+        if (dvp->isDerivedFrom(DrawProjGroupItem::getClassTypeId())) {
+            DrawProjGroup* dpg = static_cast<const DrawProjGroupItem*>(dvp)->getPGroup();
+            if (dpg) {
+                dvpX += dpg->X.getValue();
+                dvpY += dpg->Y.getValue();
+            }
+        }
+    }
+    std::stringstream options;
+    options << std::setprecision(17) << dvpX << " " << dvpY;
+
+    return cachedExport(dxfShapeCache, dvp, options.str(), [dvp, dvpX, dvpY] {
+        std::vector<TopoDS_Shape> edges = visibleEdges(dvp);
+        std::vector<TopoDS_Shape> hidden = hiddenEdges(dvp);
+        edges.insert(edges.end(), hidden.begin(), hidden.end());
+        //add the cosmetic edges also
+        std::vector<TopoDS_Edge> cosmeticEdges;
+        for (auto& g : dvp->getEdgeGeometry()) {
+            if (g->getHlrVisible() && g->getCosmetic()) {
+                cosmeticEdges.push_back(g->getOCCEdge());
+            }
+        }
+        if (!cosmeticEdges.empty()) {
+            edges.push_back(DrawUtil::vectorToCompound(cosmeticEdges));
+        }
+
+        gp_Trsf xLate;
+        xLate.SetTranslation(gp_Vec(dvpX, dvpY, 0.0));
+        std::vector<TopoDS_Shape> shapes;
+        for (auto& shape : edges) {
+            if (shape.IsNull()) {
+                continue;
+            }
+            BRepBuilderAPI_Transform mkTrf(ShapeUtils::mirrorShape(shape), xLate);
+            shapes.push_back(mkTrf.Shape());
+        }
+        return shapes;
+    });
+}
+
+void ViewExportCache::remove(const DrawViewPart* dvp)
+{
+    std::lock_guard<std::mutex> lock(exportCacheMutex);
+    svgCache.erase(dvp);
+    dxfCache.erase(dvp);
+    dxfShapeCache.erase(dvp);
+}
+
+void ViewExportCache::clear()
+{
+    std::lock_guard<std::mutex> lock(exportCacheMutex);
+    svgCache.clear();
+    dxfCache.clear();
+    dxfShapeCache.clear();
+}
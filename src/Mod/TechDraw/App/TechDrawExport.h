@@ -26,16 +26,18 @@
 #define TECHDRAW_EXPORT_H
 
 #include <string>
+#include <vector>
 #include <TopoDS_Edge.hxx>
+#include <TopoDS_Shape.hxx>
 
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 
-class TopoDS_Shape;
 class BRepAdaptor_Curve;
 
 namespace TechDraw
 {
+class DrawViewPart;
 
 class TechDrawExport TechDrawOutput
 {
@@ -75,6 +77,21 @@ private:
     void printGeneric(const BRepAdaptor_Curve&, int id, std::ostream&);
 };
 
+//! the exports of a view's edges, reused until the view's geometry revision or the export
+//! options change.  views may be exported from several threads at once.
+class TechDrawExport ViewExportCache
+{
+public:
+    static std::string viewPartAsSvg(const DrawViewPart* dvp);
+    static std::string viewPartAsDxf(const DrawViewPart* dvp);
+    //! the mirrored edges of the view as written to a dxf file, placed where the view is on
+    //! the page if alignPage is true
+    static std::vector<TopoDS_Shape> viewPartDxfShapes(const DrawViewPart* dvp, bool alignPage);
+
+    static void remove(const DrawViewPart* dvp);
+    static void clear();
+};
+
 } //namespace TechDraw
 
 #endif // TECHDRAW_EXPORT_H
@@ -59,6 +59,8 @@ void DlgPrefsTechDrawAdvancedImp::saveSettings()
     ui->cbReportProgress->onSave();
     ui->cbAutoCorrectRefs->onSave();
     ui->cbNewFaceFinder->onSave();
+    ui->cbParallelFaceFinder->onSave();
+    ui->cbSkipUnusedFaces->onSave();
     ui->sbScrubCount->onSave();
 }
 
@@ -79,6 +81,8 @@ void DlgPrefsTechDrawAdvancedImp::loadSettings()
     ui->cbReportProgress->onRestore();
     ui->cbAutoCorrectRefs->onRestore();
     ui->cbNewFaceFinder->onRestore();
+    ui->cbParallelFaceFinder->onRestore();
+    ui->cbSkipUnusedFaces->onRestore();
     ui->sbScrubCount->onRestore();
 }
 
@@ -6,7 +6,10 @@
 
 
 import FreeCAD
+import os
+import tempfile
 import unittest
+import TechDraw
 from .TechDrawTestUtilities import createPageWithSVGTemplate
 from PySide import QtCore
 
@@ -50,5 +53,86 @@ class DrawViewPartTest(unittest.TestCase):
         self.assertEqual(len(edges), 4, "DrawViewPart has wrong number of edges")
         self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
 
+    def testExportDrawViewPart(self):
+        """Tests the cached view exports and the batch page export"""
+        print("testing DrawViewPart export")
+        view = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(view)
+        FreeCAD.ActiveDocument.View.Source = [FreeCAD.ActiveDocument.Box]
+        FreeCAD.ActiveDocument.recompute()
+
+        loop = QtCore.QEventLoop()
+        timer = QtCore.QTimer()
+        timer.setSingleShot(True)
+        timer.timeout.connect(loop.quit)
+        timer.start(2000)   #2 second delay
+        loop.exec_()
+
+        svg = TechDraw.viewPartAsSvg(view)
+        self.assertTrue("<g" in svg, "DrawViewPart svg has no edges")
+        self.assertEqual(TechDraw.viewPartAsSvg(view), svg, "cached svg differs")
+
+        with tempfile.TemporaryDirectory() as dirName:
+            files = TechDraw.writeDXFPages(FreeCAD.ActiveDocument, dirName)
+            self.assertEqual(len(files), 1, "wrong number of pages exported")
+            self.assertTrue(os.path.getsize(files[0]) > 0, "page dxf is empty")
+
+    def testExportFollowsViewChanges(self):
+        """Tests that cached view exports are replaced when the viewed shape changes"""
+        print("testing DrawViewPart export after a change")
+        view = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(view)
+        view.Source = [FreeCAD.ActiveDocument.Box]
+        multi = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewMulti", "Multi")
+        self.page.addView(multi)
+        multi.Sources = [FreeCAD.ActiveDocument.Box]
+        FreeCAD.ActiveDocument.recompute()
+        self.waitForThreads()
+        svgs = [TechDraw.viewPartAsSvg(v) for v in (view, multi)]
+
+        FreeCAD.ActiveDocument.Box.Length = 30.0
+        FreeCAD.ActiveDocument.recompute()
+        self.waitForThreads()
+
+        for v, svg in zip((view, multi), svgs):
+            self.assertNotEqual(TechDraw.viewPartAsSvg(v), svg,
+                                "{} svg did not change".format(v.Name))
+
+    def testHatchAfterSkippedFaces(self):
+        """Tests that finding the faces for a new hatch doesn't duplicate centerlines"""
+        print("testing DrawViewPart hatch after skipped face finding")
+        prefs = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/TechDraw/General")
+        skipUnusedFaces = prefs.GetBool("SkipUnusedFaces", False)
+        prefs.SetBool("SkipUnusedFaces", True)
+        try:
+            view = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View")
+            self.page.addView(view)
+            view.Source = [FreeCAD.ActiveDocument.Box]
+            FreeCAD.ActiveDocument.recompute()
+            self.waitForThreads()
+            view.makeCenterLine(["Vertex0", "Vertex1"], 0)
+            FreeCAD.ActiveDocument.recompute()
+            self.waitForThreads()
+            edgeCount = len(view.getVisibleEdges())
+            self.assertEqual(edgeCount, 5, "DrawViewPart has wrong number of edges")
+
+            hatch = FreeCAD.ActiveDocument.addObject("TechDraw::DrawHatch", "Hatch")
+            hatch.Source = (view, ["Face0"])
+            FreeCAD.ActiveDocument.recompute()
+            self.waitForThreads()
+
+            self.assertEqual(len(view.getVisibleEdges()), edgeCount,
+                             "centerline was added twice")
+        finally:
+            prefs.SetBool("SkipUnusedFaces", skipUnusedFaces)
+
+    def waitForThreads(self):
+        loop = QtCore.QEventLoop()
+        timer = QtCore.QTimer()
+        timer.setSingleShot(True)
+        timer.timeout.connect(loop.quit)
+        timer.start(2000)   #2 second delay
+        loop.exec_()
+
 if __name__ == "__main__":
     unittest.main()
@@ -934,6 +934,25 @@ class UndoRedoCases(unittest.TestCase):
         # switch on the Undo OFF
         self.Doc.UndoMode = 0
 
+    def testUndoMemSizes(self):
+        self.Doc.getObject("Base").String = "x" * 10000
+        # switch on the Undo
+        self.Doc.UndoMode = 1
+        self.assertEqual(self.Doc.UndoMemSizes, [])
+        self.assertEqual(self.Doc.RedoMemSizes, [])
+
+        self.Doc.openTransaction("Transaction1")
+        self.Doc.getObject("Base").String = "test"
+        self.Doc.commitTransaction()
+        self.assertEqual(len(self.Doc.UndoMemSizes), 1)
+        self.assertGreaterEqual(self.Doc.UndoMemSizes[0], 10000)
+        self.assertEqual(self.Doc.UndoRedoMemSize, sum(self.Doc.UndoMemSizes))
+
+        self.Doc.undo()
+        self.assertEqual(self.Doc.UndoMemSizes, [])
+        self.assertEqual(len(self.Doc.RedoMemSizes), 1)
+        self.assertEqual(self.Doc.UndoRedoMemSize, sum(self.Doc.RedoMemSizes))
+
     def testUndoClear(self):
         # switch on the Undo
         self.Doc.UndoMode = 1
@@ -57,6 +57,8 @@ def createDocument(filename, outpath):
 
 
 def getFilesList(filename):
+    if filename.endswith(".bxml"):
+        raise ValueError("Binary encoded document files are not supported: " + filename)
     dirname = os.path.dirname(filename)
     handler = DocumentHandler(dirname)
     parser = xml.sax.make_parser()
@@ -466,6 +466,23 @@ TEST_F(ComplexGeoDataTest, saveDocFileWithElementMap)
     EXPECT_TRUE(writer.getString().find("BeginElementMap v1") != std::string::npos);
 }
 
+TEST_F(ComplexGeoDataTest, saveDocFileWithBinaryElementMap)
+{
+    // Arrange
+    Base::StringWriter writer;
+    auto map = createMappedName("SomeElement");
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("BinaryElementMap", true);
+
+    // Act
+    cgd().SaveDocFile(writer);
+    hGrp->RemoveBool("BinaryElementMap");
+
+    // Assert -- must begin a v2 ElementMap
+    EXPECT_TRUE(writer.getString().find("BeginElementMap v2") != std::string::npos);
+}
+
 TEST_F(ComplexGeoDataTest, restoreStream)
 {}
 
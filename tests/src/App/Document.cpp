@@ -3,8 +3,11 @@
 #include "gtest/gtest.h"
 #include <gmock/gmock.h>
 
+#include <algorithm>
+
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObjectGroup.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +97,220 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, getInListRecursiveOfNestedGroups)
+{
+    // Arrange
+    auto outer = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Outer"));
+    auto middle = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Middle"));
+    auto inner = doc()->addObject("App::DocumentObjectGroup", "Inner");
+    outer->addObject(middle);
+    middle->addObject(inner);
+
+    // Act
+    auto inList = inner->getInListRecursive();
+
+    // Assert - the furthest linking object comes last
+    std::vector<App::DocumentObject*> expected {middle, outer};
+    EXPECT_EQ(inList, expected);
+    EXPECT_TRUE(inner->isInInListRecursive(outer));
+    EXPECT_FALSE(outer->isInInListRecursive(inner));
+    EXPECT_TRUE(outer->testIfLinkDAGCompatible(inner));
+    EXPECT_FALSE(inner->testIfLinkDAGCompatible(outer));
+}
+
+TEST_F(DocumentTest, getInListRecursiveAfterLinkChange)
+{
+    // Arrange
+    auto outer = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Outer"));
+    auto middle = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Middle"));
+    auto inner = doc()->addObject("App::DocumentObjectGroup", "Inner");
+    outer->addObject(middle);
+    middle->addObject(inner);
+    EXPECT_TRUE(inner->isInInListRecursive(outer));
+
+    // Act
+    outer->removeObject(middle);
+
+    // Assert
+    EXPECT_FALSE(inner->isInInListRecursive(outer));
+    EXPECT_EQ(inner->getInListEx(true), std::set<App::DocumentObject*> {middle});
+
+    // Act
+    doc()->removeObject(middle->getNameInDocument());
+
+    // Assert
+    EXPECT_TRUE(inner->getInListRecursive().empty());
+}
+
+TEST_F(DocumentTest, getInListRecursiveIsKeptPerDocument)
+{
+    // Arrange
+    auto otherName = App::GetApplication().getUniqueDocumentName("other");
+    auto other = App::GetApplication().newDocument(otherName.c_str(), "testUser");
+    auto outer = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Outer"));
+    auto inner = doc()->addObject("App::DocumentObjectGroup", "Inner");
+    outer->addObject(inner);
+    auto otherOuter = static_cast<App::DocumentObjectGroup*>(
+        other->addObject("App::DocumentObjectGroup", "Outer"));
+    auto otherInner = other->addObject("App::DocumentObjectGroup", "Inner");
+    otherOuter->addObject(otherInner);
+    EXPECT_TRUE(inner->isInInListRecursive(outer));
+    EXPECT_TRUE(otherInner->isInInListRecursive(otherOuter));
+
+    // Act
+    other->removeObject(otherOuter->getNameInDocument());
+
+    // Assert
+    EXPECT_TRUE(inner->isInInListRecursive(outer));
+    EXPECT_EQ(inner->getInListRecursive(), std::vector<App::DocumentObject*> {outer});
+    EXPECT_TRUE(otherInner->getInListRecursive().empty());
+    EXPECT_FALSE(inner->isInInListRecursive(otherInner));
+
+    App::GetApplication().closeDocument(otherName.c_str());
+}
+
+TEST_F(DocumentTest, getDependencyListSortedAfterLinkChanges)
+{
+    // Arrange - the objects are created in the reverse order of their dependencies
+    auto outer = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Outer"));
+    auto middle = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Middle"));
+    auto inner = doc()->addObject("App::DocumentObjectGroup", "Inner");
+    auto other = doc()->addObject("App::DocumentObjectGroup", "Other");
+    middle->addObject(inner);
+    outer->addObject(middle);
+    outer->addObject(other);
+
+    // Act
+    auto all = App::Document::getDependencyList({outer}, App::Document::DepSort);
+    auto partial = App::Document::getDependencyList({middle}, App::Document::DepSort);
+
+    // Assert
+    auto position = [&all](App::DocumentObject* obj) {
+        return std::find(all.begin(), all.end(), obj) - all.begin();
+    };
+    ASSERT_EQ(all.size(), 4U);
+    EXPECT_LT(position(inner), position(middle));
+    EXPECT_LT(position(middle), position(outer));
+    EXPECT_LT(position(other), position(outer));
+    std::vector<App::DocumentObject*> expected {inner, middle};
+    EXPECT_EQ(partial, expected);
+}
+
+TEST_F(DocumentTest, getDependencyListSortedAfterReversedLink)
+{
+    // Arrange
+    auto first = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "First"));
+    auto second = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Second"));
+    first->addObject(second);
+    App::Document::getDependencyList({first}, App::Document::DepSort);
+
+    // Act
+    first->removeObject(second);
+    second->addObject(first);
+    auto sorted = App::Document::getDependencyList({second}, App::Document::DepSort);
+
+    // Assert
+    std::vector<App::DocumentObject*> expected {first, second};
+    EXPECT_EQ(sorted, expected);
+}
+
+TEST_F(DocumentTest, recomputeSkipsUnchangedInputs)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("SkipUnchangedRecompute", true);
+    auto outer = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Outer"));
+    auto inner = doc()->addObject("App::DocumentObjectGroup", "Inner");
+    outer->addObject(inner);
+    doc()->recompute();
+    unsigned long skipped = doc()->getSkippedRecomputeCount();
+
+    // Act
+    inner->touch();
+    doc()->recompute();
+    unsigned long unchanged = doc()->getSkippedRecomputeCount() - skipped;
+    inner->Label.setValue("Changed");
+    inner->touch();
+    doc()->recompute();
+    unsigned long changed = doc()->getSkippedRecomputeCount() - skipped - unchanged;
+    inner->touch();
+    doc()->recompute({}, true);
+    unsigned long forced = doc()->getSkippedRecomputeCount() - skipped - unchanged - changed;
+    outer->enforceRecompute();
+    doc()->recompute();
+    unsigned long enforced =
+        doc()->getSkippedRecomputeCount() - skipped - unchanged - changed - forced;
+    hGrp->RemoveBool("SkipUnchangedRecompute");
+
+    // Assert - touching the inner group enforces its recompute, the outer group depends on it
+    // and is recomputed after it
+    EXPECT_EQ(unchanged, 1UL);
+    EXPECT_EQ(changed, 0UL);
+    EXPECT_EQ(forced, 0UL);
+    EXPECT_EQ(enforced, 0UL);
+}
+
+TEST_F(DocumentTest, recomputeNeverSkipsTouchedObjects)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("SkipUnchangedRecompute", true);
+    auto outer = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Outer"));
+    auto inner = doc()->addObject("App::DocumentObjectGroup", "Inner");
+    outer->addObject(inner);
+    doc()->recompute();
+    unsigned long skipped = doc()->getSkippedRecomputeCount();
+
+    // Act - touching without enforcing the recompute still invalidates the remembered inputs
+    outer->touch(true);
+    doc()->recompute();
+    unsigned long touched = doc()->getSkippedRecomputeCount() - skipped;
+    doc()->recompute({}, true);
+    inner->touch(true);
+    doc()->recompute();
+    unsigned long afterForced = doc()->getSkippedRecomputeCount() - skipped - touched;
+    hGrp->RemoveBool("SkipUnchangedRecompute");
+
+    // Assert - the outer group isn't skipped after the forced recompute either
+    EXPECT_EQ(touched, 0UL);
+    EXPECT_EQ(afterForced, 0UL);
+}
+
+TEST_F(DocumentTest, recomputeNeverSkipsExternalInputs)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("SkipUnchangedRecompute", true);
+    auto outer = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Outer"));
+    auto inner = doc()->addObject("App::DocumentObjectGroup", "Inner");
+    outer->addObject(inner);
+    outer->addDynamicProperty("App::PropertyFile", "File");
+    doc()->recompute();
+    unsigned long skipped = doc()->getSkippedRecomputeCount();
+
+    // Act
+    inner->touch();
+    doc()->recompute();
+    hGrp->RemoveBool("SkipUnchangedRecompute");
+
+    // Assert - the file may have changed although the file name is the same
+    EXPECT_FALSE(outer->canSkipUnchangedRecompute());
+    EXPECT_EQ(doc()->getSkippedRecomputeCount(), skipped);
+}
+
 // NOLINTEND(readability-magic-numbers)
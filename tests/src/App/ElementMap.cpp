@@ -2,7 +2,10 @@
 
 #include "gtest/gtest.h"
 
+#include <sstream>
+
 #include <App/Application.h>
+#include <App/Document.h>
 #include <App/ElementMap.h>
 #include <src/App/InitApplication.h>
 
@@ -554,4 +557,130 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
         }));
 }
 
+TEST_F(ElementMapTest, postfixStorageIsShared)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::MappedName name1("Edge1");
+    Data::MappedName name2("Edge2");
+    name1 += ";:H1:3,E";
+    name2 += ";:H1:3,E";
+
+    // Act
+    elementMap.setElementName(Data::IndexedName("Edge", 1), name1, 0);
+    elementMap.setElementName(Data::IndexedName("Edge", 2), name2, 0);
+    auto found1 = elementMap.find(Data::IndexedName("Edge", 1));
+    auto found2 = elementMap.find(Data::IndexedName("Edge", 2));
+
+    // Assert
+    EXPECT_EQ(found1, name1);
+    EXPECT_EQ(found2, name2);
+    EXPECT_EQ(found1.postfixBytes().constData(), found2.postfixBytes().constData());
+    EXPECT_EQ(elementMap.find(name2).toString(), "Edge2");
+}
+
+TEST_F(ElementMapTest, findNameSplitDifferently)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::MappedName name("Face1");
+    name += ";:M;FUS";
+    elementMap.setElementName(Data::IndexedName("Face", 3), name, 0);
+
+    // Act - same bytes, but without any postfix
+    auto found = elementMap.find(Data::MappedName("Face1;:M;FUS"));
+
+    // Assert
+    EXPECT_EQ(found.toString(), "Face3");
+}
+
+TEST_F(ElementMapTest, findNameWithTwoDifferentSplits)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::MappedName name("Face1;:M;FUS;:H1:7");
+    name += ",F;:H2:3,F";
+    elementMap.setElementName(Data::IndexedName("Face", 4), name, 0);
+
+    // Act - the same bytes, split at another position between data and postfix
+    Data::MappedName otherSplit("Face1;:M");
+    otherSplit += ";FUS;:H1:7,F;:H2:3,F";
+    auto found = elementMap.find(otherSplit);
+
+    // Assert
+    ASSERT_EQ(otherSplit, name);
+    EXPECT_NE(otherSplit.dataBytes(), name.dataBytes());
+    EXPECT_EQ(found.toString(), "Face4");
+}
+
+TEST_F(ElementMapTest, saveBinaryKeepsNonCanonicalNames)
+{
+    // Arrange
+    auto doc = App::GetApplication().getDocument(_docName.c_str());
+    LessComplexPart cube(1L, "Box", _hasher);
+    Data::MappedName paddedName("Edge01");
+    cube.elementMapPtr->setElementName(Data::IndexedName("Edge", 1), paddedName, cube.Tag);
+
+    App::GetApplication().signalStartSaveDocument(*doc, std::string());
+    cube.elementMapPtr->beforeSave(_hasher);
+    std::stringstream binaryStream;
+    cube.elementMapPtr->saveBinary(binaryStream);
+    App::GetApplication().signalFinishSaveDocument(*doc, std::string());
+
+    // Act
+    App::GetApplication().signalStartRestoreDocument(*doc);
+    auto binaryMap = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, binaryStream);
+    App::GetApplication().signalFinishRestoreDocument(*doc);
+
+    // Assert
+    EXPECT_EQ(binaryMap->find(Data::IndexedName("Edge", 1)), paddedName);
+    EXPECT_EQ(binaryMap->find(paddedName).toString(), "Edge1");
+}
+
+TEST_F(ElementMapTest, saveBinaryAndRestore)
+{
+    // Arrange
+    auto doc = App::GetApplication().getDocument(_docName.c_str());
+    LessComplexPart cube(1L, "Box", _hasher);
+    auto sid = _hasher->getID(QByteArray("SomeHashedName"));
+    Data::ElementIDRefs sids;
+    sids.push_back(sid);
+    Data::MappedName edgeName("Edge1");
+    edgeName += ";:H2:4,E";
+    cube.elementMapPtr->setElementName(Data::IndexedName("Edge", 1), edgeName, cube.Tag, &sids);
+    Data::MappedName hashedName(sid);
+    cube.elementMapPtr->setElementName(Data::IndexedName("Edge", 2), hashedName, cube.Tag, &sids);
+
+    App::GetApplication().signalStartSaveDocument(*doc, std::string());
+    cube.elementMapPtr->beforeSave(_hasher);
+    std::stringstream textStream;
+    std::stringstream binaryStream;
+    cube.elementMapPtr->save(textStream);
+    cube.elementMapPtr->saveBinary(binaryStream);
+    App::GetApplication().signalFinishSaveDocument(*doc, std::string());
+
+    // Act
+    App::GetApplication().signalStartRestoreDocument(*doc);
+    auto textMap = std::make_shared<Data::ElementMap>()->restore(_hasher, textStream);
+    App::GetApplication().signalStartRestoreDocument(*doc);
+    auto binaryMap = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, binaryStream);
+    App::GetApplication().signalFinishRestoreDocument(*doc);
+
+    // Assert
+    auto expected = cube.elementMapPtr->getAll();
+    auto textElements = textMap->getAll();
+    auto binaryElements = binaryMap->getAll();
+    ASSERT_EQ(binaryElements.size(), expected.size());
+    ASSERT_EQ(textElements.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(binaryElements[i].name, expected[i].name);
+        EXPECT_EQ(binaryElements[i].index.toString(), expected[i].index.toString());
+        EXPECT_EQ(textElements[i].name, binaryElements[i].name);
+    }
+    Data::ElementIDRefs restoredSids;
+    EXPECT_EQ(binaryMap->find(Data::IndexedName("Edge", 1), &restoredSids), edgeName);
+    ASSERT_EQ(restoredSids.size(), 1);
+    EXPECT_EQ(restoredSids[0].value(), sid.value());
+}
+
 // NOLINTEND(readability-magic-numbers)
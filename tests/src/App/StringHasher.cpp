@@ -9,6 +9,8 @@
 
 #include <QCryptographicHash>
 #include <array>
+#include <set>
+#include <thread>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1469,6 +1471,100 @@ TEST_F(StringHasherTest, getIDFromIntegerIDBadID)  // NOLINT
     EXPECT_FALSE(result);
 }
 
+TEST_F(StringHasherTest, getIDKeepsStringIDStable)  // NOLINT
+{
+    // Arrange
+    auto first = Hasher()->getID("data");
+    const App::StringID* address = &first.deref();
+    const long value = first.value();
+
+    // Act - grow the table well past its initial size
+    const int count {10000};
+    for (int i = 0; i < count; ++i) {
+        Hasher()->getID(QByteArray::number(i));
+    }
+    auto second = Hasher()->getID("data");
+
+    // Assert
+    EXPECT_EQ(address, &second.deref());
+    EXPECT_EQ(value, second.value());
+    EXPECT_EQ(address, &Hasher()->getID(value).deref());
+}
+
+TEST_F(StringHasherTest, getIDConcurrentInserts)  // NOLINT
+{
+    // Arrange - every thread inserts the same strings, starting at a different position
+    const int threadCount {8};
+    const int stringCount {2000};
+    std::vector<std::vector<App::StringIDRef>> results(threadCount);
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([this, t, &results]() {
+            std::vector<App::StringIDRef> refs(stringCount);
+            for (int i = 0; i < stringCount; ++i) {
+                int index = (i + t * stringCount / threadCount) % stringCount;
+                refs[index] = Hasher()->getID(QByteArray("String") + QByteArray::number(index));
+            }
+            results[t] = std::move(refs);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert - one StringID per string, with distinct integer IDs
+    EXPECT_EQ(stringCount, Hasher()->size());
+    std::set<long> values;
+    for (int i = 0; i < stringCount; ++i) {
+        for (int t = 1; t < threadCount; ++t) {
+            EXPECT_EQ(&results[0][i].deref(), &results[t][i].deref());
+        }
+        values.insert(results[0][i].value());
+        EXPECT_EQ(&results[0][i].deref(), &Hasher()->getID(results[0][i].value()).deref());
+    }
+    EXPECT_EQ(stringCount, values.size());
+    EXPECT_EQ(1, *values.begin());
+    EXPECT_EQ(stringCount, *values.rbegin());
+}
+
+TEST_F(StringHasherTest, getIDConcurrentMappedNames)  // NOLINT
+{
+    // Arrange - mapped names sharing their postfix
+    const int threadCount {8};
+    const int nameCount {500};
+    std::vector<std::vector<App::StringIDRef>> results(threadCount);
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([this, t, &results]() {
+            std::vector<App::StringIDRef> refs;
+            refs.reserve(nameCount);
+            for (int i = 0; i < nameCount; ++i) {
+                auto name = std::string("Edge") + std::to_string(i + 1);
+                auto mappedName = givenMappedName(name.c_str(), ";:M;FUS;:Hb:7,F");
+                refs.push_back(Hasher()->getID(mappedName, QVector<App::StringIDRef>()));
+            }
+            results[t] = std::move(refs);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert - the names only differ by their index, so they share one StringID, stored along
+    // with the encoded postfix and the "Edge" text
+    EXPECT_EQ(3, Hasher()->size());
+    for (int i = 0; i < nameCount; ++i) {
+        EXPECT_EQ(i + 1, results[0][i].getIndex());
+        for (int t = 1; t < threadCount; ++t) {
+            EXPECT_EQ(results[0][i], results[t][i]);
+        }
+    }
+}
+
 
 TEST_F(StringHasherTest, getIDMap)  // NOLINT
 {
@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Base/Console.h"
+
+FC_LOG_LEVEL_INIT("ConsoleTest", true, true)
+
+namespace
+{
+
+class TestLogger: public Base::ILogger
+{
+public:
+    void SendLog(const std::string& /*notifiername*/,
+                 const std::string& msg,
+                 Base::LogStyle /*level*/,
+                 Base::IntendedRecipient /*recipient*/,
+                 Base::ContentType /*content*/) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        messages.push_back(msg);
+    }
+
+    const char* Name() override
+    {
+        return "TestLogger";
+    }
+
+    std::vector<std::string> getMessages()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return messages;
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::string> messages;
+};
+
+int countEvaluations(int& counter)
+{
+    return ++counter;
+}
+
+}  // namespace
+
+class ConsoleTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Base::Console().AttachObserver(&_logger);
+    }
+
+    void TearDown() override
+    {
+        Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+        Base::Console().SetRateLimit(0, std::chrono::milliseconds(0));
+        Base::Console().DetachObserver(&_logger);
+    }
+
+    // Sends messages of the form "thread:index" from several threads at the same time
+    static void sendFromThreads(int numThreads, int numMessages)
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; t++) {
+            threads.emplace_back([t, numMessages]() {
+                for (int i = 0; i < numMessages; i++) {
+                    Base::Console().Message("%d:%d", t, i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // Checks that all messages arrived and that each thread's messages kept their order
+    static void expectAllInOrder(const std::vector<std::string>& messages,
+                                 int numThreads,
+                                 int numMessages)
+    {
+        EXPECT_EQ(messages.size(), static_cast<std::size_t>(numThreads * numMessages));
+        std::vector<int> last(numThreads, -1);
+        for (const auto& msg : messages) {
+            int thread = std::stoi(msg);
+            int index = std::stoi(msg.substr(msg.find(':') + 1));
+            EXPECT_EQ(index, last[thread] + 1);
+            last[thread] = index;
+        }
+    }
+
+    TestLogger _logger;
+};
+
+TEST_F(ConsoleTest, directModeFromThreads)
+{
+    // Act
+    sendFromThreads(4, 500);
+
+    // Assert
+    expectAllInOrder(_logger.getMessages(), 4, 500);
+}
+
+TEST_F(ConsoleTest, asyncModeFromThreads)
+{
+    // Arrange
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Async);
+
+    // Act
+    sendFromThreads(4, 500);
+    Base::Console().Flush();
+
+    // Assert
+    expectAllInOrder(_logger.getMessages(), 4, 500);
+}
+
+TEST_F(ConsoleTest, asyncModeFlushedOnModeChange)
+{
+    // Arrange
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Async);
+    Base::Console().Message("first");
+
+    // Act
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+    Base::Console().Message("second");
+
+    // Assert
+    std::vector<std::string> expected {"first", "second"};
+    EXPECT_EQ(_logger.getMessages(), expected);
+}
+
+TEST_F(ConsoleTest, isActiveWithConcurrentAttachAndDetach)
+{
+    // Arrange - only the notifications of the other loggers are active
+    _logger.bNotification = false;
+    std::atomic<bool> alwaysActive {true};
+    std::atomic<bool> stop {false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&stop]() {
+            auto logger = std::make_unique<TestLogger>();
+            logger->bNotification = true;
+            while (!stop) {
+                Base::Console().AttachObserver(logger.get());
+                Base::Console().DetachObserver(logger.get());
+            }
+        });
+    }
+    threads.emplace_back([&stop, &alwaysActive]() {
+        while (!stop) {
+            if (!Base::Console().IsActive(Base::LogStyle::Message)) {
+                alwaysActive = false;
+            }
+        }
+    });
+
+    // Act
+    sendFromThreads(4, 500);
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert - the messages reached the logger that stayed attached, and the other loggers
+    // are all detached again
+    EXPECT_TRUE(alwaysActive);
+    expectAllInOrder(_logger.getMessages(), 4, 500);
+    EXPECT_FALSE(Base::Console().IsActive(Base::LogStyle::Notification));
+    _logger.bNotification = true;
+    EXPECT_TRUE(Base::Console().IsActive(Base::LogStyle::Notification));
+}
+
+TEST_F(ConsoleTest, logNotFormattedWhenFiltered)
+{
+    // Arrange
+    int counter = 0;
+    int* level = Base::Console().GetLogLevel("ConsoleTest");
+    int oldLevel = *level;
+    *level = FC_LOGLEVEL_ERR;
+
+    // Act
+    FC_LOG("value " << countEvaluations(counter));
+    FC_ERR("value " << countEvaluations(counter));
+    *level = oldLevel;
+
+    // Assert
+    EXPECT_EQ(counter, 1);
+}
+
+TEST_F(ConsoleTest, rateLimitDropsRepeatedWarnings)
+{
+    // Arrange
+    Base::Console().SetRateLimit(3, std::chrono::hours(1));
+
+    // Act
+    for (int i = 0; i < 10; i++) {
+        Base::Console().Warning("repeated\n");
+    }
+    Base::Console().Warning("other\n");
+    Base::Console().Message("repeated\n");
+
+    // Assert
+    std::vector<std::string> expected {"repeated\n",
+                                       "repeated\n",
+                                       "repeated\n",
+                                       "other\n",
+                                       "repeated\n"};
+    EXPECT_EQ(_logger.getMessages(), expected);
+}
+
+TEST_F(ConsoleTest, rateLimitReportsDroppedWarnings)
+{
+    // Arrange
+    Base::Console().SetRateLimit(1, std::chrono::milliseconds(20));
+    Base::Console().Warning("repeated\n");
+    Base::Console().Warning("repeated\n");
+    Base::Console().Warning("repeated\n");
+
+    // Act
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    Base::Console().Warning("repeated\n");
+
+    // Assert
+    std::vector<std::string> messages = _logger.getMessages();
+    ASSERT_EQ(messages.size(), 3U);
+    EXPECT_EQ(messages[0], "repeated\n");
+    EXPECT_NE(messages[1].find("2 times"), std::string::npos);
+    EXPECT_EQ(messages[2], "repeated\n");
+}
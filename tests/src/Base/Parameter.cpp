@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Base/Parameter.h"
+
+class ParameterTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        ParameterManager::Init();
+    }
+
+    void SetUp() override
+    {
+        _manager = ParameterManager::Create();
+        _manager->CreateDocument();
+        _group = _manager->GetGroup("BaseApp/Preferences/Test");
+    }
+
+    void TearDown() override
+    {
+        _group = nullptr;
+        _manager = nullptr;
+    }
+
+    // Adds some parameters in front of the ones used by the test so that a lookup has to scan
+    void fillGroup(int count)
+    {
+        for (int i = 0; i < count; i++) {
+            std::string name = "Dummy" + std::to_string(i);
+            _group->SetBool(name.c_str(), true);
+            _group->SetFloat(name.c_str(), i * 0.5);
+        }
+    }
+
+    Base::Reference<ParameterManager> _manager;
+    ParameterGrp::handle _group;
+};
+
+TEST_F(ParameterTest, getCachedValueAfterSet)
+{
+    // Arrange - the first lookups also cache the missing parameters
+    EXPECT_FALSE(_group->GetBool("Bool", false));
+    EXPECT_EQ(_group->GetInt("Int", 3), 3);
+    EXPECT_EQ(_group->GetUnsigned("Unsigned", 4), 4UL);
+    EXPECT_DOUBLE_EQ(_group->GetFloat("Float", 1.5), 1.5);
+    EXPECT_EQ(_group->GetASCII("Text", "default"), "default");
+
+    // Act
+    _group->SetBool("Bool", true);
+    _group->SetInt("Int", -7);
+    _group->SetUnsigned("Unsigned", 42);
+    _group->SetFloat("Float", 2.25);
+    _group->SetASCII("Text", "value");
+
+    // Assert
+    EXPECT_TRUE(_group->GetBool("Bool", false));
+    EXPECT_EQ(_group->GetInt("Int", 3), -7);
+    EXPECT_EQ(_group->GetUnsigned("Unsigned", 4), 42UL);
+    EXPECT_DOUBLE_EQ(_group->GetFloat("Float", 1.5), 2.25);
+    EXPECT_EQ(_group->GetASCII("Text", "default"), "value");
+}
+
+TEST_F(ParameterTest, getCachedValueAfterRemove)
+{
+    // Arrange
+    _group->SetInt("Int", 5);
+    _group->SetASCII("Text", "value");
+    EXPECT_EQ(_group->GetInt("Int", 0), 5);
+    EXPECT_EQ(_group->GetASCII("Text"), "value");
+
+    // Act
+    _group->RemoveInt("Int");
+    _group->RemoveASCII("Text");
+
+    // Assert
+    EXPECT_EQ(_group->GetInt("Int", 1), 1);
+    EXPECT_EQ(_group->GetASCII("Text", "default"), "default");
+}
+
+TEST_F(ParameterTest, getCachedValueAfterClear)
+{
+    // Arrange
+    _group->SetFloat("Float", 3.0);
+    auto sub = _group->GetGroup("Sub");
+    sub->SetBool("Bool", true);
+    EXPECT_DOUBLE_EQ(_group->GetFloat("Float"), 3.0);
+    EXPECT_TRUE(sub->GetBool("Bool"));
+
+    // Act
+    _group->Clear();
+
+    // Assert
+    EXPECT_DOUBLE_EQ(_group->GetFloat("Float", 1.0), 1.0);
+    EXPECT_FALSE(sub->GetBool("Bool", false));
+}
+
+TEST_F(ParameterTest, getCachedValueAfterRemoveGroup)
+{
+    // Arrange
+    auto sub = _group->GetGroup("Sub");
+    sub->SetUnsigned("Unsigned", 10);
+    EXPECT_EQ(sub->GetUnsigned("Unsigned"), 10UL);
+
+    // Act
+    _group->RemoveGrp("Sub");
+    sub = _group->GetGroup("Sub");
+
+    // Assert
+    EXPECT_EQ(sub->GetUnsigned("Unsigned", 2), 2UL);
+}
+
+TEST_F(ParameterTest, getCachedValueOfDifferentTypes)
+{
+    // Arrange
+    _group->SetInt("Name", 1);
+    _group->SetFloat("Name", 2.5);
+
+    // Act
+    long intValue = _group->GetInt("Name");
+    double floatValue = _group->GetFloat("Name");
+    bool boolValue = _group->GetBool("Name", true);
+
+    // Assert
+    EXPECT_EQ(intValue, 1);
+    EXPECT_DOUBLE_EQ(floatValue, 2.5);
+    EXPECT_TRUE(boolValue);
+}
+
+TEST_F(ParameterTest, getValueFromConcurrentReaders)
+{
+    // Arrange
+    const int numValues = 100;
+    for (int i = 0; i < numValues; i++) {
+        _group->SetInt(("Int" + std::to_string(i)).c_str(), i);
+    }
+    std::vector<std::thread> threads;
+    std::vector<int> errors(8, 0);
+
+    // Act
+    for (std::size_t t = 0; t < errors.size(); t++) {
+        threads.emplace_back([this, t, &errors]() {
+            for (int round = 0; round < 20; round++) {
+                for (int i = 0; i < numValues; i++) {
+                    std::string name = "Int" + std::to_string(i);
+                    if (_group->GetInt(name.c_str(), -1) != i) {
+                        errors[t]++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    for (int error : errors) {
+        EXPECT_EQ(error, 0);
+    }
+}
+
+TEST_F(ParameterTest, getValueThroughput)
+{
+    // Arrange
+    using Clock = std::chrono::steady_clock;
+    fillGroup(50);
+    _group->SetBool("CanAbortRecompute", true);
+    const int numLookups = 20000;
+    std::string value;
+
+    // Act - GetAttribute() searches the DOM on every call as GetBool() did without the cache
+    auto start = Clock::now();
+    int found = 0;
+    for (int i = 0; i < numLookups; i++) {
+        if (_group->GetAttribute(ParameterGrp::ParamType::FCBool,
+                                 "CanAbortRecompute",
+                                 value,
+                                 nullptr)) {
+            found++;
+        }
+    }
+    auto middle = Clock::now();
+    int enabled = 0;
+    for (int i = 0; i < numLookups; i++) {
+        if (_group->GetBool("CanAbortRecompute", false)) {
+            enabled++;
+        }
+    }
+    auto end = Clock::now();
+
+    // Assert - the rates are only reported as they depend on the machine
+    EXPECT_EQ(found, numLookups);
+    EXPECT_EQ(enabled, numLookups);
+    auto rate = [](Clock::duration elapsed) {
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        return std::to_string(numLookups / std::max(seconds, 1e-9));
+    };
+    RecordProperty("UncachedLookupsPerSecond", rate(middle - start));
+    RecordProperty("CachedLookupsPerSecond", rate(end - middle));
+}
@@ -7,11 +7,15 @@
 #endif
 
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Reader.h"
+#include "Base/Writer.h"
 #include <array>
 #include <boost/filesystem.hpp>
 #include <fmt/format.h>
 #include <fstream>
+#include <zipios++/zipfile.h>
+#include <zipios++/zipinputstream.h>
 
 namespace fs = boost::filesystem;
 
@@ -293,3 +297,327 @@ TEST_F(ReaderTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("FreeCAD rocks! 🪨🪨🪨"), std::string(buffer.data()));
 }
+
+namespace
+{
+
+// Stores a string in its own file of the archive
+class StringData: public Base::Persistence
+{
+public:
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    void Save(Base::Writer& writer) const override
+    {
+        writer.addFile("String.txt", this);
+    }
+    void Restore(Base::XMLReader& reader) override
+    {
+        reader.addFile("String.txt", this);
+    }
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << data;
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        std::getline(reader, data);
+    }
+    bool deferDocFile(const std::shared_ptr<Base::DeferredFile>& file) override
+    {
+        if (acceptDeferral) {
+            deferred = file;
+        }
+        return acceptDeferral;
+    }
+
+    std::string data;
+    std::shared_ptr<Base::DeferredFile> deferred;
+    bool acceptDeferral {true};
+};
+
+}  // namespace
+
+class DeferredFileTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        xercesc_3_2::XMLPlatformUtils::Initialize();
+        _archive = fs::temp_directory_path() / "unit_test_DeferredFile.zip";
+        StringData source;
+        source.data = "FreeCAD rocks!";
+        Base::ZipWriter writer(_archive.string().c_str());
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><document/>)";
+        source.Save(writer);
+        writer.writeFiles();
+    }
+
+    void TearDown() override
+    {
+        if (fs::exists(_archive)) {
+            fs::remove(_archive);
+        }
+    }
+
+    // Reads the archive like App::Document::restore() does
+    void readArchive(StringData& target, bool defer)
+    {
+        std::ifstream file(_archive.string(), std::ios::in | std::ios::binary);
+        zipios::ZipInputStream zipstream(file);
+        Base::XMLReader reader(_archive.string().c_str(), zipstream);
+        target.Restore(reader);
+        reader.setDeferFiles(defer);
+        reader.readFiles(zipstream);
+    }
+
+    // Simulates moving the project file while it is open
+    void removeArchive()
+    {
+        fs::remove(_archive);
+    }
+
+private:
+    fs::path _archive;
+};
+
+TEST_F(DeferredFileTest, readFilesImmediately)
+{
+    // Arrange
+    StringData target;
+
+    // Act
+    readArchive(target, false);
+
+    // Assert
+    EXPECT_EQ(target.data, "FreeCAD rocks!");
+    EXPECT_FALSE(target.deferred);
+}
+
+TEST_F(DeferredFileTest, readFilesDeferred)
+{
+    // Arrange
+    StringData target;
+    readArchive(target, true);
+    ASSERT_TRUE(target.deferred);
+    EXPECT_TRUE(target.data.empty());
+    EXPECT_EQ(target.deferred->getFileName(), "String.txt");
+
+    // Act
+    bool restored = target.deferred->restore(target);
+
+    // Assert
+    EXPECT_TRUE(restored);
+    EXPECT_FALSE(target.deferred->hasFailed());
+    EXPECT_EQ(target.data, "FreeCAD rocks!");
+}
+
+TEST_F(DeferredFileTest, readFilesDeferredArchiveRemoved)
+{
+    // Arrange
+    StringData target;
+    readArchive(target, true);
+    ASSERT_TRUE(target.deferred);
+    removeArchive();
+
+    // Act
+    bool restored = target.deferred->restore(target);
+
+    // Assert
+    EXPECT_FALSE(restored);
+    EXPECT_TRUE(target.deferred->hasFailed());
+    EXPECT_TRUE(target.data.empty());
+}
+
+TEST_F(DeferredFileTest, readFilesDeferralRejected)
+{
+    // Arrange
+    StringData target;
+    target.acceptDeferral = false;
+
+    // Act
+    readArchive(target, true);
+
+    // Assert
+    EXPECT_EQ(target.data, "FreeCAD rocks!");
+    EXPECT_FALSE(target.deferred);
+}
+
+namespace
+{
+
+// Stores a label in an XML document file like Gui::Document does with GuiDocument.xml
+class GuiDocumentData: public Base::Persistence
+{
+public:
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(label.size());
+    }
+    void Save(Base::Writer& writer) const override
+    {
+        writer.addFile("GuiDocument.xml", this);
+    }
+    void Restore(Base::XMLReader& reader) override
+    {
+        reader.addFile("GuiDocument.xml", this);
+    }
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><GuiDocument Label=")"
+                        << label << R"("/>)";
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        Base::XMLReader xmlReader("GuiDocument.xml", reader);
+        xmlReader.readElement("GuiDocument");
+        label = xmlReader.getAttribute("Label");
+        binary = xmlReader.isBinary();
+    }
+
+    std::string label;
+    bool binary {false};
+};
+
+}  // namespace
+
+class BinaryXMLTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        xercesc_3_2::XMLPlatformUtils::Initialize();
+    }
+
+    // Converts the document into the binary encoding and opens a reader for it
+    Base::XMLReader* givenBinaryDocument(const std::string& data)
+    {
+        std::istringstream text(R"(<?xml version="1.0" encoding="UTF-8"?>)" + data);
+        Base::XMLReader::convertToBinary(text, _binary);
+        _reader = std::make_unique<Base::XMLReader>("<memory>", _binary);
+        return _reader.get();
+    }
+
+private:
+    std::stringstream _binary;
+    std::unique_ptr<Base::XMLReader> _reader;
+};
+
+TEST_F(BinaryXMLTest, readElementsAndAttributes)
+{
+    // Arrange
+    auto reader = givenBinaryDocument(R"(<Document SchemaVersion="4">
+    <Property name="Length" type="App::PropertyLength"><Float value="1.5"/></Property>
+    <Property name="Width" type="App::PropertyLength"><Float value="2.5"/></Property>
+</Document>)");
+
+    // Act & Assert
+    EXPECT_TRUE(reader->isValid());
+    EXPECT_TRUE(reader->isBinary());
+    reader->readElement("Document");
+    EXPECT_EQ(reader->getAttributeAsInteger("SchemaVersion"), 4);
+    for (const char* name : {"Length", "Width"}) {
+        reader->readElement("Property");
+        EXPECT_STREQ(reader->getAttribute("name"), name);
+        EXPECT_STREQ(reader->getAttribute("type"), "App::PropertyLength");
+        reader->readElement("Float");
+        EXPECT_FALSE(reader->hasAttribute("name"));
+        EXPECT_GT(reader->getAttributeAsFloat("value"), 1.0);
+        reader->readEndElement("Property");
+    }
+    reader->readEndElement("Document");
+    EXPECT_FALSE(reader->readNextElement());
+    EXPECT_TRUE(reader->isEndOfDocument());
+}
+
+TEST_F(BinaryXMLTest, readCharStream)
+{
+    // Arrange
+    Base::StringWriter writer;
+    writer.Stream() << "<Document><Text>";
+    writer.beginCharStream(Base::CharStreamFormat::Base64Encoded) << "FreeCAD rocks!";
+    writer.endCharStream() << "</Text><Empty></Empty></Document>";
+    auto reader = givenBinaryDocument(writer.getString());
+    std::string text;
+
+    // Act
+    reader->readElement("Text");
+    std::getline(reader->beginCharStream(Base::CharStreamFormat::Base64Encoded), text);
+    reader->endCharStream();
+    reader->readEndElement("Text");
+    reader->readElement("Empty");
+    reader->readEndElement("Empty");
+
+    // Assert
+    EXPECT_EQ(text, "FreeCAD rocks!");
+    EXPECT_TRUE(reader->isEndOfElement());
+}
+
+TEST_F(BinaryXMLTest, writeArchiveInBinaryEncoding)
+{
+    // Arrange
+    fs::path archive = fs::temp_directory_path() / "unit_test_BinaryXML.zip";
+    {
+        Base::ZipWriter writer(archive.string().c_str());
+        writer.setMode("BinaryXML");
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><Document Label="A &amp; B"/>)";
+        writer.writeFiles();
+    }
+
+    // Act
+    bool hasTextEntry = false;
+    bool hasBinaryEntry = false;
+    {
+        zipios::ZipFile zip(archive.string());
+        hasTextEntry = zip.getEntry("Document.xml").get() != nullptr;
+        hasBinaryEntry = zip.getEntry("Document.bxml").get() != nullptr;
+    }
+    std::ifstream file(archive.string(), std::ios::in | std::ios::binary);
+    zipios::ZipInputStream zipstream(file);
+    Base::XMLReader reader(archive.string().c_str(), zipstream);
+    reader.readElement("Document");
+    std::string label = reader.getAttribute("Label");
+    file.close();
+    fs::remove(archive);
+
+    // Assert
+    EXPECT_FALSE(hasTextEntry);
+    EXPECT_TRUE(hasBinaryEntry);
+    EXPECT_TRUE(reader.isBinary());
+    EXPECT_EQ(label, "A & B");
+}
+
+TEST_F(BinaryXMLTest, readGuiDocumentInBinaryEncoding)
+{
+    // Arrange
+    fs::path archive = fs::temp_directory_path() / "unit_test_BinaryGuiXML.zip";
+    {
+        GuiDocumentData source;
+        source.label = "Gui";
+        Base::ZipWriter writer(archive.string().c_str());
+        writer.setMode("BinaryXML");
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><Document/>)";
+        source.Save(writer);
+        writer.writeFiles();
+    }
+    GuiDocumentData target;
+
+    // Act
+    {
+        std::ifstream file(archive.string(), std::ios::in | std::ios::binary);
+        zipios::ZipInputStream zipstream(file);
+        Base::XMLReader reader(archive.string().c_str(), zipstream);
+        target.Restore(reader);
+        reader.readFiles(zipstream);
+    }
+    fs::remove(archive);
+
+    // Assert
+    EXPECT_EQ(target.label, "Gui");
+    EXPECT_TRUE(target.binary);
+}
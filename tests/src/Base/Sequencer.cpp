@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+#include "Base/Sequencer.h"
+
+namespace
+{
+
+// Records the progress it was asked to show and cancels the operation once it reached
+// the given percentage
+class TestSequencer: public Base::SequencerBase
+{
+public:
+    explicit TestSequencer(int cancelAt = -1)
+        : cancelAt(cancelAt)
+    {}
+
+    int lastPercent() const
+    {
+        return progressInPercent();
+    }
+
+    std::thread::id lastThread;
+
+protected:
+    void nextStep(bool canAbort) override
+    {
+        lastThread = std::this_thread::get_id();
+        if (canAbort && cancelAt >= 0 && progressInPercent() >= cancelAt) {
+            tryToCancel();
+        }
+    }
+
+private:
+    int cancelAt;
+};
+
+// Runs the given number of workers, each of them advances the token by one for every step
+// as long as it isn't canceled. The calling thread polls the token meanwhile.
+size_t runWorkers(Base::SequencerLauncher& seq,
+                  Base::ProgressToken& token,
+                  int numThreads,
+                  size_t numSteps)
+{
+    std::atomic<size_t> done {0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < numSteps; i++) {
+                if (!seq.poll(token)) {
+                    break;
+                }
+                token.next();
+                done++;
+                std::this_thread::yield();
+            }
+        });
+    }
+    while (done < static_cast<size_t>(numThreads) * numSteps && seq.poll(token)) {
+        std::this_thread::yield();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    seq.poll(token);
+    return done;
+}
+
+}  // namespace
+
+class SequencerTest: public ::testing::Test
+{
+protected:
+    // void SetUp() override {}
+
+    // void TearDown() override {}
+};
+
+TEST_F(SequencerTest, progressFromThreads)
+{
+    // Arrange
+    TestSequencer sequencer;
+    Base::SequencerLauncher seq("progressFromThreads", 4000);
+    Base::ProgressToken token(4000);
+
+    // Act
+    size_t done = runWorkers(seq, token, 4, 1000);
+
+    // Assert
+    EXPECT_EQ(done, 4000U);
+    EXPECT_EQ(token.progress(), 4000U);
+    EXPECT_EQ(sequencer.lastPercent(), 100);
+    EXPECT_EQ(sequencer.lastThread, std::this_thread::get_id());
+    EXPECT_FALSE(token.wasCanceled());
+}
+
+TEST_F(SequencerTest, progressScaledToLauncher)
+{
+    // Arrange
+    TestSequencer sequencer;
+    Base::SequencerLauncher seq("progressScaledToLauncher", 10);
+    Base::ProgressToken token(1000);
+
+    // Act
+    token.next(500);
+    seq.poll(token);
+
+    // Assert
+    EXPECT_EQ(sequencer.lastPercent(), 50);
+}
+
+TEST_F(SequencerTest, cancelForwardedToToken)
+{
+    // Arrange
+    TestSequencer sequencer(20);
+    Base::SequencerLauncher seq("cancelForwardedToToken", 4000);
+    Base::ProgressToken token(4000);
+
+    // Act
+    size_t done = runWorkers(seq, token, 4, 1000);
+
+    // Assert
+    EXPECT_TRUE(token.wasCanceled());
+    EXPECT_LT(done, 4000U);
+    EXPECT_THROW(token.checkAbort(), Base::AbortException);
+}
+
+TEST_F(SequencerTest, pollOfNestedLauncher)
+{
+    // Arrange
+    TestSequencer sequencer;
+    Base::SequencerLauncher outer("outer", 100);
+    Base::SequencerLauncher inner("inner", 100);
+    Base::ProgressToken token(100);
+
+    // Act
+    token.next(100);
+    bool running = inner.poll(token);
+
+    // Assert - only the outermost launcher shows any progress
+    EXPECT_TRUE(running);
+    EXPECT_EQ(sequencer.lastPercent(), -1);
+}
+
+TEST_F(SequencerTest, cancelToken)
+{
+    // Arrange
+    Base::ProgressToken token(10);
+
+    // Act & Assert
+    EXPECT_NO_THROW(token.checkAbort());
+    token.cancel();
+    EXPECT_TRUE(token.wasCanceled());
+    EXPECT_THROW(token.checkAbort(), Base::AbortException);
+}
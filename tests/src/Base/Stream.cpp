@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+#include "Base/Stream.h"
+
+namespace
+{
+
+template<typename T>
+std::vector<T> makeValues(std::size_t count)
+{
+    std::vector<T> values(count);
+    for (std::size_t i = 0; i < count; i++) {
+        values[i] = static_cast<T>(static_cast<T>(i * 37 + 5) / static_cast<T>(3));
+    }
+    return values;
+}
+
+// Writes the values one by one, this is the reference for the bulk functions
+template<typename T>
+std::string writeScalars(const std::vector<T>& values, Base::Stream::ByteOrder order)
+{
+    std::stringstream data;
+    Base::OutputStream str(data);
+    str.setByteOrder(order);
+    for (T value : values) {
+        str << value;
+    }
+    return data.str();
+}
+
+template<typename T>
+std::string writeBulk(const std::vector<T>& values, Base::Stream::ByteOrder order)
+{
+    std::stringstream data;
+    Base::OutputStream str(data);
+    str.setByteOrder(order);
+    str.writeArray(values);
+    return data.str();
+}
+
+template<typename T>
+void expectRoundTrip(Base::Stream::ByteOrder order)
+{
+    // More values than fit into one block of the internal swap buffer
+    std::vector<T> values = makeValues<T>(5000);
+    std::string bulk = writeBulk(values, order);
+    EXPECT_EQ(bulk, writeScalars(values, order));
+
+    std::stringstream data(bulk);
+    Base::InputStream str(data);
+    str.setByteOrder(order);
+    std::vector<T> result(values.size());
+    str.readArray(result);
+    EXPECT_EQ(result, values);
+}
+
+}  // namespace
+
+class StreamTest: public ::testing::Test
+{
+protected:
+    // void SetUp() override {}
+
+    // void TearDown() override {}
+};
+
+TEST_F(StreamTest, writeArrayMatchesScalarOutput)
+{
+    expectRoundTrip<int16_t>(Base::Stream::LittleEndian);
+    expectRoundTrip<uint16_t>(Base::Stream::LittleEndian);
+    expectRoundTrip<int32_t>(Base::Stream::LittleEndian);
+    expectRoundTrip<uint32_t>(Base::Stream::LittleEndian);
+    expectRoundTrip<int64_t>(Base::Stream::LittleEndian);
+    expectRoundTrip<uint64_t>(Base::Stream::LittleEndian);
+    expectRoundTrip<float>(Base::Stream::LittleEndian);
+    expectRoundTrip<double>(Base::Stream::LittleEndian);
+}
+
+TEST_F(StreamTest, writeArrayMatchesScalarOutputSwapped)
+{
+    expectRoundTrip<int16_t>(Base::Stream::BigEndian);
+    expectRoundTrip<uint16_t>(Base::Stream::BigEndian);
+    expectRoundTrip<int32_t>(Base::Stream::BigEndian);
+    expectRoundTrip<uint32_t>(Base::Stream::BigEndian);
+    expectRoundTrip<int64_t>(Base::Stream::BigEndian);
+    expectRoundTrip<uint64_t>(Base::Stream::BigEndian);
+    expectRoundTrip<float>(Base::Stream::BigEndian);
+    expectRoundTrip<double>(Base::Stream::BigEndian);
+}
+
+TEST_F(StreamTest, readArrayOfScalarOutput)
+{
+    // Arrange
+    std::vector<double> values = makeValues<double>(100);
+    std::stringstream data(writeScalars(values, Base::Stream::BigEndian));
+    Base::InputStream str(data);
+    str.setByteOrder(Base::Stream::BigEndian);
+    std::vector<double> result(values.size());
+
+    // Act
+    str.readArray(result.data(), 50);
+    str.readArray(result.data() + 50, 50);
+
+    // Assert
+    EXPECT_EQ(result, values);
+    EXPECT_TRUE(str);
+}
+
+TEST_F(StreamTest, readArrayPastEnd)
+{
+    // Arrange
+    std::vector<float> values = makeValues<float>(10);
+    std::stringstream data(writeBulk(values, Base::Stream::LittleEndian));
+    Base::InputStream str(data);
+    std::vector<float> result(20);
+
+    // Act
+    str.readArray(result);
+
+    // Assert
+    EXPECT_FALSE(str);
+}
+
+TEST_F(StreamTest, readWriteEmptyArray)
+{
+    // Arrange
+    std::stringstream data;
+    Base::OutputStream out(data);
+    out.setByteOrder(Base::Stream::BigEndian);
+    std::vector<double> values;
+
+    // Act
+    out.writeArray(values);
+    Base::InputStream in(data);
+    in.readArray(values);
+
+    // Assert
+    EXPECT_TRUE(data.str().empty());
+    EXPECT_TRUE(in);
+}
+
+TEST_F(StreamTest, writeArrayThroughput)
+{
+    // Arrange
+    using Clock = std::chrono::steady_clock;
+    std::vector<float> values = makeValues<float>(3000000);
+
+    // Act
+    auto start = Clock::now();
+    std::string scalar = writeScalars(values, Base::Stream::BigEndian);
+    auto middle = Clock::now();
+    std::string bulk = writeBulk(values, Base::Stream::BigEndian);
+    auto end = Clock::now();
+
+    // Assert - the timings are only reported as they depend on the machine
+    EXPECT_EQ(bulk, scalar);
+    auto scalarTime = std::chrono::duration_cast<std::chrono::microseconds>(middle - start);
+    auto bulkTime = std::chrono::duration_cast<std::chrono::microseconds>(end - middle);
+    RecordProperty("ScalarMicroseconds", static_cast<int>(scalarTime.count()));
+    RecordProperty("BulkMicroseconds", static_cast<int>(bulkTime.count()));
+}
+
+TEST_F(StreamTest, readArrayThroughput)
+{
+    // Arrange
+    using Clock = std::chrono::steady_clock;
+    std::vector<float> values = makeValues<float>(3000000);
+    std::string data = writeBulk(values, Base::Stream::BigEndian);
+    std::vector<float> scalar(values.size());
+    std::vector<float> bulk(values.size());
+
+    // Act
+    auto start = Clock::now();
+    {
+        std::stringstream input(data);
+        Base::InputStream str(input);
+        str.setByteOrder(Base::Stream::BigEndian);
+        for (float& value : scalar) {
+            str >> value;
+        }
+    }
+    auto middle = Clock::now();
+    {
+        std::stringstream input(data);
+        Base::InputStream str(input);
+        str.setByteOrder(Base::Stream::BigEndian);
+        str.readArray(bulk);
+    }
+    auto end = Clock::now();
+
+    // Assert - the timings are only reported as they depend on the machine
+    EXPECT_EQ(bulk, values);
+    EXPECT_EQ(scalar, values);
+    auto scalarTime = std::chrono::duration_cast<std::chrono::microseconds>(middle - start);
+    auto bulkTime = std::chrono::duration_cast<std::chrono::microseconds>(end - middle);
+    RecordProperty("ScalarMicroseconds", static_cast<int>(scalarTime.count()));
+    RecordProperty("BulkMicroseconds", static_cast<int>(bulkTime.count()));
+}
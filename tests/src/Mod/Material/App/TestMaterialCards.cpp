@@ -34,6 +34,7 @@
 #include <Gui/MetaTypes.h>
 
 #include <Mod/Material/App/MaterialLibrary.h>
+#include <Mod/Material/App/MaterialLoader.h>
 #include <Mod/Material/App/MaterialManager.h>
 #include <Mod/Material/App/Model.h>
 #include <Mod/Material/App/ModelManager.h>
@@ -175,4 +176,92 @@ TEST_F(TestMaterialCards, TestCopy)
     EXPECT_EQ(newMaterial->getName(), QString::fromStdString("Test Material6"));
 }
 
+TEST_F(TestMaterialCards, TestLazyLoad)
+{
+    auto testMaterial = _materialManager->getMaterial(Materials::ModelUUIDs::ModelUUID_Test_Material);
+    auto newMaterial = std::make_shared<Materials::Material>(*testMaterial);
+    _materialManager->saveMaterial(_library,
+                      newMaterial,
+                      QString::fromStdString("/Test Lazy.FCMat"),
+                      false, // overwrite
+                      false, // saveAsCopy
+                      false); // saveInherited
+    QString uuid = newMaterial->getUUID();
+    EXPECT_NE(uuid, Materials::ModelUUIDs::ModelUUID_Test_Material);
+
+    // Treat the material as if it came from the library index and hasn't been used yet
+    QString propertyName = QString::fromStdString("TestInteger");
+    auto material = _library->getMaterialByPath(QString::fromStdString("/Test Lazy.FCMat"));
+    QString value = material->getPhysicalValueString(propertyName);
+    material->setPhysicalValue(propertyName, 7);
+    material->setLoaded(false);
+    EXPECT_NE(material->getPhysicalValueString(propertyName), value);
+
+    // Using it reads the card into the same material
+    auto loaded = _materialManager->getMaterial(uuid);
+    EXPECT_EQ(loaded, material);
+    EXPECT_TRUE(loaded->isLoaded());
+    EXPECT_EQ(loaded->getName(), QString::fromStdString("Test Lazy"));
+    EXPECT_EQ(loaded->getPhysicalValueString(propertyName), value);
+}
+
+TEST_F(TestMaterialCards, TestIndexedLoad)
+{
+    auto testMaterial = _materialManager->getMaterial(Materials::ModelUUIDs::ModelUUID_Test_Material);
+    auto newMaterial = std::make_shared<Materials::Material>(*testMaterial);
+    _materialManager->saveMaterial(_library,
+                      newMaterial,
+                      QString::fromStdString("/Indexed/Test Index.FCMat"),
+                      false, // overwrite
+                      false, // saveAsCopy
+                      false); // saveInherited
+    QString uuid = newMaterial->getUUID();
+    QString propertyName = QString::fromStdString("TestInteger");
+    QString value = testMaterial->getPhysicalValueString(propertyName);
+
+    // Load only the test library, like it would be loaded on startup
+    auto param = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Material/Resources");
+    std::vector<const char*> sources {"UseBuiltInMaterials",
+                                      "UseMaterialsFromWorkbenches",
+                                      "UseMaterialsFromConfigDir"};
+    std::vector<bool> used;
+    for (auto source : sources) {
+        used.push_back(param->GetBool(source, true));
+        param->SetBool(source, false);
+    }
+    bool useCustom = param->GetBool("UseMaterialsFromCustomDir", true);
+    std::string customDir = param->GetASCII("CustomMaterialsDir", "");
+    param->SetBool("UseMaterialsFromCustomDir", true);
+    param->SetASCII("CustomMaterialsDir", _library->getDirectoryPath().toStdString());
+
+    auto loadLibrary = []() {
+        auto materials = std::make_shared<std::map<QString, std::shared_ptr<Materials::Material>>>();
+        Materials::MaterialLoader loader(materials,
+            std::make_shared<std::list<std::shared_ptr<Materials::MaterialLibrary>>>());
+        return materials;
+    };
+    // The first load reads the card and writes the index, the second one uses the index
+    auto parsed = loadLibrary();
+    auto indexed = loadLibrary();
+
+    for (std::size_t i = 0; i < sources.size(); i++) {
+        param->SetBool(sources[i], used[i]);
+    }
+    param->SetBool("UseMaterialsFromCustomDir", useCustom);
+    param->SetASCII("CustomMaterialsDir", customDir.c_str());
+
+    ASSERT_EQ(parsed->count(uuid), 1);
+    EXPECT_TRUE(parsed->at(uuid)->isLoaded());
+    ASSERT_EQ(indexed->count(uuid), 1);
+    auto material = indexed->at(uuid);
+    EXPECT_FALSE(material->isLoaded());
+    EXPECT_EQ(material->getName(), QString::fromStdString("Test Index"));
+
+    // Using the material reads its card from the library
+    Materials::MaterialLoader::load(indexed, material);
+    EXPECT_TRUE(material->isLoaded());
+    EXPECT_EQ(material->getPhysicalValueString(propertyName), value);
+}
+
 // clang-format on
@@ -83,6 +83,9 @@ TEST_F(TestMaterial, TestMaterialsWithModel)
     auto materials = _materialManager->materialsWithModel(
         QString::fromStdString("f6f9e48c-b116-4e82-ad7f-3659a9219c50")); // IsotropicLinearElastic
     EXPECT_GT(materials->size(), 0);
+    for (auto& it : *materials) {
+        EXPECT_TRUE(it.second->isLoaded());
+    }
 
     auto materialsComplete = _materialManager->materialsWithModelComplete(
         QString::fromStdString("f6f9e48c-b116-4e82-ad7f-3659a9219c50"));  // IsotropicLinearElastic
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
+#include <memory>
 #include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Mesh/App/MeshProperties.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
 TEST(MeshTest, TestDefault)
@@ -18,4 +20,85 @@ TEST(MeshTest, TestDefault)
     EXPECT_EQ(kernel.CountEdges(), 3);
     EXPECT_EQ(kernel.CountFacets(), 1);
 }
+
+TEST(MeshTest, TestCopySharesKernelUntilModified)
+{
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {0, 0, 1};
+    Base::Vector3f p3 {0, 1, 0};
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    Mesh::MeshObject mesh(kernel);
+
+    Mesh::MeshObject copy(mesh);
+    const Mesh::MeshObject& constMesh = mesh;
+    const Mesh::MeshObject& constCopy = copy;
+    EXPECT_EQ(&constMesh.getKernel(), &constCopy.getKernel());
+
+    copy.getKernel().AddFacet(MeshCore::MeshGeomFacet(p1, p3, Base::Vector3f {1, 0, 0}));
+    EXPECT_NE(&constMesh.getKernel(), &constCopy.getKernel());
+    EXPECT_EQ(mesh.countFacets(), 1);
+    EXPECT_EQ(copy.countFacets(), 2);
+}
+
+TEST(MeshTest, TestAssignSharesKernel)
+{
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {0, 0, 1};
+    Base::Vector3f p3 {0, 1, 0};
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    Mesh::MeshObject mesh(kernel);
+
+    Mesh::MeshObject other;
+    other = mesh;
+    const Mesh::MeshObject& constMesh = mesh;
+    const Mesh::MeshObject& constOther = other;
+    EXPECT_EQ(&constMesh.getKernel(), &constOther.getKernel());
+
+    mesh.clear();
+    EXPECT_EQ(mesh.countFacets(), 0);
+    EXPECT_EQ(other.countFacets(), 1);
+}
+
+TEST(MeshTest, TestSelectionIsNotShared)
+{
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {0, 0, 1};
+    Base::Vector3f p3 {0, 1, 0};
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    Mesh::MeshObject mesh(kernel);
+    Mesh::MeshObject copy(mesh);
+
+    copy.addFacetsToSelection({0});
+    copy.addPointsToSelection({0, 1});
+    EXPECT_EQ(copy.countSelectedFacets(), 1);
+    EXPECT_EQ(copy.countSelectedPoints(), 2);
+    EXPECT_EQ(mesh.countSelectedFacets(), 0);
+    EXPECT_EQ(mesh.countSelectedPoints(), 0);
+
+    Mesh::MeshObject other(copy);
+    other.clearFacetSelection();
+    EXPECT_EQ(other.countSelectedFacets(), 0);
+    EXPECT_EQ(copy.countSelectedFacets(), 1);
+}
+
+TEST(MeshTest, TestUnsharedMemSizeOfCopiedProperty)
+{
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {0, 0, 1};
+    Base::Vector3f p3 {0, 1, 0};
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    Mesh::PropertyMeshKernel prop;
+    prop.setValue(kernel);
+
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    EXPECT_GT(copy->getMemSize(), 0);
+    EXPECT_EQ(copy->getUnsharedMemSize(), 0);
+
+    prop.setValue(MeshCore::MeshKernel());
+    EXPECT_EQ(copy->getUnsharedMemSize(), copy->getMemSize());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+
+#include <Base/Exception.h>
+#include <Mod/Path/App/Path.h>
+
+namespace
+{
+
+Path::Toolpath makeToolpath(int count)
+{
+    Path::Toolpath path;
+    Path::Command cmd;
+    cmd.Name = "G1";
+    for (int i = 0; i < count; i++) {
+        cmd.Parameters["X"] = i * 0.001;
+        cmd.Parameters["Y"] = -i * 0.0021;
+        cmd.Parameters["F"] = 1000.0;
+        path.addCommand(cmd);
+    }
+    return path;
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST(Path, toGCodeFormatsParameters)
+{
+    Path::Command cmd;
+    cmd.Name = "G1";
+    cmd.Parameters["X"] = 1.5;
+    cmd.Parameters["Y"] = -0.0000009;
+    cmd.Parameters["Z"] = 12.0;
+    cmd.Parameters["N"] = 10.0;
+
+    EXPECT_EQ(cmd.toGCode(), "G1 X1.500000 Y-0.000001 Z12.000000");
+    EXPECT_EQ(cmd.toGCode(3, false), "G1 X1.5 Y0 Z12");
+    EXPECT_EQ(cmd.toGCode(0), "G1 X2 Y0 Z12");
+}
+
+TEST(Path, setFromGCodeParsesCommand)
+{
+    Path::Command cmd;
+    cmd.setFromGCode("g1 x1.5 Y-2 z 3");
+
+    EXPECT_EQ(cmd.Name, "G1");
+    ASSERT_EQ(cmd.Parameters.size(), 3U);
+    EXPECT_DOUBLE_EQ(cmd.getParam("X"), 1.5);
+    EXPECT_DOUBLE_EQ(cmd.getParam("Y"), -2.0);
+    EXPECT_DOUBLE_EQ(cmd.getParam("Z"), 3.0);
+
+    cmd.setFromGCode("(a comment 2)");
+    EXPECT_EQ(cmd.Name, "(a comment 2)");
+    EXPECT_TRUE(cmd.Parameters.empty());
+
+    EXPECT_THROW(cmd.setFromGCode("G1 X"), Base::BadFormatError);
+}
+
+TEST(Path, setFromGCodeSplitsCommands)
+{
+    Path::Toolpath path;
+    path.setFromGCode("G0 Z5 (move up)G1 X1 Y2\nG20 G1 X1 M3");
+
+    ASSERT_EQ(path.getSize(), 5U);
+    EXPECT_EQ(path.getCommand(0).Name, "G0");
+    EXPECT_EQ(path.getCommand(1).Name, "(move up)");
+    EXPECT_EQ(path.getCommand(2).Name, "G1");
+    EXPECT_DOUBLE_EQ(path.getCommand(2).getParam("Y"), 2.0);
+    EXPECT_DOUBLE_EQ(path.getCommand(3).getParam("X"), 25.4);
+    EXPECT_EQ(path.getCommand(4).Name, "M3");
+}
+
+TEST(Path, streamRoundTrip)
+{
+    // more than one chunk, so some commands are split between the chunks
+    Path::Toolpath path = makeToolpath(10000);
+    path.addCommand(Path::Command("(done)", {}));
+    std::stringstream str;
+
+    path.toGCode(str);
+    std::string gcode = str.str();
+    Path::Toolpath result;
+    result.setFromGCode(str);
+
+    EXPECT_EQ(gcode, path.toGCode());
+    ASSERT_EQ(result.getSize(), path.getSize());
+    EXPECT_EQ(result.toGCode(), gcode);
+}
+
+TEST(Path, streamThroughput)
+{
+    using Clock = std::chrono::steady_clock;
+    Path::Toolpath path = makeToolpath(200000);
+
+    auto start = Clock::now();
+    std::string gcode = path.toGCode();
+    auto middle = Clock::now();
+    std::stringstream str;
+    path.toGCode(str);
+    auto end = Clock::now();
+    Path::Toolpath result;
+    result.setFromGCode(str);
+    auto parsed = Clock::now();
+
+    // the timings are only reported as they depend on the machine
+    EXPECT_EQ(str.str(), gcode);
+    EXPECT_EQ(result.getSize(), path.getSize());
+    auto stringTime = std::chrono::duration_cast<std::chrono::milliseconds>(middle - start);
+    auto streamTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - middle);
+    auto parseTime = std::chrono::duration_cast<std::chrono::milliseconds>(parsed - end);
+    RecordProperty("StringMilliseconds", static_cast<int>(stringTime.count()));
+    RecordProperty("StreamMilliseconds", static_cast<int>(streamTime.count()));
+    RecordProperty("ParseMilliseconds", static_cast<int>(parseTime.count()));
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
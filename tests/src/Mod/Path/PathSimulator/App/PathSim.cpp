@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+
+#include <Base/Placement.h>
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Path/App/Path.h>
+#include <Mod/Path/PathSimulator/App/PathSim.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+constexpr float toolRadius = 5.0F;
+
+// A 100 x 100 x 20 stock with its top at z = 20 and a flat end mill
+std::unique_ptr<PathSimulator::PathSim> makeSimulator()
+{
+    auto sim = std::make_unique<PathSimulator::PathSim>();
+    Part::TopoShape stock(BRepPrimAPI_MakeBox(100.0, 100.0, 20.0).Shape());
+    sim->BeginSimulation(&stock, 0.25F);
+    sim->SetToolShape(BRepPrimAPI_MakeCylinder(toolRadius, 30.0).Shape(), 0.1F);
+    return sim;
+}
+
+void applyGCode(PathSimulator::PathSim& sim, const std::string& gcode, int threads)
+{
+    Path::Toolpath path;
+    path.setFromGCode(gcode);
+    Base::Placement start(Base::Vector3d(0.0, 0.0, 25.0), Base::Rotation());
+    std::unique_ptr<Base::Placement> end(sim.ApplyToolpath(&start, path, threads));
+}
+
+// Clears the area between x, y = 20 and 80 two millimeters deep, crossing the bands of
+// several threads with lines and arcs
+std::string pocketGCode()
+{
+    std::ostringstream gcode;
+    gcode << "G0 X20 Y20 Z25\nG1 Z18\n";
+    for (int y = 20; y < 80; y += 10) {
+        gcode << "G1 X80 Y" << y << "\nG3 X80 Y" << y + 5 << " I0 J2.5\n";
+        gcode << "G1 X20 Y" << y + 5 << "\nG2 X20 Y" << y + 10 << " I0 J2.5\n";
+    }
+    gcode << "G0 Z25\n";
+    return gcode.str();
+}
+
+}  // namespace
+
+TEST(PathSim, applyToolpathIsIndependentOfThreadCount)
+{
+    // Arrange
+    auto single = makeSimulator();
+    auto multi = makeSimulator();
+    Mesh::MeshObject singleOuter;
+    Mesh::MeshObject singleInner;
+    Mesh::MeshObject multiOuter;
+    Mesh::MeshObject multiInner;
+
+    // Act
+    applyGCode(*single, pocketGCode(), 1);
+    applyGCode(*multi, pocketGCode(), 7);
+    single->m_stock->Tessellate(singleOuter, singleInner);
+    multi->m_stock->Tessellate(multiOuter, multiInner);
+
+    // Assert - the volumes are summed per band, so only the order of additions differs
+    EXPECT_GT(single->GetRemovedVolume(), 0.0);
+    EXPECT_NEAR(single->GetRemovedVolume(), multi->GetRemovedVolume(), 1e-6);
+    EXPECT_EQ(single->m_events.size(), multi->m_events.size());
+    ASSERT_EQ(singleOuter.countPoints(), multiOuter.countPoints());
+    ASSERT_EQ(singleOuter.countFacets(), multiOuter.countFacets());
+    for (unsigned long i = 0; i < singleOuter.countPoints(); i++) {
+        EXPECT_EQ(singleOuter.getPoint(i), multiOuter.getPoint(i));
+    }
+}
+
+TEST(PathSim, applyToolpathRemovesSlotVolume)
+{
+    // Arrange
+    auto sim = makeSimulator();
+    const double depth = 5.0;
+    const double length = 40.0;
+    const double expected = (length * 2.0 * toolRadius + M_PI * toolRadius * toolRadius) * depth;
+
+    // Act
+    applyGCode(*sim, "G0 X30 Y50 Z25\nG1 Z15\nG1 X70\nG0 Z25", 2);
+
+    // Assert - the heightmap approximates the outline of the slot by cells
+    EXPECT_NEAR(sim->GetRemovedVolume(), expected, expected * 0.1);
+    EXPECT_TRUE(sim->m_events.empty());
+}
+
+TEST(PathSim, applyToolpathReportsRapidCut)
+{
+    // Arrange
+    auto sim = makeSimulator();
+
+    // Act
+    applyGCode(*sim, "G0 X10 Y50 Z25\nG0 Z10\nG1 X20\nG0 Z25", 3);
+
+    // Assert - only the rapid plunge into the stock is reported, the feed move is fine
+    ASSERT_EQ(sim->m_events.size(), 1U);
+    EXPECT_EQ(sim->m_events[0].command, 1);
+    EXPECT_EQ(sim->m_events[0].type, cSimEvent::RapidCut);
+    EXPECT_GT(sim->GetRemovedVolume(), 0.0);
+}
+
+// NOLINTEND(readability-magic-numbers)
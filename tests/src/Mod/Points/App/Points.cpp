@@ -9,4 +9,20 @@ TEST(Points, TestDefault)
     kernel.setBasicPoints(points);
     EXPECT_EQ(kernel.size(), 0);
 }
+
+TEST(Points, TestCopySharesPointsUntilModified)
+{
+    Points::PointKernel kernel;
+    kernel.push_back(Base::Vector3d(1, 2, 3));
+
+    Points::PointKernel copy(kernel);
+    const Points::PointKernel& constKernel = kernel;
+    const Points::PointKernel& constCopy = copy;
+    EXPECT_EQ(&constKernel.getBasicPoints(), &constCopy.getBasicPoints());
+
+    copy.setPoint(0, Base::Vector3d(4, 5, 6));
+    EXPECT_NE(&constKernel.getBasicPoints(), &constCopy.getBasicPoints());
+    EXPECT_EQ(kernel.getPoint(0), Base::Vector3d(1, 2, 3));
+    EXPECT_EQ(copy.getPoint(0), Base::Vector3d(4, 5, 6));
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -8,7 +8,10 @@
 #include <App/Document.h>
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
+#include <Base/TimeInfo.h>
+#include <Mod/Part/App/Geometry.h>
 #include <Mod/Sketcher/App/GeoEnum.h>
+#include <Mod/Sketcher/App/Sketch.h>
 #include <Mod/Sketcher/App/SketchObject.h>
 #include <src/App/InitApplication.h>
 
@@ -253,3 +256,210 @@ TEST_F(SketchObjectTest, testReverseAngleConstraintToSupplementaryExpressionAppl
     // Assert
     EXPECT_EQ(std::string("32 °"), getObject()->getConstraintExpression(id));
 }
+
+namespace
+{
+
+// Builds a synthetic sketch of independent rectangles, each one with a width and a height
+void buildRectangles(int count,
+                     std::vector<Part::Geometry*>& geometry,
+                     std::vector<Sketcher::Constraint*>& constraints)
+{
+    using Sketcher::PointPos;
+
+    auto addConstraint = [&constraints](Sketcher::ConstraintType type,
+                                        int first,
+                                        PointPos firstPos,
+                                        int second = Sketcher::GeoEnum::GeoUndef,
+                                        PointPos secondPos = PointPos::none,
+                                        double value = 0.0) {
+        auto constraint = new Sketcher::Constraint();
+        constraint->Type = type;
+        constraint->First = first;
+        constraint->FirstPos = firstPos;
+        constraint->Second = second;
+        constraint->SecondPos = secondPos;
+        constraint->setValue(value);
+        constraints.push_back(constraint);
+    };
+
+    for (int i = 0; i < count; i++) {
+        double x = 20.0 * (i % 50);
+        double y = 20.0 * (i / 50);
+        Base::Vector3d p0(x, y, 0), p1(x + 10, y, 0), p2(x + 10, y + 5, 0), p3(x, y + 5, 0);
+
+        std::array<std::pair<Base::Vector3d, Base::Vector3d>, 4> sides {
+            {{p0, p1}, {p1, p2}, {p2, p3}, {p3, p0}}};
+
+        int first = int(geometry.size());
+        for (const auto& [start, end] : sides) {
+            auto line = new Part::GeomLineSegment();
+            line->setPoints(start, end);
+            geometry.push_back(line);
+        }
+
+        for (int j = 0; j < 4; j++) {
+            addConstraint(Sketcher::Coincident,
+                          first + j,
+                          PointPos::end,
+                          first + (j + 1) % 4,
+                          PointPos::start);
+        }
+        addConstraint(Sketcher::Horizontal, first, PointPos::none);
+        addConstraint(Sketcher::Horizontal, first + 2, PointPos::none);
+        addConstraint(Sketcher::Vertical, first + 1, PointPos::none);
+        addConstraint(Sketcher::Vertical, first + 3, PointPos::none);
+        addConstraint(Sketcher::DistanceX,
+                      first,
+                      PointPos::none,
+                      Sketcher::GeoEnum::GeoUndef,
+                      PointPos::none,
+                      10.0);
+        addConstraint(Sketcher::DistanceY,
+                      first + 1,
+                      PointPos::none,
+                      Sketcher::GeoEnum::GeoUndef,
+                      PointPos::none,
+                      5.0);
+    }
+}
+
+}  // namespace
+
+TEST_F(SketchObjectTest, testIncrementalSetUpMatchesFullSetUp)
+{
+    // Arrange
+    std::vector<Part::Geometry*> geometry;
+    std::vector<Sketcher::Constraint*> constraints;
+    buildRectangles(500, geometry, constraints);
+
+    Sketcher::Sketch fullSketch;
+    Sketcher::Sketch incrementalSketch;
+    incrementalSketch.setIncrementalSetUp(true);
+    incrementalSketch.setUpSketch(geometry, constraints);
+
+    // change the width of the first rectangle and move the second one
+    constraints[8]->setValue(12.0);
+    auto line = static_cast<Part::GeomLineSegment*>(geometry[4]);
+    line->setPoints(line->getStartPoint() + Base::Vector3d(1, 1, 0),
+                    line->getEndPoint() + Base::Vector3d(1, 1, 0));
+
+    // Act
+    Base::TimeInfo fullStart;
+    int fullDoF = fullSketch.setUpSketch(geometry, constraints);
+    Base::TimeInfo fullEnd;
+    int incrementalDoF = incrementalSketch.setUpSketch(geometry, constraints);
+    Base::TimeInfo incrementalEnd;
+
+    RecordProperty("FullSetUpTime", Base::TimeInfo::diffTime(fullStart, fullEnd));
+    RecordProperty("IncrementalSetUpTime", Base::TimeInfo::diffTime(fullEnd, incrementalEnd));
+
+    int fullResult = fullSketch.solve();
+    int incrementalResult = incrementalSketch.solve();
+
+    // Assert
+    EXPECT_EQ(fullDoF, 1000);
+    EXPECT_EQ(incrementalDoF, fullDoF);
+    EXPECT_EQ(fullResult, 0);
+    EXPECT_EQ(incrementalResult, fullResult);
+
+    for (int geoId : {0, 4}) {
+        auto fullPoint = fullSketch.getPoint(geoId, Sketcher::PointPos::end);
+        auto incrementalPoint = incrementalSketch.getPoint(geoId, Sketcher::PointPos::end);
+        EXPECT_NEAR(fullPoint.x, incrementalPoint.x, 1e-7);
+        EXPECT_NEAR(fullPoint.y, incrementalPoint.y, 1e-7);
+    }
+    EXPECT_NEAR(incrementalSketch.getPoint(0, Sketcher::PointPos::end).x, 12.0, 1e-7);
+
+    for (auto geo : geometry) {
+        delete geo;
+    }
+    for (auto constraint : constraints) {
+        delete constraint;
+    }
+}
+
+TEST_F(SketchObjectTest, testIncrementalSetUpAfterTopologyChange)
+{
+    // Arrange
+    std::vector<Part::Geometry*> geometry;
+    std::vector<Sketcher::Constraint*> constraints;
+    buildRectangles(10, geometry, constraints);
+
+    Sketcher::Sketch incrementalSketch;
+    incrementalSketch.setIncrementalSetUp(true);
+    int initialDoF = incrementalSketch.setUpSketch(geometry, constraints);
+
+    // fix the position of the first rectangle
+    auto constraint = new Sketcher::Constraint();
+    constraint->Type = Sketcher::Coincident;
+    constraint->First = 0;
+    constraint->FirstPos = Sketcher::PointPos::start;
+    constraint->Second = Sketcher::GeoEnum::RtPnt;
+    constraint->SecondPos = Sketcher::PointPos::start;
+    constraints.push_back(constraint);
+
+    auto hAxis = new Part::GeomLineSegment();
+    hAxis->setPoints(Base::Vector3d(0, 0, 0), Base::Vector3d(1, 0, 0));
+    geometry.push_back(hAxis);
+
+    // Act
+    int changedDoF = incrementalSketch.setUpSketch(geometry, constraints, 1);
+
+    // Assert
+    EXPECT_EQ(initialDoF, 20);
+    EXPECT_EQ(changedDoF, 18);
+
+    for (auto geo : geometry) {
+        delete geo;
+    }
+    for (auto constraint : constraints) {
+        delete constraint;
+    }
+}
+
+TEST_F(SketchObjectTest, testIncrementalSetUpAfterTangencySideChange)
+{
+    // Arrange
+    auto circle1 = new Part::GeomCircle();
+    circle1->setCenter(Base::Vector3d(0, 0, 0));
+    circle1->setRadius(10.0);
+    auto circle2 = new Part::GeomCircle();
+    circle2->setCenter(Base::Vector3d(15, 0, 0));
+    circle2->setRadius(5.0);
+    std::vector<Part::Geometry*> geometry {circle1, circle2};
+
+    auto constraint = new Sketcher::Constraint();
+    constraint->Type = Sketcher::Tangent;
+    constraint->First = 0;
+    constraint->Second = 1;
+    std::vector<Sketcher::Constraint*> constraints {constraint};
+
+    Sketcher::Sketch incrementalSketch;
+    incrementalSketch.setIncrementalSetUp(true);
+    incrementalSketch.setUpSketch(geometry, constraints);
+
+    // move the second circle inside the first one, which turns the tangency into internal
+    circle2->setCenter(Base::Vector3d(4, 0, 0));
+
+    // Act
+    Sketcher::Sketch fullSketch;
+    fullSketch.setUpSketch(geometry, constraints);
+    incrementalSketch.setUpSketch(geometry, constraints);
+    int fullResult = fullSketch.solve();
+    int incrementalResult = incrementalSketch.solve();
+
+    // Assert
+    EXPECT_EQ(fullResult, 0);
+    EXPECT_EQ(incrementalResult, fullResult);
+
+    auto fullCenter = fullSketch.getPoint(1, Sketcher::PointPos::mid);
+    auto incrementalCenter = incrementalSketch.getPoint(1, Sketcher::PointPos::mid);
+    EXPECT_NEAR(fullCenter.x, incrementalCenter.x, 1e-7);
+    EXPECT_NEAR(fullCenter.y, incrementalCenter.y, 1e-7);
+    EXPECT_LT(Base::Distance(fullSketch.getPoint(0, Sketcher::PointPos::mid), fullCenter), 10.0);
+
+    delete circle1;
+    delete circle2;
+    delete constraint;
+}
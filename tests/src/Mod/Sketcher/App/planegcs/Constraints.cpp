@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <set>
+
+#include "Mod/Sketcher/App/planegcs/Constraints.h"
+
+namespace
+{
+
+// The partial derivatives returned by gradRow, summed over the entries pointing to the same
+// parameter, must be the derivative returned by grad for that parameter.
+void expectGradRowMatchesGrad(GCS::Constraint& constr)
+{
+    GCS::VEC_pD params = constr.params();
+    std::vector<double> row(params.size(), 0.);
+    constr.gradRow(row.data());
+
+    std::set<double*> distinct(params.begin(), params.end());
+    for (double* param : distinct) {
+        double sum = 0.;
+        for (std::size_t k = 0; k < params.size(); k++) {
+            if (params[k] == param) {
+                sum += row[k];
+            }
+        }
+        EXPECT_NEAR(sum, constr.grad(param), 1e-12);
+    }
+}
+
+}  // namespace
+
+class ConstraintsTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        values = {1.0, 2.0, 4.5, -1.5, -0.5, 3.0, 2.5, 7.0, 3.2, 0.7};
+        for (int i = 0; i < 4; i++) {
+            points[i] = GCS::Point(&values[2 * i], &values[2 * i + 1]);
+        }
+        line1.p1 = points[0];
+        line1.p2 = points[1];
+        line2.p1 = points[2];
+        line2.p2 = points[3];
+    }
+
+    double* value1()
+    {
+        return &values[8];
+    }
+
+    double* value2()
+    {
+        return &values[9];
+    }
+
+    std::array<double, 10> values {};
+    std::array<GCS::Point, 4> points;
+    GCS::Line line1;
+    GCS::Line line2;
+};
+
+TEST_F(ConstraintsTest, gradRowOfPointConstraints)  // NOLINT
+{
+    // Arrange
+    GCS::ConstraintP2PDistance distance(points[0], points[1], value1());
+    GCS::ConstraintP2PAngle angle(points[0], points[2], value2(), 0.1);
+    GCS::ConstraintP2LDistance lineDistance(points[3], line1, value1());
+    GCS::ConstraintPointOnLine pointOnLine(points[2], line1);
+
+    // Act & Assert
+    expectGradRowMatchesGrad(distance);
+    expectGradRowMatchesGrad(angle);
+    expectGradRowMatchesGrad(lineDistance);
+    expectGradRowMatchesGrad(pointOnLine);
+}
+
+TEST_F(ConstraintsTest, gradRowOfLineConstraints)  // NOLINT
+{
+    // Arrange
+    GCS::ConstraintParallel parallel(line1, line2);
+    GCS::ConstraintPerpendicular perpendicular(line1, line2);
+    GCS::ConstraintEqual equal(value1(), value2());
+    GCS::ConstraintDifference difference(&values[0], &values[2], value1());
+
+    // Act & Assert
+    expectGradRowMatchesGrad(parallel);
+    expectGradRowMatchesGrad(perpendicular);
+    expectGradRowMatchesGrad(equal);
+    expectGradRowMatchesGrad(difference);
+}
+
+TEST_F(ConstraintsTest, gradRowWithSharedParameters)  // NOLINT
+{
+    // Arrange - both lines start at the same point, so their pvec contain duplicated entries
+    GCS::Line sharedLine;
+    sharedLine.p1 = points[0];
+    sharedLine.p2 = points[3];
+    GCS::ConstraintPerpendicular perpendicular(line1, sharedLine);
+    GCS::ConstraintParallel parallel(line1, sharedLine);
+    GCS::ConstraintPointOnLine pointOnLine(points[1], points[1], points[2]);
+
+    // Act & Assert
+    expectGradRowMatchesGrad(perpendicular);
+    expectGradRowMatchesGrad(parallel);
+    expectGradRowMatchesGrad(pointOnLine);
+}
+
+TEST_F(ConstraintsTest, gradRowDefaultImplementation)  // NOLINT
+{
+    // Arrange - the angle constraint relies on the default gradRow
+    GCS::Line sharedLine;
+    sharedLine.p1 = points[0];
+    sharedLine.p2 = points[3];
+    GCS::ConstraintL2LAngle angle(line1, sharedLine, value2());
+
+    // Act & Assert
+    expectGradRowMatchesGrad(angle);
+}
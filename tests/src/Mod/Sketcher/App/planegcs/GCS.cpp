@@ -2,6 +2,9 @@
 
 #include "gtest/gtest.h"
 
+#include <array>
+#include <vector>
+
 #include "Mod/Sketcher/App/planegcs/GCS.h"
 
 class SystemTest: public GCS::System
@@ -13,6 +16,61 @@ public:
     }
 };
 
+namespace
+{
+
+// Triangles of known side lengths with a fixed first vertex. Every triangle is an independent
+// cluster of the system.
+class Triangles
+{
+public:
+    explicit Triangles(int count)
+        : values(count * 6)
+        , fixed(count * 2)
+        , points(count * 3)
+    {
+        for (int i = 0; i < count; i++) {
+            fixed[2 * i] = 10.0 * i;
+            fixed[2 * i + 1] = -2.0 * i;
+            std::array<double, 6> guess {0.1, 0.2, 3.1, 0.5, 1.2, 4.3};
+            for (int j = 0; j < 6; j++) {
+                values[6 * i + j] = guess[j] + fixed[2 * i + j % 2];
+            }
+            for (int j = 0; j < 3; j++) {
+                points[3 * i + j] = GCS::Point(&values[6 * i + 2 * j], &values[6 * i + 2 * j + 1]);
+            }
+        }
+    }
+
+    void addTo(GCS::System& system)
+    {
+        int tag = 1;
+        for (int i = 0; i < int(points.size() / 3); i++) {
+            GCS::Point* triangle = &points[3 * i];
+            system.addConstraintCoordinateX(triangle[0], &fixed[2 * i], tag++);
+            system.addConstraintCoordinateY(triangle[0], &fixed[2 * i + 1], tag++);
+            system.addConstraintP2PDistance(triangle[0], triangle[1], &sides[0], tag++);
+            system.addConstraintP2PDistance(triangle[1], triangle[2], &sides[1], tag++);
+            system.addConstraintP2PDistance(triangle[2], triangle[0], &sides[2], tag++);
+        }
+        GCS::VEC_pD params;
+        for (double& value : values) {
+            params.push_back(&value);
+        }
+        system.declareUnknowns(params);
+        system.initSolution();
+    }
+
+    std::vector<double> values;
+
+private:
+    std::vector<double> fixed;
+    std::vector<GCS::Point> points;
+    std::array<double, 3> sides {3.0, 4.0, 5.0};
+};
+
+}  // namespace
+
 class GCSTest: public ::testing::Test
 {
 protected:
@@ -50,3 +108,26 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, parallelClusterSolvingMatchesSequential)  // NOLINT
+{
+    // Arrange
+    const int numTriangles {200};
+    Triangles sequentialTriangles(numTriangles);
+    Triangles parallelTriangles(numTriangles);
+    SystemTest parallelSystem;
+    sequentialTriangles.addTo(*System());
+    parallelTriangles.addTo(parallelSystem);
+    parallelSystem.parallelClusterSolving = true;
+
+    // Act
+    int sequentialResult = System()->solve();
+    System()->applySolution();
+    int parallelResult = parallelSystem.solve();
+    parallelSystem.applySolution();
+
+    // Assert
+    EXPECT_EQ(GCS::Success, sequentialResult);
+    EXPECT_EQ(sequentialResult, parallelResult);
+    EXPECT_EQ(sequentialTriangles.values, parallelTriangles.values);
+}
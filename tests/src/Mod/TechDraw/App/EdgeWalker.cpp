@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <vector>
+
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <ShapeAnalysis.hxx>
+#include <TopExp.hxx>
+#include <gp_Pnt.hxx>
+
+#include <Mod/TechDraw/App/DrawProjectSplit.h>
+#include <Mod/TechDraw/App/DrawUtil.h>
+#include <Mod/TechDraw/App/EdgeWalker.h>
+
+namespace
+{
+
+TopoDS_Edge makeEdge(double x1, double y1, double x2, double y2)
+{
+    return BRepBuilderAPI_MakeEdge(gp_Pnt(x1, y1, 0.0), gp_Pnt(x2, y2, 0.0)).Edge();
+}
+
+// the unit segments of a size x size grid, (size + 1)^2 vertices
+std::vector<TopoDS_Edge> makeGrid(int size)
+{
+    std::vector<TopoDS_Edge> edges;
+    for (int i = 0; i <= size; i++) {
+        for (int j = 0; j < size; j++) {
+            edges.push_back(makeEdge(j, i, j + 1, i));
+            edges.push_back(makeEdge(i, j, i, j + 1));
+        }
+    }
+    return edges;
+}
+
+// a long base line with count teeth standing on it
+std::vector<TopoDS_Edge> makeComb(int count)
+{
+    std::vector<TopoDS_Edge> edges;
+    edges.push_back(makeEdge(0.0, 0.0, count + 1.0, 0.0));
+    for (int i = 1; i <= count; i++) {
+        edges.push_back(makeEdge(i, 0.0, i, 1.0));
+    }
+    return edges;
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST(EdgeWalker, makeUniqueVListMergesCloseVertices)
+{
+    // Arrange
+    std::vector<TopoDS_Edge> edges;
+    edges.push_back(makeEdge(0.0, 0.0, 1.0, 0.0));
+    edges.push_back(makeEdge(1.0 + EWTOLERANCE / 2.0, 0.0, 1.0, 1.0));
+    edges.push_back(makeEdge(1.0, 1.0 + 2.0 * EWTOLERANCE, 0.0, 1.0));
+    TechDraw::EdgeWalker walker;
+
+    // Act
+    std::vector<TopoDS_Vertex> verts = walker.makeUniqueVList(edges);
+    std::vector<TechDraw::WalkerEdge> walkerEdges = walker.makeWalkerEdges(edges, verts);
+
+    // Assert
+    ASSERT_EQ(verts.size(), 5U);
+    ASSERT_EQ(walkerEdges.size(), 3U);
+    EXPECT_EQ(walkerEdges[0].v2, 1U);
+    EXPECT_EQ(walkerEdges[1].v1, 1U);
+    EXPECT_EQ(walkerEdges[2].v1, 3U);
+    EXPECT_EQ(walker.findUniqueVert(TopExp::FirstVertex(edges[1]), verts), 1U);
+}
+
+TEST(EdgeWalker, gridEmbedding)
+{
+    // Arrange
+    std::vector<TopoDS_Edge> edges = makeGrid(3);
+    TechDraw::EdgeWalker walker;
+
+    // Act
+    walker.loadEdges(edges);
+
+    // Assert
+    EXPECT_EQ(walker.getEmbeddingRowIx(0).size(), 2U);   // corner
+    EXPECT_EQ(walker.getEmbeddingRowIx(1).size(), 3U);   // side
+    std::vector<TopoDS_Vertex> verts = walker.makeUniqueVList(edges);
+    ASSERT_EQ(verts.size(), 16U);
+    for (std::size_t i = 0; i < verts.size(); i++) {
+        Base::Vector3d v = TechDraw::DrawUtil::vertex2Vector(verts[i]);
+        if (v.x > 0.5 && v.x < 2.5 && v.y > 0.5 && v.y < 2.5) {
+            EXPECT_EQ(walker.getEmbeddingRowIx(i).size(), 4U);
+        }
+    }
+}
+
+TEST(EdgeWalker, gridFaces)
+{
+    std::vector<TopoDS_Edge> edges = makeGrid(3);
+    TechDraw::EdgeWalker walker;
+
+    std::vector<TopoDS_Wire> wires = walker.execute(edges, false);
+
+    EXPECT_EQ(wires.size(), 9U);
+}
+
+TEST(EdgeWalker, makeComponentsSplitsSeparateGroups)
+{
+    // Arrange
+    std::vector<TopoDS_Edge> edges = makeGrid(2);
+    std::vector<TopoDS_Edge> square = {makeEdge(5.0, 0.0, 6.0, 0.0),
+                                       makeEdge(6.0, 0.0, 6.0, 1.0),
+                                       makeEdge(6.0, 1.0, 5.0, 1.0),
+                                       makeEdge(5.0, 1.0, 5.0, 0.0)};
+    edges.insert(edges.begin() + 3, square.begin(), square.end());
+    TechDraw::EdgeWalker walker;
+
+    // Act
+    std::vector<std::vector<TopoDS_Edge>> components = walker.makeComponents(edges);
+
+    // Assert
+    ASSERT_EQ(components.size(), 2U);
+    EXPECT_EQ(components[0].size(), 12U);
+    EXPECT_EQ(components[1].size(), 4U);
+    EXPECT_TRUE(components[1][0].IsSame(square[0]));
+}
+
+TEST(EdgeWalker, executeComponentsMatchesExecute)
+{
+    std::vector<TopoDS_Edge> edges = makeGrid(3);
+    std::vector<TopoDS_Edge> square = {makeEdge(5.0, 0.0, 7.0, 0.0),
+                                       makeEdge(7.0, 0.0, 7.0, 2.0),
+                                       makeEdge(7.0, 2.0, 5.0, 2.0),
+                                       makeEdge(5.0, 2.0, 5.0, 0.0)};
+    edges.insert(edges.end(), square.begin(), square.end());
+    TechDraw::EdgeWalker walker;
+
+    std::vector<TopoDS_Wire> serial = walker.execute(edges, true);
+    std::vector<TopoDS_Wire> parallel = TechDraw::EdgeWalker::executeComponents(edges);
+
+    // the same wires, sorted by size
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (std::size_t i = 0; i < serial.size(); i++) {
+        EXPECT_NEAR(ShapeAnalysis::ContourArea(parallel[i]),
+                    ShapeAnalysis::ContourArea(serial[i]),
+                    1e-9);
+    }
+}
+
+TEST(DrawProjectSplit, findSplitsAtTouchingVertex)
+{
+    std::vector<TopoDS_Edge> edges = makeComb(3);
+
+    std::vector<TechDraw::splitPoint> splits = TechDraw::DrawProjectSplit::findSplits(edges);
+
+    // only the base is touched inside, the ends of the teeth are their own vertices
+    ASSERT_EQ(splits.size(), 3U);
+    for (std::size_t i = 0; i < splits.size(); i++) {
+        EXPECT_EQ(splits[i].i, 0);
+        EXPECT_DOUBLE_EQ(splits[i].v.x, i + 1.0);
+        EXPECT_NEAR(splits[i].param, i + 1.0, 1e-6);
+    }
+}
+
+TEST(EdgeWalker, largeEdgeSetThroughput)
+{
+    using Clock = std::chrono::steady_clock;
+    const int size = 100;
+    const int teeth = 5000;
+    std::vector<TopoDS_Edge> grid = makeGrid(size);
+    std::vector<TopoDS_Edge> comb = makeComb(teeth);
+    TechDraw::EdgeWalker walker;
+
+    auto start = Clock::now();
+    std::vector<TopoDS_Vertex> verts = walker.makeUniqueVList(grid);
+    std::vector<TechDraw::WalkerEdge> walkerEdges = walker.makeWalkerEdges(grid, verts);
+    walker.loadEdges(walkerEdges);
+    std::vector<TechDraw::embedItem> embedding = walker.makeEmbedding(grid, verts);
+    auto middle = Clock::now();
+    std::vector<TechDraw::splitPoint> splits = TechDraw::DrawProjectSplit::findSplits(comb);
+    auto end = Clock::now();
+
+    // the timings are only reported as they depend on the machine
+    EXPECT_EQ(verts.size(), std::size_t((size + 1) * (size + 1)));
+    EXPECT_EQ(walkerEdges.size(), grid.size());
+    EXPECT_EQ(embedding.size(), verts.size());
+    EXPECT_EQ(splits.size(), std::size_t(teeth));
+    auto walkerTime = std::chrono::duration_cast<std::chrono::milliseconds>(middle - start);
+    auto splitTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - middle);
+    RecordProperty("WalkerMilliseconds", static_cast<int>(walkerTime.count()));
+    RecordProperty("SplitMilliseconds", static_cast<int>(splitTime.count()));
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)